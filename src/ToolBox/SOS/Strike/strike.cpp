@@ -7353,6 +7353,9 @@ DECLARE_API(ThreadPool)
                     "Stabilizing",
                     "Starvation",
                     "ThreadTimedOut",
+                    "QueueLatency",
+                    "BlockedWorkers",
+                    "Oversubscribed",
                     "Undefined"
                 };
 
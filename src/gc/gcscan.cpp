@@ -177,8 +177,9 @@ VOID CNameSpace::GcScanRoots(promote_func* fn,  int condemned, int max_gen,
                 }
             }
 
-            Thread* pThread = NULL;
-            while ((pThread = ThreadStore::GetThreadList(pThread)) != NULL)
+            ThreadStore::ThreadIterator threads;
+            Thread* pThread;
+            while ((pThread = threads.Next()) != NULL)
             {
                 STRESS_LOG2(LF_GC|LF_GCROOTS, LL_INFO100, "{ Starting scan of Thread %p ID = %x\n", pThread, pThread->GetThreadId());
 
@@ -323,8 +324,9 @@ void CNameSpace::GcFixAllocContexts (void* arg, void *heap)
 
     if (GCHeap::UseAllocationContexts())
     {
-        Thread  *thread = NULL;
-        while ((thread = ThreadStore::GetThreadList(thread)) != NULL)
+        ThreadStore::ThreadIterator threads;
+        Thread  *thread;
+        while ((thread = threads.Next()) != NULL)
         {
             GCHeap::GetGCHeap()->FixAllocContext(thread->GetAllocContext(), FALSE, arg, heap);
         }
@@ -337,8 +339,9 @@ void CNameSpace::GcEnumAllocContexts (enum_alloc_context_func* fn)
 
     if (GCHeap::UseAllocationContexts())
     {
-        Thread  *thread = NULL;
-        while ((thread = ThreadStore::GetThreadList(thread)) != NULL)
+        ThreadStore::ThreadIterator threads;
+        Thread  *thread;
+        while ((thread = threads.Next()) != NULL)
         {
             (*fn) (thread->GetAllocContext());
         }
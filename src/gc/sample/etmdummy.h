@@ -20,6 +20,8 @@
 #define FireEtwGCRestartEEBegin_V1(ClrInstanceID) 0
 #define FireEtwGCSuspendEEEnd() 0
 #define FireEtwGCSuspendEEEnd_V1(ClrInstanceID) 0
+#define FireEtwGCSuspendEEEnd_V2(ClrInstanceID, SuspendDuration, RendezvousCount, ActivationCount) 0
+#define FireEtwGCSuspendEEStats(ClrInstanceID, RetryCount, InterruptibleCount, HijackableCount, NativeCount, UnknownCount, MaxTimeToSafePoint, OffenderThreadID, OffenderReason, OffenderIP) 0
 #define FireEtwGCSuspendEEBegin(Reason) 0
 #define FireEtwGCSuspendEEBegin_V1(Reason, Count, ClrInstanceID) 0
 #define FireEtwGCAllocationTick(AllocationAmount, AllocationKind) 0
@@ -90,6 +92,7 @@
 #define FireEtwContention() 0
 #define FireEtwContentionStart_V1(ContentionFlags, ClrInstanceID) 0
 #define FireEtwContentionStop(ContentionFlags, ClrInstanceID) 0
+#define FireEtwContentionStats(LockID, OwnerThreadID, WaitDuration, SpinSucceeded, SpinSuccessRate, ContentionCount, SpinSuccessCount, TotalWaitDuration, ClrInstanceID) 0
 #define FireEtwCLRStackWalk(ClrInstanceID, Reserved1, Reserved2, FrameCount, Stack) 0
 #define FireEtwAppDomainMemAllocated(AppDomainID, Allocated, ClrInstanceID) 0
 #define FireEtwAppDomainMemSurvived(AppDomainID, Survived, ProcessSurvived, ClrInstanceID) 0
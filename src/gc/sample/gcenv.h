@@ -770,6 +770,23 @@ public:
     static Thread * GetThreadList(Thread * pThread);
 
     static void AttachCurrentThread(bool fAcquireThreadStoreLock);
+
+    class ThreadIterator
+    {
+        Thread * m_pThread;
+
+    public:
+        ThreadIterator()
+            : m_pThread(NULL)
+        {
+        }
+
+        Thread * Next()
+        {
+            m_pThread = GetThreadList(m_pThread);
+            return m_pThread;
+        }
+    };
 };
 
 struct ScanContext;
@@ -417,6 +417,10 @@ RETAIL_CONFIG_DWORD_INFO_EX(EXTERNAL_JitInlineAdditionalMultiplier, W("JitInline
 RETAIL_CONFIG_DWORD_INFO_EX(INTERNAL_JitInlineSIMDMultiplier, W("JitInlineSIMDMultiplier"), 3, "", CLRConfig::REGUTIL_default)
 CONFIG_DWORD_INFO_EX(INTERNAL_JitInlinePrintStats, W("JitInlinePrintStats"), (DWORD)0, "", CLRConfig::REGUTIL_default)
 CONFIG_DWORD_INFO_DIRECT_ACCESS(INTERNAL_JITInlineSize, W("JITInlineSize"), "")
+CONFIG_DWORD_INFO_EX(INTERNAL_JitInlinePolicy, W("JitInlinePolicy"), 0, "Selects the inline profitability policy: 0 = legacy size thresholds, 1 = profitability model with a per-method growth budget, 2 = replay JitInlineReplayFile", CLRConfig::REGUTIL_default)
+CONFIG_DWORD_INFO_EX(INTERNAL_JitInlineBudget, W("JitInlineBudget"), 10, "Under the profitability inline policy, the IL bytes that may be inlined into a method, as a multiple of its own IL size", CLRConfig::REGUTIL_default)
+CONFIG_STRING_INFO_EX(INTERNAL_JitInlineLogFile, W("JitInlineLogFile"), "If set, append every inline decision to this file, in the format read by JitInlineReplayFile", CLRConfig::REGUTIL_default)
+CONFIG_STRING_INFO_EX(INTERNAL_JitInlineReplayFile, W("JitInlineReplayFile"), "Inline decisions to repeat under JitInlinePolicy=2", CLRConfig::REGUTIL_default)
 CONFIG_STRING_INFO_EX(INTERNAL_JitLateDisasm, W("JitLateDisasm"), "", CLRConfig::REGUTIL_default)
 CONFIG_STRING_INFO_EX(INTERNAL_JITLateDisasmTo, W("JITLateDisasmTo"), "", CLRConfig::REGUTIL_default)
 RETAIL_CONFIG_DWORD_INFO_EX(EXTERNAL_JitLRSampling, W("JitLRSampling"), 0, "", CLRConfig::REGUTIL_default)
@@ -470,6 +474,7 @@ CONFIG_DWORD_INFO_EX(INTERNAL_JitNoRegLoc, W("JitNoRegLoc"), 0, "", CLRConfig::R
 CONFIG_DWORD_INFO_EX(INTERNAL_JitNoStructPromotion, W("JitNoStructPromotion"), 0, "Disables struct promotion in Jit32", CLRConfig::REGUTIL_default)
 CONFIG_DWORD_INFO_EX(INTERNAL_JitNoUnroll, W("JitNoUnroll"), 0, "", CLRConfig::REGUTIL_default)
 CONFIG_DWORD_INFO_EX(INTERNAL_JitNoMemoryBarriers, W("JitNoMemoryBarriers"), 0, "If 1, don't generate memory barriers", CLRConfig::REGUTIL_default)
+CONFIG_DWORD_INFO_EX(INTERNAL_JitNoBarrierElision, W("JitNoBarrierElision"), 0, "If 1, keep the write barriers of stores into objects allocated earlier in the same block", CLRConfig::REGUTIL_default)
 #ifdef FEATURE_ENABLE_NO_RANGE_CHECKS
 RETAIL_CONFIG_DWORD_INFO(PRIVATE_JitNoRangeChks, W("JitNoRngChks"), 0, "If 1, don't generate range checks")
 #endif
@@ -541,11 +546,14 @@ RETAIL_CONFIG_DWORD_INFO(INTERNAL_JitVNMapSelBudget, W("JitVNMapSelBudget"), 100
 #endif // !defined(_TARGET_AMD64_)
 RETAIL_CONFIG_DWORD_INFO_EX(EXTERNAL_FeatureSIMD, W("FeatureSIMD"), EXTERNAL_FeatureSIMD_Default, "Enable SIMD support with companion SIMDVector.dll", CLRConfig::REGUTIL_default)
 RETAIL_CONFIG_DWORD_INFO_EX(EXTERNAL_EnableAVX, W("EnableAVX"), EXTERNAL_JitEnableAVX_Default, "Enable AVX instruction set for wide operations as default", CLRConfig::REGUTIL_default)
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_JitVectorizeLoops, W("JitVectorizeLoops"), 0, "If non-zero, rewrite simple counted loops over primitive arrays into SIMD loops (requires FeatureSIMD).")
+CONFIG_DWORD_INFO(INTERNAL_JitReportVectorizedLoops, W("JitReportVectorizedLoops"), 0, "If non-zero, print which loops were vectorized, and why the others were not, to stdout.")
 
 #ifdef FEATURE_MULTICOREJIT
 
 RETAIL_CONFIG_STRING_INFO(INTERNAL_MultiCoreJitProfile, W("MultiCoreJitProfile"), "If set, use the file to store/control multi-core JIT.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_MultiCoreJitProfileWriteDelay, W("MultiCoreJitProfileWriteDelay"), 12, "Set the delay after which the multi-core JIT profile will be written to disk.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_MultiCoreJitThreads, W("MultiCoreJitThreads"), 1, "Number of threads compiling methods when playing back a multi-core JIT profile, including the player thread; 1 plays back on the player thread only, 0 uses one per processor (at most 8).")
 
 #endif
 
@@ -591,6 +599,8 @@ RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_EnableFastBindClosure, W("EnableFastBindClo
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_DisableFXClosureWalk, W("DisableFXClosureWalk"), 0, "Disable full closure walks even in the presence of FX binding redirects")
 CONFIG_DWORD_INFO(INTERNAL_TagAssemblyNames, W("TagAssemblyNames"), 0, "Enable CAssemblyName::_tag field for more convenient debugging.")
 RETAIL_CONFIG_STRING_INFO(INTERNAL_WinMDPath, W("WinMDPath"), "Path for Windows WinMD files")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_CastCacheMaxEntries, W("CastCacheMaxEntries"), 0x4000, "Maximum number of entries in the cache of cast results; 0 disables the cache")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_ThreadStaticCache, W("ThreadStaticCache"), 1, "Cache the thread static bases of recently used classes in native TLS; 0 disables the cache")
 
 // 
 // Loader heap
@@ -925,6 +935,9 @@ RETAIL_CONFIG_DWORD_INFO(INTERNAL_ThreadPool_ForceMaxWorkerThreads, W("ThreadPoo
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_ThreadPool_DisableStarvationDetection, W("ThreadPool_DisableStarvationDetection"), 0, "Disables the ThreadPool feature that forces new threads to be added when workitems run for too long")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_ThreadPool_DebugBreakOnWorkerStarvation, W("ThreadPool_DebugBreakOnWorkerStarvation"), 0, "Breaks into the debugger if the ThreadPool detects work queue starvation")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_ThreadPool_EnableWorkerTracking, W("ThreadPool_EnableWorkerTracking"), 0, "Enables extra expensive tracking of how many workers threads are working simultaneously")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_ThreadPool_UseLatencyController, W("ThreadPool_UseLatencyController"), 0, "Replaces HillClimbing with a controller that adds worker threads when queued work waits too long or workers are blocked")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_ThreadPool_LatencyTarget, W("ThreadPool_LatencyTarget"), 10, "Milliseconds queued work may go unserviced before the latency controller adds a worker thread")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_ThreadPool_OversubscriptionLimit, W("ThreadPool_OversubscriptionLimit"), 200, "Percentage of the processors that runnable (non-blocked) worker threads may occupy under the latency controller")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_Thread_UseAllCpuGroups, W("Thread_UseAllCpuGroups"), 0, "Specifies if to automatically distribute thread across CPU Groups")
 
 CONFIG_DWORD_INFO(INTERNAL_ThreadpoolTickCountAdjustment, W("ThreadpoolTickCountAdjustment"), 0, "")
@@ -1122,6 +1135,7 @@ CONFIG_DWORD_INFO(INTERNAL_SuspendThreadDeadlockTimeoutMs, W("SuspendThreadDeadl
 RETAIL_CONFIG_DWORD_INFO_DIRECT_ACCESS(EXTERNAL_SymbolReadingPolicy, W("SymbolReadingPolicy"), "Specifies when PDBs may be read")
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_TestDataConsistency, W("TestDataConsistency"), FALSE, "allows ensuring the left side is not holding locks (and may thus be in an inconsistent state) when inspection occurs")
 RETAIL_CONFIG_DWORD_INFO_EX(EXTERNAL_ThreadGuardPages, W("ThreadGuardPages"), 0, "", CLRConfig::REGUTIL_default)
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_ThreadSuspendInjection, W("ThreadSuspendInjection"), 1, "Specifies whether to interrupt threads running managed code with activation signals when suspending the runtime. Only used on platforms that support activation injection.")
 RETAIL_CONFIG_DWORD_INFO_EX(EXTERNAL_Timeline, W("Timeline"), 0, "", CLRConfig::REGUTIL_default)
 CONFIG_STRING_INFO_EX(INTERNAL_TlbImpShouldBreakOnConvFunction, W("TlbImpShouldBreakOnConvFunction"), "", CLRConfig::REGUTIL_default)
 CONFIG_DWORD_INFO_DIRECT_ACCESS(INTERNAL_TlbImpSkipLoading, W("TlbImpSkipLoading"), "")
@@ -1153,6 +1153,31 @@ enum CorInfoGCType
     TYPE_GC_OTHER   // requires type-specific treatment
 };
 
+// System V AMD64 ABI classification of one eightbyte of a struct.
+enum SystemVClassificationType
+{
+    SystemVClassificationTypeUnknown = 0,
+    SystemVClassificationTypeNoClass,
+    SystemVClassificationTypeMemory,
+    SystemVClassificationTypeInteger,
+    SystemVClassificationTypeSSE,
+};
+
+#define CLR_SYSTEMV_MAX_EIGHTBYTES_COUNT_TO_PASS_IN_REGISTERS   2
+#define CLR_SYSTEMV_MAX_STRUCT_BYTES_TO_PASS_IN_REGISTERS       16
+
+// Describes how a value class is passed on System V AMD64: whether it travels in registers,
+// and if so the class, size and offset of each of its eightbytes.  Filled in by
+// getSystemVAmd64PassStructInRegisterDescriptor.
+struct SYSTEMV_AMD64_CORINFO_STRUCT_REG_PASSING_DESCRIPTOR
+{
+    bool                        passedInRegisters;
+    unsigned __int8             eightByteCount;
+    SystemVClassificationType   eightByteClassifications[CLR_SYSTEMV_MAX_EIGHTBYTES_COUNT_TO_PASS_IN_REGISTERS];
+    unsigned __int8             eightByteSizes[CLR_SYSTEMV_MAX_EIGHTBYTES_COUNT_TO_PASS_IN_REGISTERS];
+    unsigned __int8             eightByteOffsets[CLR_SYSTEMV_MAX_EIGHTBYTES_COUNT_TO_PASS_IN_REGISTERS];
+};
+
 enum CorInfoClassId
 {
     CLASSID_SYSTEM_OBJECT,
@@ -1472,6 +1497,8 @@ struct CORINFO_LOOKUP_KIND
 #define CORINFO_MAXINDIRECTIONS 4
 #define CORINFO_USEHELPER ((WORD) 0xffff)
 
+#define CORINFO_NO_SIZE_CHECK ((WORD) 0xffff)
+
 struct CORINFO_RUNTIME_LOOKUP
 {
     // This is signature you must pass back to the runtime lookup helper
@@ -1493,6 +1520,11 @@ struct CORINFO_RUNTIME_LOOKUP
     // If set, test the lowest bit and dereference if set (see code:FixupPointer)
     bool                    testForFixup;
 
+    // CORINFO_NO_SIZE_CHECK = the last offset is always within the object the last indirection reads from
+    // Otherwise, that object holds its size in bytes at this byte-offset. Only if the last offset is below
+    // the size may the slot be read; if not, treat the slot as null (and call the helper, see testForNull).
+    WORD                    sizeOffset;
+
     SIZE_T                  offsets[CORINFO_MAXINDIRECTIONS];
 } ;
 
@@ -2876,6 +2908,16 @@ public:
             BYTE                       *gcPtrs      /* OUT */
             ) = 0;
 
+    // This is only called for Value classes.  Fills in 'structPassInRegDescPtr' with
+    // how a value of type 'cls' is passed as an argument under the System V AMD64 ABI.
+    // passedInRegisters is false on other targets, and for value classes that are passed
+    // on the stack or by reference.
+    // returns false if the description could not be computed
+    virtual bool getSystemVAmd64PassStructInRegisterDescriptor (
+            CORINFO_CLASS_HANDLE        cls,                    /* IN */
+            SYSTEMV_AMD64_CORINFO_STRUCT_REG_PASSING_DESCRIPTOR* structPassInRegDescPtr  /* OUT */
+            ) = 0;
+
     // returns the number of instance fields in a class
     virtual unsigned getClassNumInstanceFields (
             CORINFO_CLASS_HANDLE        cls        /* IN */
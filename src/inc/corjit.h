@@ -356,11 +356,11 @@ extern "C" ICorJitCompiler* __stdcall getJit();
 #if !defined(RYUJIT_CTPBUILD)
 
 // Update this one
-SELECTANY const GUID JITEEVersionIdentifier = { /* 8e31af35-be80-4484-a91a-b096a08a49fe */
-  0x8e31af35,
-  0xbe80,
-  0x4484,
-  { 0xa9, 0x1a, 0xb0, 0x96, 0xa0, 0x8a, 0x49, 0xfe }
+SELECTANY const GUID JITEEVersionIdentifier = { /* 394f1bdf-55e2-44c7-832e-47c21fe3d416 */
+  0x394f1bdf,
+  0x55e2,
+  0x44c7,
+  { 0x83, 0x2e, 0x47, 0xc2, 0x1f, 0xe3, 0xd4, 0x16 }
   };
 
 #else
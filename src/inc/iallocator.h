@@ -29,6 +29,13 @@ class IAllocator
     virtual void* ArrayAlloc(size_t elems, size_t elemSize) = 0;
 
     virtual void  Free(void* p) = 0;
+
+    // Free "p", which the caller knows to be "sz" bytes long. Allocators that cannot
+    // free individual blocks may use the size to hand the block out again.
+    virtual void  FreeSized(void* p, size_t sz)
+    {
+        Free(p);
+    }
 };
 
 // The "DefaultAllocator" class may be used by classes that wish to
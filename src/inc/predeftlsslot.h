@@ -58,6 +58,7 @@ enum PredefinedTlsSlots
 
     TlsIdx_SOIntolerantTransitionHandler, // The thread is entering SO intolerant code.  This one is used by
                                           // Thread::IsSOIntolerant to decide the SO mode of the thread.
+    TlsIdx_ThreadpoolWorkQueue, // WorkRequestStealingQueue* owned by a thread pool worker
     MAX_PREDEFINED_TLS_SLOT
 };
 
@@ -1508,6 +1508,19 @@ private:
 
 #define CLRGetTickCount64() GetTickCount64()
 
+// Returns the number of microseconds elapsed since qpcStart, a value returned
+// by QueryPerformanceCounter, or 0 if the high resolution counter fails.
+inline ULONGLONG CLRGetElapsedMicroseconds(const LARGE_INTEGER &qpcStart)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    LARGE_INTEGER qpcEnd, qpFrequency;
+    if (!QueryPerformanceCounter(&qpcEnd) || !QueryPerformanceFrequency(&qpFrequency) || qpFrequency.QuadPart == 0)
+        return 0;
+
+    return (ULONGLONG)((qpcEnd.QuadPart - qpcStart.QuadPart) * 1000000 / qpFrequency.QuadPart);
+}
+
 //
 // Use this function to initialize the s_CodeAllocHint
 // during startup. base is runtime .dll base address,
@@ -112,8 +112,10 @@ VPTR_CLASS(PInvokeCalliFrame)
 VPTR_CLASS(PrestubMethodFrame)
 VPTR_CLASS(ProtectByRefsFrame)
 VPTR_CLASS(ProtectValueClassFrame)
-#ifdef FEATURE_HIJACK
+#if defined(FEATURE_HIJACK) || defined(FEATURE_ACTIVATION_INJECTION)
 VPTR_CLASS(ResumableFrame)
+#endif
+#ifdef FEATURE_HIJACK
 VPTR_CLASS(RedirectedThreadFrame)
 #endif
 VPTR_CLASS(StubDispatchFrame)
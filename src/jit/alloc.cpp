@@ -61,6 +61,12 @@ bool   norls_allocator::nraInit(IEEMemoryManager* pMemoryManager, size_t pageSiz
     nraFreeNext  =
     nraFreeLast  = 0;
 
+    nraSparePages = 0;
+
+    memset(nraRecycled, 0, sizeof(nraRecycled));
+    nraRecycledCount = 0;
+    nraRecycledSize  = 0;
+
     assert(THE_ALLOCATOR_BASE_SIZE != 0);
 
     nraPageSize  = pageSize ? pageSize : THE_ALLOCATOR_BASE_SIZE;
@@ -135,11 +141,20 @@ void    *   norls_allocator::nraAllocNewPage(size_t sz)
         sizPage &= ~(DEFAULT_PAGE_SIZE - 1);
     }
 
-    /* Allocate the new page */
+    /* Allocate the new page, preferring one kept by nraReset() */
 
-    newPage = (norls_pagdesc *)nraVirtualAlloc(0, sizPage, MEM_COMMIT, PAGE_READWRITE);
-    if  (!newPage)
-        NOMEM();
+    if  (nraSparePages && nraSparePages->nrpPageSize >= sizPage)
+    {
+        newPage       = nraSparePages;
+        nraSparePages = newPage->nrpNextPage;
+        sizPage       = newPage->nrpPageSize;
+    }
+    else
+    {
+        newPage = (norls_pagdesc *)nraVirtualAlloc(0, sizPage, MEM_COMMIT, PAGE_READWRITE);
+        if  (!newPage)
+            NOMEM();
+    }
 
 #ifdef DEBUG
     newPage->nrpSelfPtr = newPage;
@@ -187,6 +202,65 @@ void        norls_allocator::nraFree(void)
 
         nraVirtualFree(temp, 0, MEM_RELEASE);
     }
+
+    while   (nraSparePages)
+    {
+        norls_pagdesc * temp;
+
+        temp = nraSparePages;
+               nraSparePages = temp->nrpNextPage;
+
+        nraVirtualFree(temp, 0, MEM_RELEASE);
+    }
+}
+
+// This method releases all the allocations but the first page, like nraToss() back to an
+// empty mark. Up to 'maxSparePages' of the released pages that have the size of the first
+// one are kept on the spare list, so the next user of this allocator can grow into them
+// without going back to the host.
+
+void        norls_allocator::nraReset(unsigned maxSparePages)
+{
+    /* Recycled blocks live in the pages being released */
+
+    memset(nraRecycled, 0, sizeof(nraRecycled));
+    nraRecycledCount = 0;
+    nraRecycledSize  = 0;
+
+    if  (!nraPageList)
+        return;
+
+    unsigned        spareCount = 0;
+    norls_pagdesc * page;
+
+    for (page = nraSparePages; page; page = page->nrpNextPage)
+        spareCount++;
+
+    page = nraPageList->nrpNextPage;
+
+    while (page)
+    {
+        norls_pagdesc * next = page->nrpNextPage;
+
+        if  (spareCount < maxSparePages && page->nrpPageSize == nraPageList->nrpPageSize)
+        {
+            page->nrpNextPage = nraSparePages;
+            nraSparePages     = page;
+            spareCount++;
+        }
+        else
+        {
+            nraVirtualFree(page, 0, MEM_RELEASE);
+        }
+
+        page = next;
+    }
+
+    nraPageList->nrpNextPage = 0;
+    nraPageLast  = nraPageList;
+
+    nraFreeNext  = nraPageList->nrpContents;
+    nraFreeLast  = nraPageList->nrpPageSize + (BYTE *)nraPageList;
 }
 
 // This method walks the nraPageList backward and release the pages.
@@ -282,6 +356,75 @@ void    *           norls_allocator::nraAlloc(size_t sz)
 #endif
 /*****************************************************************************/
 
+/*****************************************************************************
+ * Blocks released by their owner are kept in power-of-two size buckets and
+ * handed out again by nraAllocRecycled(). nraRecycle() files a block under
+ * the largest bucket it can fill, nraAllocRecycled() looks in the smallest
+ * bucket that is guaranteed to fit, so no size needs to be stored with the
+ * block. Everything is dropped when the allocator is reset.
+ *
+ * Under DEBUG a released block is filled with nraFreedFill past its link, and
+ * the fill is checked when the block is handed out again, so an owner that
+ * keeps writing to a block after releasing it is caught.
+ */
+
+#ifdef DEBUG
+static const BYTE   nraFreedFill = 0xDD;
+#endif
+
+void                norls_allocator::nraRecycle(void * block, size_t sz)
+{
+    if  (sz < (1 << NRA_MIN_RECYCLE_SHIFT))
+        return;     // too small to hold the link
+
+    unsigned bucket = 0;
+
+    while (bucket + 1 < NRA_RECYCLE_BUCKETS && sz >= ((size_t)1 << (bucket + 1 + NRA_MIN_RECYCLE_SHIFT)))
+        bucket++;
+
+#ifdef DEBUG
+    memset(block, nraFreedFill, sz);
+#endif
+
+    *(void **)block     = nraRecycled[bucket];
+    nraRecycled[bucket] = block;
+    nraRecycledCount++;
+}
+
+// Returns NULL if no released block is known to be large enough.
+
+void    *           norls_allocator::nraAllocRecycled(size_t sz)
+{
+    if  (nraRecycledCount == 0 || sz > (1 << NRA_MAX_RECYCLE_SHIFT))
+        return NULL;
+
+    unsigned bucket = 0;
+
+    while (sz > ((size_t)1 << (bucket + NRA_MIN_RECYCLE_SHIFT)))
+        bucket++;
+
+    void    *   block = nraRecycled[bucket];
+
+    if  (block == NULL)
+        return NULL;
+
+    nraRecycled[bucket] = *(void **)block;
+    nraRecycledCount--;
+    nraRecycledSize    += sz;
+
+#ifdef DEBUG
+    // Every block in the bucket was at least this large when it was released
+    for (size_t i = sizeof(void *); i < ((size_t)1 << (bucket + NRA_MIN_RECYCLE_SHIFT)); i++)
+    {
+        assert(((BYTE *)block)[i] == nraFreedFill && "JIT memory written after it was released");
+    }
+
+    memset(block, UninitializedWord<char>(), sz);
+#endif
+
+    return block;
+}
+
 size_t              norls_allocator::nraTotalSizeAlloc()
 {
     norls_pagdesc * page;
@@ -308,19 +451,22 @@ size_t              norls_allocator::nraTotalSizeUsed()
 }
 
 /*****************************************************************************
- * We try to use this allocator instance as much as possible. It will always
- * keep a page handy so small methods won't have to call VirtualAlloc()
- * But we may not be able to use it if another thread/reentrant call
- * is already using it.
+ * We try to use these allocator instances as much as possible. Each one keeps
+ * its first page and a few spare pages handy across compilations, so small and
+ * medium methods won't have to call VirtualAlloc(). There is one instance per
+ * concurrently compiling thread, up to NRA_POOL_SIZE; past that (or for
+ * reentrant compilations) the caller uses a fresh allocator.
  */
 
-static norls_allocator *nraTheAllocator;
-static nraMarkDsc       nraTheAllocatorMark;
-static LONG             nraTheAllocatorIsInUse = 0;
+const unsigned      NRA_POOL_SIZE        = 8;
+const unsigned      NRA_POOL_SPARE_PAGES = 4;   // Retained pages beyond the first one, per instance
 
-// The static instance which we try to reuse for all non-simultaneous requests
+static norls_allocator *nraPool[NRA_POOL_SIZE];
+static LONG             nraPoolIsInUse[NRA_POOL_SIZE];
 
-static norls_allocator  theAllocator;
+// The static instances which we try to reuse for all requests
+
+static norls_allocator  thePooledAllocators[NRA_POOL_SIZE];
 
 /*****************************************************************************/
 
@@ -332,21 +478,21 @@ void                nraInitTheAllocator()
 
 void                nraTheAllocatorDone()
 {   
-    // We chose not to call nraTheAllocator->nraFree() and let the memory leak.
+    // We chose not to call nraFree() on the pooled allocators and let the memory leak.
     // Below is the reason (VSW 600919).
 
     // The following race-condition exists during ExitProcess.
     // Thread A calls ExitProcess, which causes thread B to terminate.
-    // Thread B terminated in the middle of nraToss() 
-    // (through the call-chain of nraFreeTheAllocator()  ==> nraRlsm() ==> nraToss())
-    // And then thread A comes along to call nraTheAllocator->nraFree() which will cause the double-free 
+    // Thread B terminated in the middle of nraReset() 
+    // (through the call-chain of nraFreePooledAllocator() ==> nraReset())
+    // And then thread A comes along to call nraFree() on the same instance which will cause the double-free 
     // of page specified by "temp".
 
     // These are possible fixes:
-    // 1. Thread A tries to get hold on nraTheAllocatorIsInUse lock before
-    //    calling theAllocator.nraFree(). However, this could cause the deadlock because thread B
-    //    has already gone and therefore it can't release nraTheAllocatorIsInUse.
-    // 2. Fix the logic in nraToss() and nraFree() to update nraPageList and nraPageLast in a thread safe way.
+    // 1. Thread A tries to get hold on nraPoolIsInUse lock before
+    //    calling nraFree(). However, this could cause the deadlock because thread B
+    //    has already gone and therefore it can't release nraPoolIsInUse.
+    // 2. Fix the logic in nraReset() and nraFree() to update nraPageList and nraPageLast in a thread safe way.
     //    But it needs careful work to make it high performant (e.g. not holding a lock?)
     // 3. The scenario of dynamically unloading clrjit.dll cleanly is unimportant at this time.
     //    We will leak the memory associated with other instances of morls_allocator anyway.
@@ -357,56 +503,57 @@ void                nraTheAllocatorDone()
 
 /*****************************************************************************/
 
-norls_allocator *   nraGetTheAllocator(IEEMemoryManager* pMemoryManager)
+norls_allocator *   nraGetPooledAllocator(IEEMemoryManager* pMemoryManager)
 {
-    if (InterlockedExchange(&nraTheAllocatorIsInUse, 1))
+    for (unsigned i = 0; i < NRA_POOL_SIZE; i++)
     {
-        // Its being used by another Compiler instance
-        return NULL;
-    }
+        if (InterlockedExchange(&nraPoolIsInUse[i], 1))
+        {
+            // Its being used by another Compiler instance
+            continue;
+        }
 
-    if (nraTheAllocator == NULL)
-    {
-        // Not initialized yet
+        if (nraPool[i] == NULL)
+        {
+            // Not initialized yet
 
-        bool res = theAllocator.nraInit(pMemoryManager, 0, 1);
+            bool res = thePooledAllocators[i].nraInit(pMemoryManager, 0, 1);
 
-        if (res)
-        {
-            // failed to initialize
-            InterlockedExchange(&nraTheAllocatorIsInUse, 0);            
-            return NULL;
-        }
+            if (res)
+            {
+                // failed to initialize
+                InterlockedExchange(&nraPoolIsInUse[i], 0);
+                return NULL;
+            }
 
-        nraTheAllocator = &theAllocator;
-        
-        assert(nraTheAllocator->nraTotalSizeAlloc() == THE_ALLOCATOR_BASE_SIZE);
-        nraTheAllocator->nraMark(nraTheAllocatorMark);    
-    }
-    else
-    {
-        if (nraTheAllocator->nraGetMemoryManager() != pMemoryManager)
+            nraPool[i] = &thePooledAllocators[i];
+        }
+        else if (nraPool[i]->nraGetMemoryManager() != pMemoryManager)
         {
             // already initialize with a different memory manager
-            InterlockedExchange(&nraTheAllocatorIsInUse, 0);            
-            return NULL;
+            InterlockedExchange(&nraPoolIsInUse[i], 0);
+            continue;
         }
+
+        assert(nraPool[i]->nraTotalSizeAlloc() == THE_ALLOCATOR_BASE_SIZE);
+        return nraPool[i];
     }
 
-    assert(nraTheAllocator->nraTotalSizeAlloc() == THE_ALLOCATOR_BASE_SIZE);
-    return nraTheAllocator;
+    return NULL;
 }
 
 
-void                nraFreeTheAllocator()
+void                nraFreePooledAllocator(norls_allocator * pAlloc)
 {
-    assert (nraTheAllocator != NULL);
-    assert(nraTheAllocatorIsInUse == 1);
+    unsigned i = (unsigned)(pAlloc - thePooledAllocators);
+
+    assert(i < NRA_POOL_SIZE && nraPool[i] == pAlloc);
+    assert(nraPoolIsInUse[i] == 1);
 
-    nraTheAllocator->nraRlsm(nraTheAllocatorMark);
-    assert(nraTheAllocator->nraTotalSizeAlloc() == THE_ALLOCATOR_BASE_SIZE);
+    pAlloc->nraReset(NRA_POOL_SPARE_PAGES);
+    assert(pAlloc->nraTotalSizeAlloc() == THE_ALLOCATOR_BASE_SIZE);
 
-    InterlockedExchange(&nraTheAllocatorIsInUse, 0);
+    InterlockedExchange(&nraPoolIsInUse[i], 0);
 }
 
 /*****************************************************************************/
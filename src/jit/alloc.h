@@ -93,6 +93,17 @@ private:
 
     size_t          nraPageSize;
 
+    norls_pagdesc * nraSparePages;      // pages kept by nraReset() for reuse, linked through nrpNextPage
+
+    // Blocks handed back through nraRecycle(), bucketed by size class: bucket 'i' holds blocks
+    // of at least (1 << (i + NRA_MIN_RECYCLE_SHIFT)) bytes.
+    enum { NRA_MIN_RECYCLE_SHIFT = 3, NRA_MAX_RECYCLE_SHIFT = 12 };
+    enum { NRA_RECYCLE_BUCKETS = NRA_MAX_RECYCLE_SHIFT - NRA_MIN_RECYCLE_SHIFT + 1 };
+
+    void    *       nraRecycled[NRA_RECYCLE_BUCKETS];
+    unsigned        nraRecycledCount;   // # of blocks in all the buckets
+    size_t          nraRecycledSize;    // # of bytes handed out again by nraAllocRecycled()
+
 #ifdef DEBUG
     bool            nraShouldInjectFault; // Should we inject fault?
 #endif
@@ -111,8 +122,20 @@ public:
 
     void            nraFree (void);
 
+    void            nraReset(unsigned maxSparePages);
+
     void    *       nraAlloc(size_t sz);
 
+    /* The following used to reuse blocks whose owner (e.g. a jitstd container) has released them */
+
+    void    *       nraAllocRecycled(size_t sz);
+    void            nraRecycle(void * block, size_t sz);
+
+    size_t          nraTotalSizeRecycled()
+    {
+        return nraRecycledSize;
+    }
+
     /* The following used for mark/release operation */
 
     void            nraMark(nraMarkDsc &mark)
@@ -260,15 +283,15 @@ extern size_t THE_ALLOCATOR_BASE_SIZE;
 void                nraInitTheAllocator();  // One-time initialization
 void                nraTheAllocatorDone();  // One-time completion code
 
-// returns NULL if the single instance is already in use. 
+// returns NULL if all the pooled instances are in use.
 // User will need to allocate a new instance of the norls_allocator
 
-norls_allocator *   nraGetTheAllocator(IEEMemoryManager* pMemoryManager);
+norls_allocator *   nraGetPooledAllocator(IEEMemoryManager* pMemoryManager);
 
 // Should be called after we are done with the current use, so that the
-// next user can reuse it, instead of allocating a new instance
+// next user can reuse it (and its warmed pages), instead of allocating a new instance
 
-void                nraFreeTheAllocator();
+void                nraFreePooledAllocator(norls_allocator * pAlloc);
 
 
 /*****************************************************************************/
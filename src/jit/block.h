@@ -330,7 +330,7 @@ struct BasicBlock
 #define BBF_UNUSED1         0x00100000  // unused
 #define BBF_HAS_INDX        0x00200000  // BB contains simple index  expressions. TODO: This appears to be set, but never used.
 #define BBF_HAS_NEWARRAY    0x00400000  // BB contains 'new' of an array
-#define BBF_HAS_NEWOBJ      0x00800000  // BB contains 'new' of an object type. TODO: This appears to be set, but never used.
+#define BBF_HAS_NEWOBJ      0x00800000  // BB contains 'new' of an object type.
 
 #if FEATURE_EH_FUNCLETS && defined(_TARGET_ARM_)
 #define BBF_FINALLY_TARGET  0x01000000  // BB is the target of a finally return: where a finally will return during non-exceptional flow.
@@ -382,14 +382,15 @@ struct BasicBlock
 // Flags gained by the bottom block when a block is split.
 // Note, this is a conservative guess.
 // For example, the bottom block might or might not have BBF_HAS_NEWARRAY,
-// but we assume it has BBF_HAS_NEWARRAY.
+// but we assume it has BBF_HAS_NEWARRAY.  (optElideNewObjWriteBarriers
+// relies on BBF_HAS_NEWOBJ being set on every block that allocates.)
 
 // TODO: Should BBF_RUN_RARELY be added to BBF_SPLIT_GAINED ?
 
 #define BBF_SPLIT_GAINED   (BBF_DONT_REMOVE | BBF_HAS_LABEL |                    \
                             BBF_HAS_JMP     | BBF_BACKWARD_JUMP |                \
                             BBF_HAS_INDX    | BBF_HAS_NEWARRAY |                 \
-                            BBF_PROF_WEIGHT |                                    \
+                            BBF_HAS_NEWOBJ  | BBF_PROF_WEIGHT  |                 \
                             BBF_KEEP_BBJ_ALWAYS)
 
 #ifndef __GNUC__ // GCC doesn't like C_ASSERT at global scope
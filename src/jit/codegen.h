@@ -147,6 +147,9 @@ private:
 
 
     bool                genUseBlockInit;    // true if we plan to block-initialize the local stack frame 
+#if defined(_TARGET_AMD64_) && !defined(LEGACY_BACKEND)
+    bool                genUseBlockInitXmm; // true if the block initialization uses SSE2 stores rather than "rep stos"
+#endif // _TARGET_AMD64_ && !LEGACY_BACKEND
     unsigned            genInitStkLclCnt;   // The count of local variables that we need to zero init 
 
     //  Keeps track of how many bytes we've pushed on the processor's stack.
@@ -403,6 +406,7 @@ protected:
     // Save/Restore callee saved float regs to stack
     void                genPreserveCalleeSavedFltRegs(unsigned lclFrameSize);
     void                genRestoreCalleeSavedFltRegs(unsigned lclFrameSize);
+    void                genVzeroupperIfNeeded(bool check256bitOnly = true);
 
 #ifdef _TARGET_AMD64_
     // A set of information that is used by funclet prolog and epilog generation. It is collected once, before
@@ -433,6 +437,13 @@ protected:
                                              regNumber      initReg,
                                              bool *         pInitRegZeroed);
 
+#if defined(_TARGET_AMD64_) && !defined(LEGACY_BACKEND)
+    void                genZeroInitFrameUsingXmm (int       untrLclHi,
+                                                  int       untrLclLo,
+                                                  regNumber initReg,
+                                                  bool *    pInitRegZeroed);
+#endif // _TARGET_AMD64_ && !LEGACY_BACKEND
+
     void                genReportGenericContextArg (regNumber  initReg,
                                                     bool *     pInitRegZeroed);
 
@@ -3776,6 +3776,17 @@ void            CodeGen::genFnPrologCalleeRegArgs(regNumber xtraReg,
         }
 #endif // _TARGET_ARM_
 
+#ifdef FEATURE_UNIX_AMD64_STRUCT_PASSING
+        // A struct passed in two registers: the second eightbyte is in the next argument register.
+        if (varDsc->lvIsMultiRegArg)
+        {
+            slots = 2;
+            noway_assert(regArgNum + 1 < regState->rsCalleeRegArgNum);
+            regArgTab[regArgNum + 1].varNum = varNum;
+            regArgTab[regArgNum + 1].slot = 2;
+        }
+#endif // FEATURE_UNIX_AMD64_STRUCT_PASSING
+
         for (int i = 0; i < slots; i ++)
         {
             regNumber regNum = genMapRegArgNumToRegNum(regArgNum + i, regType);
@@ -4021,10 +4032,22 @@ void            CodeGen::genFnPrologCalleeRegArgs(regNumber xtraReg,
         {
             size = EA_SIZE(varDsc->lvSize());
 #if defined(_TARGET_AMD64_)
-            storeType = (var_types) ((size <= 4) ? TYP_INT : TYP_I_IMPL);
-            // Must be 1, 2, 4, or 8, or else it wouldn't be passed in a register
-            noway_assert(EA_SIZE_IN_BYTES(size) <= 8);
-            assert((EA_SIZE_IN_BYTES(size) & (EA_SIZE_IN_BYTES(size) - 1)) == 0);
+#ifdef FEATURE_UNIX_AMD64_STRUCT_PASSING
+            if (varDsc->lvIsMultiRegArg)
+            {
+                // Each eightbyte is stored from its own register, at (slot - 1) * 8. The local
+                // is rounded up to 16 bytes, so the second store can be a full eightbyte.
+                size = EA_8BYTE;
+                storeType = TYP_I_IMPL;
+            }
+            else
+#endif // FEATURE_UNIX_AMD64_STRUCT_PASSING
+            {
+                storeType = (var_types) ((size <= 4) ? TYP_INT : TYP_I_IMPL);
+                // Must be 1, 2, 4, or 8, or else it wouldn't be passed in a register
+                noway_assert(EA_SIZE_IN_BYTES(size) <= 8);
+                assert((EA_SIZE_IN_BYTES(size) & (EA_SIZE_IN_BYTES(size) - 1)) == 0);
+            }
 #elif defined(_TARGET_ARM64_)
             // Must be <= 16 bytes or else it wouldn't be passed in registers
             noway_assert(EA_SIZE_IN_BYTES(size) <= 16);
@@ -4832,6 +4855,29 @@ void CodeGen::genCheckUseBlockInit()
 
     genUseBlockInit = (genInitStkLclCnt > (largeGcStructs + 4)); 
 
+#if defined(_TARGET_AMD64_) && !defined(LEGACY_BACKEND)
+    /* Small blocks are zeroed with SSE2 stores, which need none of the registers used by
+       "rep stos". The frame offsets are not final yet, so the size of the block is bounded
+       by the size of all the locals and temps on the frame. */
+
+    genUseBlockInitXmm = false;
+
+    if  (genUseBlockInit)
+    {
+        unsigned frameLclSize = compiler->tmpSize;
+
+        for (varNum = 0, varDsc = compiler->lvaTable;
+             varNum < compiler->lvaCount;
+             varNum++  , varDsc++)
+        {
+            if  (varDsc->lvOnFrame && !varDsc->lvIsParam)
+                frameLclSize += (unsigned)roundUp(compiler->lvaLclSize(varNum));
+        }
+
+        genUseBlockInitXmm = (frameLclSize <= INITBLK_UNROLL_LIMIT);
+    }
+#endif // _TARGET_AMD64_ && !LEGACY_BACKEND
+
     if  (genUseBlockInit)
     {
         regMaskTP maskCalleeRegArgMask = intRegState.rsCalleeRegArgMaskLiveIn;
@@ -4844,35 +4890,40 @@ void CodeGen::genCheckUseBlockInit()
         }
 
 #ifdef _TARGET_XARCH_
-        // If we're going to use "REP STOS", remember that we will trash EDI
-        // For fastcall we will have to save ECX, EAX
-        // so reserve two extra callee saved
-        // This is better than pushing eax, ecx, because we in the later
-        // we will mess up already computed offsets on the stack (for ESP frames)
-        regSet.rsSetRegsModified(RBM_EDI);
-
-        // For register arguments we may have to save ECX (and RDI on Amd64 System V OSes.)
-        // In such case use R12 and R13 registers.
+#if defined(_TARGET_AMD64_) && !defined(LEGACY_BACKEND)
+        if (!genUseBlockInitXmm)
+#endif // _TARGET_AMD64_ && !LEGACY_BACKEND
+        {
+            // If we're going to use "REP STOS", remember that we will trash EDI
+            // For fastcall we will have to save ECX, EAX
+            // so reserve two extra callee saved
+            // This is better than pushing eax, ecx, because we in the later
+            // we will mess up already computed offsets on the stack (for ESP frames)
+            regSet.rsSetRegsModified(RBM_EDI);
+
+            // For register arguments we may have to save ECX (and RDI on Amd64 System V OSes.)
+            // In such case use R12 and R13 registers.
 #ifdef UNIX_AMD64_ABI
-        if (maskCalleeRegArgMask & RBM_RCX)
-        {
-            regSet.rsSetRegsModified(RBM_R12);
-        }
+            if (maskCalleeRegArgMask & RBM_RCX)
+            {
+                regSet.rsSetRegsModified(RBM_R12);
+            }
 
-        if (maskCalleeRegArgMask & RBM_RDI)
-        {
-            regSet.rsSetRegsModified(RBM_R13);
-        }
+            if (maskCalleeRegArgMask & RBM_RDI)
+            {
+                regSet.rsSetRegsModified(RBM_R13);
+            }
 #else // !UNIX_AMD64_ABI
-        if (maskCalleeRegArgMask & RBM_ECX)
-        {
-            regSet.rsSetRegsModified(RBM_ESI);
-        }
+            if (maskCalleeRegArgMask & RBM_ECX)
+            {
+                regSet.rsSetRegsModified(RBM_ESI);
+            }
 #endif // !UNIX_AMD64_ABI
 
-        if (maskCalleeRegArgMask & RBM_EAX)
-        {
-            regSet.rsSetRegsModified(RBM_EBX);
+            if (maskCalleeRegArgMask & RBM_EAX)
+            {
+                regSet.rsSetRegsModified(RBM_EBX);
+            }
         }
 
 #endif // _TARGET_XARCH_
@@ -6290,6 +6341,16 @@ void        CodeGen::genZeroInitFrame(int        untrLclHi,
         noway_assert(uCntBytes == 0);
 
 #elif defined(_TARGET_XARCH_)
+#if defined(_TARGET_AMD64_) && !defined(LEGACY_BACKEND)
+        // For small blocks the startup cost of "rep stosd" dominates, so use SSE2 stores instead.
+        // This was decided by genCheckUseBlockInit, which then did not reserve EDI, ECX and EAX.
+        if (genUseBlockInitXmm)
+        {
+            genZeroInitFrameUsingXmm(untrLclHi, untrLclLo, initReg, pInitRegZeroed);
+            return;
+        }
+#endif // _TARGET_AMD64_ && !LEGACY_BACKEND
+
         /*
             Generate the following code:
 
@@ -6469,6 +6530,82 @@ void        CodeGen::genZeroInitFrame(int        untrLclHi,
 }
 
 
+#if defined(_TARGET_AMD64_) && !defined(LEGACY_BACKEND)
+/*-----------------------------------------------------------------------------
+ *
+ * Zero the frame block between untrLclLo and untrLclHi with unrolled 16-byte SSE2 stores.
+ * The stack pointer is 16-byte aligned once the frame is allocated, so any leading 4 and 8
+ * byte parts are zeroed with integer stores first to keep the SSE2 stores aligned.
+ *
+ * untrLclHi      - The upper bound offset at which the zero init code will end initializing memory (not inclusive).
+ * untrLclLo      - The lower bound at which the zero init code will start zero initializing memory.
+ * initReg        - A scratch register that gets zeroed if an integer store is needed.
+ * pInitRegZeroed - Sets a flag that tells the callee whether or not the initReg register got zeroed.
+ */
+void        CodeGen::genZeroInitFrameUsingXmm(int        untrLclHi,
+                                              int        untrLclLo,
+                                              regNumber  initReg,
+                                              bool *     pInitRegZeroed)
+{
+    assert(compiler->compGeneratingProlog);
+    assert(untrLclHi > untrLclLo);
+
+    emitter *  emit     = getEmitter();
+    regNumber  baseReg  = genFramePointerReg();
+    int        offset   = untrLclLo;
+    unsigned   size     = untrLclHi - untrLclLo;
+    int        spOffset = isFramePointerUsed() ? (untrLclLo + genSPtoFPdelta()) : untrLclLo;
+
+    assert((size % sizeof(int)) == 0);  // The smallest stack slot is always 4 bytes.
+
+    if (((spOffset & sizeof(int)) != 0) && (size >= sizeof(int)))
+    {
+        emit->emitIns_AR_R(ins_Store(TYP_INT), EA_4BYTE, genGetZeroReg(initReg, pInitRegZeroed), baseReg, offset);
+        offset   += sizeof(int);
+        spOffset += sizeof(int);
+        size     -= sizeof(int);
+    }
+
+    if (((spOffset & REGSIZE_BYTES) != 0) && (size >= REGSIZE_BYTES))
+    {
+        emit->emitIns_AR_R(ins_Store(TYP_I_IMPL), EA_PTRSIZE, genGetZeroReg(initReg, pInitRegZeroed), baseReg, offset);
+        offset   += REGSIZE_BYTES;
+        size     -= REGSIZE_BYTES;
+    }
+
+    if (size >= XMM_REGSIZE_BYTES)
+    {
+        // The float argument registers are still live, so use a volatile register that is not one of them.
+        regNumber xmmReg = genRegNumFromMask(genFindLowestBit(RBM_FLT_CALLEE_TRASH & ~RBM_FLTARG_REGS));
+
+        emit->emitIns_R_R(INS_xorpd, EA_8BYTE, xmmReg, xmmReg);
+
+        while (size >= XMM_REGSIZE_BYTES)
+        {
+            emit->emitIns_AR_R(INS_movdqu, EA_8BYTE, xmmReg, baseReg, offset);
+            offset += XMM_REGSIZE_BYTES;
+            size   -= XMM_REGSIZE_BYTES;
+        }
+    }
+
+    if (size >= REGSIZE_BYTES)
+    {
+        emit->emitIns_AR_R(ins_Store(TYP_I_IMPL), EA_PTRSIZE, genGetZeroReg(initReg, pInitRegZeroed), baseReg, offset);
+        offset += REGSIZE_BYTES;
+        size   -= REGSIZE_BYTES;
+    }
+
+    if (size >= sizeof(int))
+    {
+        emit->emitIns_AR_R(ins_Store(TYP_INT), EA_4BYTE, genGetZeroReg(initReg, pInitRegZeroed), baseReg, offset);
+        size -= sizeof(int);
+    }
+
+    noway_assert(size == 0);
+}
+#endif // _TARGET_AMD64_ && !LEGACY_BACKEND
+
+
 /*-----------------------------------------------------------------------------
  *
  *  Save the generic context argument.
@@ -10651,6 +10788,36 @@ GenTreePtr          CodeGen::genMakeConst(const void *    cnsAddr,
 }
 
 #if defined(_TARGET_XARCH_) && !FEATURE_STACK_FP_X87
+//-----------------------------------------------------------------------------
+// genVzeroupperIfNeeded: Generate a vzeroupper in a prolog or an epilog, which zeroes
+// the upper 128 bits of all YMM registers. This avoids the AVX to SSE transition penalty
+// between this method and SSE code that calls it or that it returns to.
+//
+// Arguments:
+//    check256bitOnly - true if the vzeroupper is needed only when the method contains
+//                      256-bit AVX instructions, false if it is needed whenever AVX is used.
+//
+void                CodeGen::genVzeroupperIfNeeded(bool check256bitOnly /* = true */)
+{
+#ifdef FEATURE_AVX_SUPPORT
+    bool emitVzeroUpper;
+
+    if (check256bitOnly)
+    {
+        emitVzeroUpper = getEmitter()->Contains256bitAVX();
+    }
+    else
+    {
+        emitVzeroUpper = (compiler->getFloatingPointInstructionSet() == InstructionSet_AVX);
+    }
+
+    if (emitVzeroUpper)
+    {
+        instGen(INS_vzeroupper);
+    }
+#endif // FEATURE_AVX_SUPPORT
+}
+
 // Save compCalleeFPRegsPushed with the smallest register number saved at [RSP+offset], working
 // down the stack to the largest register number stored at [RSP+offset-(genCountBits(regMask)-1)*XMM_REG_SIZE]
 // Here offset = 16-byte aligned offset after pushing integer registers.
@@ -10668,7 +10835,10 @@ void                CodeGen::genPreserveCalleeSavedFltRegs(unsigned lclFrameSize
 
     // fast path return
     if (regMask == RBM_NONE) 
+    {
+        genVzeroupperIfNeeded();
         return;
+    }
 
 #ifdef _TARGET_AMD64_
     unsigned firstFPRegPadding = compiler->lvaIsCalleeSavedIntRegCountEven() ? REGSIZE_BYTES : 0;
@@ -10699,15 +10869,10 @@ void                CodeGen::genPreserveCalleeSavedFltRegs(unsigned lclFrameSize
         }
     }
 
-#ifdef FEATURE_AVX_SUPPORT
     // Just before restoring float registers issue a Vzeroupper to zero out upper 128-bits of all YMM regs.
     // This is to avoid penalty if this routine is using AVX-256 and now returning to a routine that is 
     // using SSE2.
-    if (compiler->getFloatingPointInstructionSet() == InstructionSet_AVX)
-    {
-        instGen(INS_vzeroupper);
-    }
-#endif
+    genVzeroupperIfNeeded(false);
 }
 
 // Save/Restore compCalleeFPRegsPushed with the smallest register number saved at [RSP+offset], working
@@ -10727,7 +10892,10 @@ void                CodeGen::genRestoreCalleeSavedFltRegs(unsigned lclFrameSize)
 
     // fast path return
     if (regMask == RBM_NONE) 
+    {
+        genVzeroupperIfNeeded();
         return;
+    }
 
 #ifdef _TARGET_AMD64_
     unsigned firstFPRegPadding = compiler->lvaIsCalleeSavedIntRegCountEven() ? REGSIZE_BYTES : 0;
@@ -10757,15 +10925,10 @@ void                CodeGen::genRestoreCalleeSavedFltRegs(unsigned lclFrameSize)
     assert((offset % 16) == 0);
 #endif // _TARGET_AMD64_
 
-#ifdef FEATURE_AVX_SUPPORT
     // Just before restoring float registers issue a Vzeroupper to zero out upper 128-bits of all YMM regs.
     // This is to avoid penalty if this routine is using AVX-256 and now returning to a routine that is 
     // using SSE2.
-    if (compiler->getFloatingPointInstructionSet() == InstructionSet_AVX)
-    {
-        instGen(INS_vzeroupper);
-    }
-#endif
+    genVzeroupperIfNeeded(false);
 
     for (regNumber reg = REG_FLT_CALLEE_SAVED_FIRST; regMask != RBM_NONE; reg = REG_NEXT(reg))
     {
@@ -3238,7 +3238,8 @@ void CodeGen::genCodeForInitBlkRepStos(GenTreeInitBlk* initBlkNode)
 // Generate code for InitBlk by performing a loop unroll
 // Preconditions:  
 //   a) Both the size and fill byte value are integer constants.
-//   b) The size of the struct to initialize is smaller than INITBLK_UNROLL_LIMIT bytes.
+//   b) The size of the struct to initialize is smaller than INITBLK_UNROLL_LIMIT bytes,
+//      or INITBLK_AVX_UNROLL_LIMIT bytes for a zero fill with AVX.
 //
 void CodeGen::genCodeForInitBlkUnroll(GenTreeInitBlk* initBlkNode)
 {
@@ -3257,8 +3258,8 @@ void CodeGen::genCodeForInitBlkUnroll(GenTreeInitBlk* initBlkNode)
 
     size_t size = blockSize->gtIntCon.gtIconVal;
 
-    assert(size <= INITBLK_UNROLL_LIMIT);
     assert(initVal->gtSkipReloadOrCopy()->IsCnsIntOrI());
+    assert(size <= compiler->getInitBlkUnrollLimit(initVal->gtSkipReloadOrCopy()->gtIntCon.gtIconVal == 0));
 
     emitter *emit = getEmitter();
 
@@ -3291,10 +3292,25 @@ void CodeGen::genCodeForInitBlkUnroll(GenTreeInitBlk* initBlkNode)
         else
         {
             emit->emitIns_R_R(INS_xorpd, EA_8BYTE, tmpReg, tmpReg);
+
+#ifdef FEATURE_AVX_SUPPORT
+            // The VEX encoded xorpd above also cleared the upper half of the YMM register,
+            // so zero fills can be done 32 bytes at a time.
+            if (compiler->canUseAVX())
+            {
+                size_t ymmSlots = size / YMM_REGSIZE_BYTES;
+
+                while (ymmSlots-- > 0)
+                {
+                    emit->emitIns_AR_R(INS_movdqu, EA_32BYTE, tmpReg, dstAddr->gtRegNum, offset);
+                    offset += YMM_REGSIZE_BYTES;
+                }
+            }
+#endif // FEATURE_AVX_SUPPORT
         }
 
         // Determine how many 16 byte slots we're going to fill using SSE movs.
-        size_t slots = size / XMM_REGSIZE_BYTES;
+        size_t slots = (size - offset) / XMM_REGSIZE_BYTES;
 
         while (slots-- > 0)
         {
@@ -3406,7 +3422,7 @@ void CodeGen::genCodeForStoreOffset(instruction ins, emitAttr size, regNumber sr
 
 // Generates CpBlk code by performing a loop unroll
 // Preconditions:
-//  The size argument of the CpBlk node is a constant and <= 64 bytes.
+//  The size argument of the CpBlk node is a constant and <= 64 bytes (128 bytes with AVX).
 //  This may seem small but covers >95% of the cases in several framework assemblies.
 //
 void CodeGen::genCodeForCpBlkUnroll(GenTreeCpBlk* cpBlkNode)
@@ -3418,7 +3434,7 @@ void CodeGen::genCodeForCpBlkUnroll(GenTreeCpBlk* cpBlkNode)
 
     assert(blockSize->IsCnsIntOrI());
     size_t size = blockSize->gtIntCon.gtIconVal;
-    assert(size <= CPBLK_UNROLL_LIMIT);
+    assert(size <= compiler->getCpBlkUnrollLimit());
 
     emitter *emit = getEmitter();
 
@@ -3439,7 +3455,23 @@ void CodeGen::genCodeForCpBlkUnroll(GenTreeCpBlk* cpBlkNode)
         assert(cpBlkNode->gtRsvdRegs != RBM_NONE);
         regNumber xmmReg = genRegNumFromMask(cpBlkNode->gtRsvdRegs & RBM_ALLFLOAT);
         assert(genIsValidFloatReg(xmmReg));
-        size_t slots = size / XMM_REGSIZE_BYTES;
+
+#ifdef FEATURE_AVX_SUPPORT
+        // With AVX, copy 32 bytes at a time through the YMM register first.
+        if (compiler->canUseAVX())
+        {
+            size_t ymmSlots = size / YMM_REGSIZE_BYTES;
+
+            while (ymmSlots-- > 0)
+            {
+                genCodeForLoadOffset(INS_movdqu, EA_32BYTE, xmmReg, srcAddr, offset);
+                genCodeForStoreOffset(INS_movdqu, EA_32BYTE, xmmReg, dstAddr, offset);
+                offset += YMM_REGSIZE_BYTES;
+            }
+        }
+#endif // FEATURE_AVX_SUPPORT
+
+        size_t slots = (size - offset) / XMM_REGSIZE_BYTES;
 
         while (slots-- > 0)
         {
@@ -442,9 +442,8 @@ void                Compiler::compStartup()
     totalNCsize = 0;
 #endif // DISPLAY_SIZES
 
-    /* Initialize the single instance of the norls_allocator (with a page
-     * preallocated) which we try to reuse for all non-simulataneous
-     * uses (which is always, for the standalone)
+    /* Initialize the pool of norls_allocator instances (each with a page
+     * preallocated on first use) which we try to reuse for all compilations
      */
 
     nraInitTheAllocator();
@@ -487,6 +486,10 @@ void                Compiler::compShutdown()
 
     nraTheAllocatorDone();
 
+#ifdef DEBUG
+    InlinePolicy::CloseLog();
+#endif // DEBUG
+
     /* Shut down the emitter */
 
     emitter::emitDone();
@@ -1114,6 +1117,13 @@ void                Compiler::compInit(norls_allocator * pAlloc, InlineInfo * in
         //
 
         optLoopsCloned = 0;
+        optRangeChecksRemoved = 0;
+        optWriteBarriersElided = 0;
+        optNoBarrierStores = nullptr;
+#ifndef LEGACY_BACKEND
+        lsraSpillCount = 0;
+        lsraResolutionMoveCount = 0;
+#endif // !LEGACY_BACKEND
 
 #if MEASURE_MEM_ALLOC
         genMemStats.Init();
@@ -1175,6 +1185,7 @@ void                Compiler::compInit(norls_allocator * pAlloc, InlineInfo * in
 
     compNativeSizeEstimate = NATIVE_SIZE_INVALID;
     compInlineeHints = (InlInlineHints)0;
+    compInlineeFoldableBranches = 0;
 
     compInlineResult = JitInlineResult(INLINE_PASS, nullptr, nullptr, nullptr);
 
@@ -3179,6 +3190,13 @@ void                 Compiler::compCompile(void * * methodCodePtr,
         optCloneLoops();
         EndPhase(PHASE_CLONE_LOOPS);
 
+#ifdef FEATURE_SIMD
+        // Rewrite simple array loops (now free of bounds checks on the
+        // fast path) into SIMD loops with a scalar epilogue.
+        optVectorizeLoops();
+        EndPhase(PHASE_VECTORIZE_LOOPS);
+#endif // FEATURE_SIMD
+
         /* Unroll loops */
         optUnrollLoops();
         EndPhase(PHASE_UNROLL_LOOPS);
@@ -3307,6 +3325,13 @@ void                 Compiler::compCompile(void * * methodCodePtr,
         }
 #endif // ASSERTION_PROP
 
+        if (doValueNum)
+        {
+            /* Remove the write barriers of stores into newly allocated objects */
+            optElideNewObjWriteBarriers();
+            EndPhase(PHASE_ELIDE_WRITE_BARRIERS);
+        }
+
         /* update the flowgraph if we modified it during the optimization phase*/
         if  (fgModified)
         {
@@ -3799,8 +3824,9 @@ void Compiler::compCompileFinish()
 
 #if MEASURE_MEM_ALLOC
     ClrEnterCriticalSection(s_memStatsLock.Val());
-    genMemStats.nraTotalSizeAlloc = compGetAllocator()->nraTotalSizeAlloc();
-    genMemStats.nraTotalSizeUsed  = compGetAllocator()->nraTotalSizeUsed ();
+    genMemStats.nraTotalSizeAlloc    = compGetAllocator()->nraTotalSizeAlloc();
+    genMemStats.nraTotalSizeUsed     = compGetAllocator()->nraTotalSizeUsed ();
+    genMemStats.nraTotalSizeRecycled = compGetAllocator()->nraTotalSizeRecycled();
     s_aggMemStats.Add(genMemStats);
     if (genMemStats.allocSz > s_maxCompMemStats.allocSz)
     {
@@ -4282,16 +4308,22 @@ int           Compiler::compCompileHelper (CORINFO_MODULE_HANDLE            clas
             // We must have run the CodeSeq state machine and got the native size estimate.
             assert(compNativeSizeEstimate != NATIVE_SIZE_INVALID); 
 
-            int callsiteNativeSizeEstimate = impEstimateCallsiteNativeSize(methodInfo);          
-            
-            JitInlineResult result = impCanInlineNative(callsiteNativeSizeEstimate, 
-                                                        compNativeSizeEstimate,
-                                                        compInlineeHints,
-                                                        NULL); // Calculate static inlining hint.
+            // Calculate the static inlining hint: there is no call site to observe.
+            InlineObservations obs;
+            memset(&obs, 0, sizeof(obs));
+            obs.ilCodeSize                 = methodInfo->ILCodeSize;
+            obs.instrCount                 = opts.instrCount;
+            obs.calleeNativeSizeEstimate   = compNativeSizeEstimate;
+            obs.callsiteNativeSizeEstimate = impEstimateCallsiteNativeSize(methodInfo);
+            obs.hints                      = compInlineeHints;
+            obs.argCount                   = info.compArgsCount;
+            obs.hasCallSite                = false;
+
+            JitInlineResult result = InlinePolicy::GetPolicy()->DetermineProfitability(this, obs);
 
             if (dontInline(result))
             {
-                // Bingo! It is a bad inlinee according to impCanInlineNative. Mark it in the EE.
+                // Bingo! It is a bad inlinee according to the inline policy. Mark it in the EE.
                 assert(result.result() == INLINE_NEVER);
                 info.compCompHnd->setMethodAttribs(methodHnd, CORINFO_FLG_BAD_INLINEE);
             }
@@ -4873,8 +4905,8 @@ START:
     {
         IEEMemoryManager* pMemoryManager = compHnd->getMemoryManager();
 
-        // Try to reuse the pre-inited allocator ?
-        pAlloc = nraGetTheAllocator(pMemoryManager);
+        // Try to reuse one of the pre-inited allocators ?
+        pAlloc = nraGetPooledAllocator(pMemoryManager);
 
         if (!pAlloc)
         {
@@ -4992,7 +5024,7 @@ START:
                 // Now free up whichever allocator we were using
                 if (pParamOuter->pAlloc != pParamOuter->alloc)
                 {
-                    nraFreeTheAllocator();
+                    nraFreePooledAllocator(pParamOuter->pAlloc);
                 }
                 else
                 {
@@ -5835,6 +5867,11 @@ void JitTimer::PrintCsvHeader()
         fprintf(fp, "\"Basic Blocks\",");
         fprintf(fp, "\"Opt Level\",");
         fprintf(fp, "\"Loops Cloned\",");
+        fprintf(fp, "\"Barriers Elided\",");
+        fprintf(fp, "\"Bounds Checks Removed\",");
+        fprintf(fp, "\"Code Bytes\",");
+        fprintf(fp, "\"Spills\",");
+        fprintf(fp, "\"Resolution Moves\",");
 
         for (int i = 0; i < PHASE_NUMBER_OF; i++)
         {
@@ -5866,6 +5903,15 @@ void JitTimer::PrintCsvMethodStats(Compiler* comp)
     fprintf(fp, "%u,", comp->fgBBcount);
     fprintf(fp, "%u,", comp->opts.MinOpts());
     fprintf(fp, "%u,", comp->optLoopsCloned);
+    fprintf(fp, "%u,", comp->optWriteBarriersElided);
+    fprintf(fp, "%u,", comp->optRangeChecksRemoved);
+    fprintf(fp, "%u,", comp->info.compNativeCodeSize);
+#ifndef LEGACY_BACKEND
+    fprintf(fp, "%u,", comp->lsraSpillCount);
+    fprintf(fp, "%u,", comp->lsraResolutionMoveCount);
+#else // LEGACY_BACKEND
+    fprintf(fp, "0,0,");
+#endif // LEGACY_BACKEND
     unsigned __int64 totCycles = 0;
     for (int i = 0; i < PHASE_NUMBER_OF; i++)
     {
@@ -5917,8 +5963,8 @@ void Compiler::MemStats::Print(FILE* f)
 {
     fprintf(f, "count: %10u, size: %10llu, max = %10llu\n",
         allocCnt, allocSz, allocSzMax);
-    fprintf(f, "nraAlloc: %10llu, nraUsed: %10llu\n",
-        nraTotalSizeAlloc, nraTotalSizeUsed);
+    fprintf(f, "nraAlloc: %10llu, nraUsed: %10llu, nraRecycled: %10llu\n",
+        nraTotalSizeAlloc, nraTotalSizeUsed, nraTotalSizeRecycled);
     PrintByKind(f);
 }
 
@@ -5949,6 +5995,8 @@ void Compiler::AggregateMemStats::Print(FILE* f)
             nraTotalSizeAlloc, nraTotalSizeAlloc / nMethods);
     fprintf(f, "  nraUsed    : %12llu (avg %7u per method)\n",
             nraTotalSizeUsed, nraTotalSizeUsed / nMethods);
+    fprintf(f, "  nraRecycled: %12llu (avg %7u per method)\n",
+            nraTotalSizeRecycled, nraTotalSizeRecycled / nMethods);
     PrintByKind(f);
 }
 #endif // MEASURE_MEM_ALLOC
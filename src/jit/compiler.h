@@ -194,6 +194,9 @@ public:
 
     unsigned char       lvIsParam   :1; // is this a parameter?
     unsigned char       lvIsRegArg  :1; // is this a register argument?
+#ifdef FEATURE_UNIX_AMD64_STRUCT_PASSING
+    unsigned char       lvIsMultiRegArg :1; // is this a struct argument passed in two registers (or two stack slots)?
+#endif // FEATURE_UNIX_AMD64_STRUCT_PASSING
     unsigned char       lvFramePointerBased :1; // 0 = off of REG_SPBASE (e.g., ESP), 1 = off of REG_FPBASE (e.g., EBP)
 
     unsigned char       lvStructGcCount :3; // if struct, how many GC pointer (stop counting at 7). The only use of values >1 is to help determine whether to use block init in the prolog.
@@ -315,6 +318,9 @@ private:
     regNumberSmall      _lvOtherReg;    // Used for "upper half" of long var.
 #endif // !defined(_TARGET_64BIT_)
     regNumberSmall      _lvArgReg;      // The register in which this argument is passed.
+#ifdef FEATURE_UNIX_AMD64_STRUCT_PASSING
+    regNumberSmall      _lvOtherArgReg; // The register in which the second eightbyte of a multi-reg struct argument is passed.
+#endif // FEATURE_UNIX_AMD64_STRUCT_PASSING
 #ifndef LEGACY_BACKEND
     union
     {
@@ -392,6 +398,23 @@ public:
         assert(_lvArgReg == reg);
     }
 
+#ifdef FEATURE_UNIX_AMD64_STRUCT_PASSING
+    __declspec(property(get=GetOtherArgReg,put=SetOtherArgReg))
+    regNumber           lvOtherArgReg;
+
+    regNumber GetOtherArgReg() const
+    {
+        assert(lvIsMultiRegArg);
+        return (regNumber) _lvOtherArgReg;
+    }
+
+    void SetOtherArgReg(regNumber reg)
+    {
+        _lvOtherArgReg = (regNumberSmall) reg;
+        assert(_lvOtherArgReg == reg);
+    }
+#endif // FEATURE_UNIX_AMD64_STRUCT_PASSING
+
 #ifdef FEATURE_SIMD
     // Is this is a SIMD struct?
     bool lvIsSIMDType() const
@@ -989,6 +1012,8 @@ public:
     }
 };
 
+#include "inlinepolicy.h"
+
 #ifdef FEATURE_JIT_METHOD_PERF
 
 // This class summarizes the JIT time information over the course of a run: the number of methods compiled,
@@ -1312,6 +1337,10 @@ public:
 
     // For the compiler's no-release allocator, free operations are no-ops.
     void   Free(void * p) {}
+
+    // ...except when the size is known: the block is then recycled by later allocations
+    // from the same compilation (see norls_allocator::nraRecycle).
+    inline void FreeSized(void * p, size_t sz);
 };
 
 /*
@@ -1360,6 +1389,10 @@ class   Compiler
     friend class CodeGen;
     friend class LclVarDsc;
     friend class TempDsc;
+    friend class InlinePolicy;
+    friend class LegacyInlinePolicy;
+    friend class ProfitabilityInlinePolicy;
+    friend class ReplayInlinePolicy;
 
 /*
 XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
@@ -3330,9 +3363,7 @@ public :
                                             //   and we are trying to compile again in a "safer", minopts mode?
 #endif
 
-#if defined(DEBUG)
-    unsigned            impInlinedCodeSize;
-#endif
+    unsigned            impInlinedCodeSize; // IL bytes inlined so far into this (root) method
 
     //-------------------------------------------------------------------------
 
@@ -4436,6 +4467,9 @@ private:
     GenTreePtr          fgUnwrapProxy       (GenTreePtr     objRef);
     GenTreeCall*        fgMorphArgs         (GenTreeCall*   call);
     void                fgMakeOutgoingStructArgCopy(GenTreeCall* call, GenTree* args, unsigned argIndex, CORINFO_CLASS_HANDLE copyBlkClass);
+#ifdef FEATURE_UNIX_AMD64_STRUCT_PASSING
+    void                fgSplitRegPassedStructArgs(GenTreeCall* call);
+#endif // FEATURE_UNIX_AMD64_STRUCT_PASSING
     void                fgFixupStructReturn (GenTreePtr     call);
     GenTreePtr          fgMorphLocalVar     (GenTreePtr     tree);
     bool                fgAddrCouldBeNull   (GenTreePtr     addr);
@@ -4766,6 +4800,26 @@ private:
 #ifdef DEBUG
     void                optOptimizeBoolsGcStress(BasicBlock * condBlock);
 #endif
+public:
+    // Find the stores of object references into objects allocated earlier in the same block,
+    // with no GC safe point in between, which need no write barrier.
+    void                optElideNewObjWriteBarriers();
+
+    // Returns true if "store" (the GT_IND target of an assignment, or a GT_STOREIND) was found
+    // by optElideNewObjWriteBarriers.
+    bool                optIsNoBarrierStore(GenTreePtr store);
+
+    // Called when "newStore" replaces "oldStore" in the IR.
+    void                optReplaceNoBarrierStore(GenTreePtr oldStore, GenTreePtr newStore);
+
+    unsigned            optWriteBarriersElided;     // number of write barriers elided in the current method.
+
+private:
+    ValueNum            optNewObjValueNum(GenTreeCall* call, unsigned* pObjSize);
+
+    typedef SimplerHashTable<GenTreePtr, PtrKeyFuncs<GenTree>, bool, DefaultSimplerHashBehavior> NodeSet;
+    NodeSet*            optNoBarrierStores;         // stores found by optElideNewObjWriteBarriers, if any
+
 public :
 
     void                optOptimizeLayout();    // Optimize the BasicBlock layout of the method
@@ -4785,6 +4839,20 @@ public :
     // and redirects the preds of the entry to this new block.)  Sets the weight of the newly created block to "ambientWeight".
     void                optEnsureUniqueHead(unsigned loopInd, unsigned ambientWeight);
 
+#ifdef FEATURE_SIMD
+    // Optionally rewrite simple counted loops over primitive arrays into SIMD loops with a scalar epilogue.
+    void                optVectorizeLoops();
+
+    // Vectorize loop "loopNum" if possible; otherwise set "*pReason" and return false.
+    bool                optVectorizeLoop(unsigned loopNum, var_types* pBaseType, const char** pReason);
+
+    void                optVectorizeAddStmt(BasicBlock* block, GenTreePtr tree);
+
+    bool                optIsVectorizableArrElem(GenTreePtr tree, unsigned loopNum, unsigned ivLclNum, unsigned* pArrLclNum);
+
+    GenTreePtr          optVectorizeTree(GenTreePtr tree, unsigned loopNum, unsigned ivLclNum, var_types baseType, unsigned simdSize);
+#endif // FEATURE_SIMD
+
     void                optUnrollLoops  ();    // Unrolls loops (needs to have cost info)
 
 protected :
@@ -4979,6 +5047,7 @@ protected :
     unsigned            optIndirectCallCount;       // number of virtual, interface and indirect calls made in the method
     unsigned            optNativeCallCount;         // number of Pinvoke/Native calls made in the method
     unsigned            optLoopsCloned;             // number of loops cloned in the current method.
+    unsigned            optRangeChecksRemoved;      // number of array bounds checks removed in the current method.
 
 #ifdef DEBUG
     unsigned            optFindLoopNumberFromBeginBlock(BasicBlock *begBlk);
@@ -5652,6 +5721,7 @@ public :
     };
 
     bool                optIsStackLocalInvariant(unsigned loopNum, unsigned lclNum);
+    bool                optIsIterVarIndex(unsigned loopNum, GenTreePtr stmt, unsigned lclNum, int* pOffset);
     bool                optExtractArrIndex(GenTreePtr tree, ArrIndex* result, unsigned lhsNum);
     bool                optReconstructArrIndex(GenTreePtr tree, ArrIndex* result, unsigned lhsNum);
     bool                optIdentifyLoopOptInfo(unsigned loopNum, LoopCloneContext* context);
@@ -5778,6 +5848,11 @@ protected:
 public:
     regMaskTP              raConfigRestrictMaskFP();
 
+#ifndef LEGACY_BACKEND
+    unsigned               lsraSpillCount;                // number of spills and reloads marked by LSRA in the current method
+    unsigned               lsraResolutionMoveCount;       // number of moves inserted by LSRA resolution in the current method
+#endif // !LEGACY_BACKEND
+
 private:
 #ifndef LEGACY_BACKEND
     LinearScanInterface*  m_pLinearScan;                // Linear Scan allocator
@@ -6142,6 +6217,9 @@ public :
     var_types                   eeGetArgType        (CORINFO_ARG_LIST_HANDLE list, CORINFO_SIG_INFO* sig);
     var_types                   eeGetArgType        (CORINFO_ARG_LIST_HANDLE list, CORINFO_SIG_INFO* sig, bool* isPinned);
     unsigned                    eeGetArgSize        (CORINFO_ARG_LIST_HANDLE list, CORINFO_SIG_INFO* sig);
+#ifdef FEATURE_UNIX_AMD64_STRUCT_PASSING
+    bool                        eeIsRegPassedStruct (CORINFO_CLASS_HANDLE clsHnd, unsigned* pHiSize = nullptr);
+#endif // FEATURE_UNIX_AMD64_STRUCT_PASSING
 
     // VOM info, method sigs
 
@@ -7018,6 +7096,34 @@ XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 #endif
     }
 
+#if defined(_TARGET_XARCH_) && !defined(LEGACY_BACKEND)
+    // Upper bounds on the constant size of the InitBlk and CpBlk nodes that codegen unrolls.
+    // With AVX the unrolled sequences use 32-byte moves, so they can cover twice as many bytes.
+    // InitBlk only does this for a zero fill value, which is the only one that does not
+    // need a broadcast to fill a YMM register.
+    unsigned                getInitBlkUnrollLimit(bool isZeroFill) const
+    {
+#ifdef FEATURE_AVX_SUPPORT
+        if (isZeroFill && canUseAVX())
+        {
+            return INITBLK_AVX_UNROLL_LIMIT;
+        }
+#endif
+        return INITBLK_UNROLL_LIMIT;
+    }
+
+    unsigned                getCpBlkUnrollLimit() const
+    {
+#ifdef FEATURE_AVX_SUPPORT
+        if (canUseAVX())
+        {
+            return CPBLK_AVX_UNROLL_LIMIT;
+        }
+#endif
+        return CPBLK_UNROLL_LIMIT;
+    }
+#endif // _TARGET_XARCH_ && !LEGACY_BACKEND
+
 /*
 XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
@@ -7620,16 +7726,17 @@ public :
         UINT64 allocSzByKind[CMK_Count];  // Classified by "kind".
         UINT64 nraTotalSizeAlloc;
         UINT64 nraTotalSizeUsed;
+        UINT64 nraTotalSizeRecycled;  // Bytes satisfied from blocks released by jitstd containers.
 
         static const char* s_CompMemKindNames[];  // Names of the kinds.
 
         MemStats()
-            : allocCnt(0), allocSz(0), allocSzMax(0), nraTotalSizeAlloc(0), nraTotalSizeUsed(0)
+            : allocCnt(0), allocSz(0), allocSzMax(0), nraTotalSizeAlloc(0), nraTotalSizeUsed(0), nraTotalSizeRecycled(0)
         {
             for (int i = 0; i < CMK_Count; i++) allocSzByKind[i] = 0;
         }
         MemStats(const MemStats& ms)
-            : allocCnt(ms.allocCnt), allocSz(ms.allocSz), allocSzMax(ms.allocSzMax), nraTotalSizeAlloc(ms.nraTotalSizeAlloc), nraTotalSizeUsed(ms.nraTotalSizeUsed)
+            : allocCnt(ms.allocCnt), allocSz(ms.allocSz), allocSzMax(ms.allocSzMax), nraTotalSizeAlloc(ms.nraTotalSizeAlloc), nraTotalSizeUsed(ms.nraTotalSizeUsed), nraTotalSizeRecycled(ms.nraTotalSizeRecycled)
         {
             for (int i = 0; i < CMK_Count; i++) allocSzByKind[i] = ms.allocSzByKind[i];
         }
@@ -7671,6 +7778,7 @@ public :
             for (int i = 0; i < CMK_Count; i++) allocSzByKind[i] += ms.allocSzByKind[i];
             nraTotalSizeAlloc += ms.nraTotalSizeAlloc;
             nraTotalSizeUsed  += ms.nraTotalSizeUsed;
+            nraTotalSizeRecycled += ms.nraTotalSizeRecycled;
         }
 
         void Print(FILE* f); // Print these stats to stdout.
@@ -8216,6 +8324,7 @@ public:
     bool                    compIsMethodForLRSampling;  // Is this the method suitable as a sample for the linear regression?
     int                     compNativeSizeEstimate;     // The estimated native size of this method.
     InlInlineHints          compInlineeHints;           // Inlining hints from the inline candidate.
+    unsigned                compInlineeFoldableBranches; // Conditional branches fed by a constant argument of the inline candidate.
 
 #ifdef DEBUG   
     CodeSeqSM               fgCodeSeqSm;                // The code sequence state machine used in the inliner.
@@ -8409,6 +8518,16 @@ public:
 // Inline methods of CompAllocator.
 void * CompAllocator::Alloc(size_t sz)
 {
+    void * p = m_comp->compGetAllocator()->nraAllocRecycled(sz);
+    if (p != nullptr)
+    {
+#if MEASURE_MEM_ALLOC
+        // Counted like any other allocation; nraTotalSizeRecycled tells how much of it was reused
+        m_comp->genMemStats.AddAlloc(sz, m_cmk);
+#endif
+        return p;
+    }
+
 #if MEASURE_MEM_ALLOC
     return m_comp->compGetMem(sz, m_cmk);
 #else
@@ -8425,6 +8544,14 @@ void * CompAllocator::ArrayAlloc(size_t elems, size_t elemSize)
 #endif
 }
 
+void CompAllocator::FreeSized(void * p, size_t sz)
+{
+    if (p != nullptr)
+    {
+        m_comp->compGetAllocator()->nraRecycle(p, sz);
+    }
+}
+
 
 // LclVarDsc constructor. Uses Compiler, so must come after Compiler definition.
 inline
@@ -33,6 +33,9 @@ CompPhaseNameMacro(PHASE_CREATE_FUNCLETS, "Create EH funclets", false, -1)
 CompPhaseNameMacro(PHASE_OPTIMIZE_LAYOUT,        "Optimize layout",                false, -1)
 CompPhaseNameMacro(PHASE_OPTIMIZE_LOOPS,         "Optimize loops",                 false, -1)
 CompPhaseNameMacro(PHASE_CLONE_LOOPS,            "Clone loops",                    false, -1)
+#ifdef FEATURE_SIMD
+CompPhaseNameMacro(PHASE_VECTORIZE_LOOPS,        "Vectorize loops",                false, -1)
+#endif // FEATURE_SIMD
 CompPhaseNameMacro(PHASE_UNROLL_LOOPS,           "Unroll loops",                   false, -1)
 CompPhaseNameMacro(PHASE_HOIST_LOOP_CODE,        "Hoist loop code",                false, -1)
 CompPhaseNameMacro(PHASE_MARK_LOCAL_VARS,        "Mark local vars",                false, -1)
@@ -59,6 +62,7 @@ CompPhaseNameMacro(PHASE_VN_COPY_PROP,           "VN based copy prop",
 #if ASSERTION_PROP
 CompPhaseNameMacro(PHASE_ASSERTION_PROP_MAIN,    "Assertion prop",                 false, -1)
 #endif
+CompPhaseNameMacro(PHASE_ELIDE_WRITE_BARRIERS,   "Elide write barriers",           false, -1)
 CompPhaseNameMacro(PHASE_UPDATE_FLOW_GRAPH,      "Update flow graph",              false, -1)
 CompPhaseNameMacro(PHASE_COMPUTE_EDGE_WEIGHTS2,  "Compute edge weights (2)",       false, -1)
 CompPhaseNameMacro(PHASE_DETERMINE_FIRST_COLD_BLOCK, "Determine first cold block", false, -1)
@@ -271,6 +271,16 @@ unsigned           Compiler::eeGetArgSize(CORINFO_ARG_LIST_HANDLE list, CORINFO_
 {
 #if defined(_TARGET_AMD64_) || defined(_TARGET_ARM64_)
 
+#ifdef FEATURE_UNIX_AMD64_STRUCT_PASSING
+    // Structs of two INTEGER eightbytes are passed by value, in two registers or two stack slots.
+    CORINFO_CLASS_HANDLE        argClass;
+    CorInfoType argTypeJit = strip(info.compCompHnd->getArgType(sig, list, &argClass));
+    if (argTypeJit == CORINFO_TYPE_VALUECLASS && eeIsRegPassedStruct(argClass))
+    {
+        return 2 * sizeof(size_t);
+    }
+#endif // FEATURE_UNIX_AMD64_STRUCT_PASSING
+
     // Everything fits into a single 'slot' size
     // to accommodate irregular sized structs, they are passed byref
     // TODO-ARM64-Bug?: structs <= 16 bytes get passed in 2 consecutive registers.
@@ -300,6 +310,35 @@ unsigned           Compiler::eeGetArgSize(CORINFO_ARG_LIST_HANDLE list, CORINFO_
 #endif
 }
 
+#ifdef FEATURE_UNIX_AMD64_STRUCT_PASSING
+/*****************************************************************************
+ * Returns true if a value of the given struct type is passed by value in two general
+ * purpose registers (or in two stack slots when the registers run out), as opposed to
+ * by reference.  If so, *pHiSize (when given) is the size of the second eightbyte, as
+ * computed by the VM from the instance field bytes of the type.
+ */
+
+bool               Compiler::eeIsRegPassedStruct(CORINFO_CLASS_HANDLE clsHnd, unsigned* pHiSize)
+{
+    SYSTEMV_AMD64_CORINFO_STRUCT_REG_PASSING_DESCRIPTOR structDesc;
+    if (!info.compCompHnd->getSystemVAmd64PassStructInRegisterDescriptor(clsHnd, &structDesc))
+        return false;
+
+    if (!structDesc.passedInRegisters)
+        return false;
+
+    // Only structs of two INTEGER eightbytes are passed in registers for now.
+    assert(structDesc.eightByteCount == CLR_SYSTEMV_MAX_EIGHTBYTES_COUNT_TO_PASS_IN_REGISTERS);
+    assert(structDesc.eightByteClassifications[0] == SystemVClassificationTypeInteger);
+    assert(structDesc.eightByteClassifications[1] == SystemVClassificationTypeInteger);
+    if (pHiSize != nullptr)
+    {
+        *pHiSize = structDesc.eightByteSizes[1];
+    }
+    return true;
+}
+#endif // FEATURE_UNIX_AMD64_STRUCT_PASSING
+
 /*****************************************************************************/
 
 GenTreePtr          Compiler::eeGetPInvokeCookie(CORINFO_SIG_INFO *szMetaSig)
@@ -1010,6 +1010,9 @@ void                emitter::emitBegFN(bool     hasFramePtr
 #ifdef _TARGET_XARCH_
     emitExitSeqBegLoc.Init();
     emitExitSeqSize     = INT_MAX;
+#ifdef FEATURE_AVX_SUPPORT
+    SetContains256bitAVX(false);
+#endif // FEATURE_AVX_SUPPORT
 #endif // _TARGET_XARCH_
 
     emitPlaceholderList =
@@ -1367,6 +1370,14 @@ void        *       emitter::emitAllocInstr(size_t sz, emitAttr opsz)
 
     emitInsCount++;
 
+#if defined(_TARGET_XARCH_) && defined(FEATURE_AVX_SUPPORT)
+    // Remember 256-bit AVX use, so that the prolog and epilogs can avoid the AVX to SSE transition penalty
+    if (UseAVX() && (EA_SIZE(opsz) == EA_32BYTE))
+    {
+        SetContains256bitAVX(true);
+    }
+#endif // _TARGET_XARCH_ && FEATURE_AVX_SUPPORT
+
     /* In debug mode we clear/set some additional fields */
 
 #if defined(DEBUG) || defined(LATE_DISASM)
@@ -98,6 +98,11 @@ bool emitter::IsThreeOperandBinaryAVXInstruction(instruction ins)
             ins == INS_pmuludq  || ins == INS_pxor     ||
             ins == INS_pmaxub   || ins == INS_pminub   ||
             ins == INS_pmaxsw   || ins == INS_pminsw   ||
+            ins == INS_pmaxsb   || ins == INS_pminsb   ||
+            ins == INS_pmaxsd   || ins == INS_pminsd   ||
+            ins == INS_pmaxuw   || ins == INS_pminuw   ||
+            ins == INS_pmaxud   || ins == INS_pminud   ||
+            ins == INS_phaddd   ||
             ins == INS_insertps || ins == INS_vinsertf128
 
             );
@@ -141,7 +146,16 @@ bool Is4ByteAVXInstruction(instruction ins)
              ins == INS_vpbroadcastq ||
              ins == INS_vextractf128 ||
              ins == INS_vinsertf128 ||
-             ins == INS_pmulld
+             ins == INS_pmulld       ||
+             ins == INS_pminsb       ||
+             ins == INS_pminsd       ||
+             ins == INS_pminuw       ||
+             ins == INS_pminud       ||
+             ins == INS_pmaxsb       ||
+             ins == INS_pmaxsd       ||
+             ins == INS_pmaxuw       ||
+             ins == INS_pmaxud       ||
+             ins == INS_phaddd
            );
 #else
     return false;
@@ -115,6 +115,9 @@ public:
     bool            useAVXEncodings;
     bool            UseAVX()                { return useAVXEncodings; }
     void            SetUseAVX(bool value)   { useAVXEncodings = value; }
+    bool            contains256bitAVXInstruction;
+    bool            Contains256bitAVX()     { return contains256bitAVXInstruction; }
+    void            SetContains256bitAVX(bool value) { contains256bitAVXInstruction = value; }
     bool            IsThreeOperandBinaryAVXInstruction(instruction ins);
     bool            IsThreeOperandMoveAVXInstruction(instruction ins);
     bool            IsThreeOperandAVXInstruction(instruction ins)
@@ -123,6 +126,7 @@ public:
     }
 #else // !FEATURE_AVX_SUPPORT
     bool            UseAVX()                                              { return false; }
+    bool            Contains256bitAVX()                                   { return false; }
     bool            hasVexPrefix(size_t code)                             { return false; }
     bool            IsThreeOperandBinaryAVXInstruction(instruction ins)   { return false; }
     bool            IsThreeOperandMoveAVXInstruction(instruction ins)     { return false; }
@@ -4726,6 +4726,7 @@ INL_HANDLE_COMPARE:
                     if (impInlineInfo->inlArgInfo[varNum].argNode->OperIsConst())
                     {
                         compInlineeHints = (InlInlineHints)(compInlineeHints | InlIncomingConstFeedsCond);
+                        compInlineeFoldableBranches++;
                     }
                 }
                 if (fgStack::isArgument(slot1))
@@ -4734,6 +4735,7 @@ INL_HANDLE_COMPARE:
                     if (impInlineInfo->inlArgInfo[varNum].argNode->OperIsConst())
                     {
                         compInlineeHints = (InlInlineHints)(compInlineeHints | InlIncomingConstFeedsCond);
+                        compInlineeFoldableBranches++;
                     }
                 }
             }
@@ -4973,20 +4975,41 @@ TOO_FAR:
             // it should have been made earlier.
             noway_assert(codeSize > ALWAYS_INLINE_SIZE && codeSize <= impInlineSize);
 
-            // Make an inlining decision based on the estimated native size.
-            int callsiteNativeSizeEstimate = impEstimateCallsiteNativeSize(&impInlineInfo->inlineCandidateInfo->methInfo);
+            // Make an inlining decision based on what we have observed about the candidate
+            // and its call site.
+            InlineObservations obs;
+            memset(&obs, 0, sizeof(obs));
+            obs.ilCodeSize                 = codeSize;
+            obs.instrCount                 = opts.instrCount;
+            obs.calleeNativeSizeEstimate   = compNativeSizeEstimate;
+            obs.callsiteNativeSizeEstimate = impEstimateCallsiteNativeSize(&impInlineInfo->inlineCandidateInfo->methInfo);
+            obs.hints                      = compInlineeHints;
+            obs.argCount                   = impInlineInfo->argCnt;
+            obs.foldableBranchCount        = compInlineeFoldableBranches;
+
+            for (unsigned argNum = 0; argNum < impInlineInfo->argCnt; argNum++)
+            {
+                if (impInlineInfo->inlArgInfo[argNum].argNode->OperIsConst())
+                {
+                    obs.constantArgCount++;
+                }
+            }
+
+            BasicBlock* callSiteBlock = impInlineInfo->iciBlock;
+            obs.hasCallSite       = true;
+            obs.callSiteInLoop    = (callSiteBlock->bbFlags & BBF_BACKWARD_JUMP) != 0;
+            obs.callSiteRarelyRun = callSiteBlock->isRunRarely();
+            obs.callSiteWeight    = callSiteBlock->bbWeight;
 
-            JitInlineResult result = impCanInlineNative(callsiteNativeSizeEstimate,
-                                                        compNativeSizeEstimate,
-                                                        compInlineeHints,
-                                                        impInlineInfo);
+            JitInlineResult result = InlinePolicy::GetPolicy()->DetermineProfitability(this, obs);
 
             if (dontInline(result.result()))
             {
 #ifdef DEBUG
                 if (verbose)
                 {
-                    printf("\n\nInline expansion aborted because impCanInlineNative returns %s\n",
+                    printf("\n\nInline expansion aborted because the %s inline policy returns %s\n",
+                           InlinePolicy::GetPolicy()->GetName(),
                            (result.result()==INLINE_NEVER)?"INLINE_NEVER":"INLINE_FAIL");
                 }
 #endif
@@ -21861,14 +21884,15 @@ JitInlineResult       Compiler::fgInvokeInlineeCompiler(GenTreeCall* call)
     }
 #endif // DEBUG
 
-#if defined(DEBUG)
     impInlinedCodeSize += inlineCandidateInfo->methInfo.ILCodeSize;
-#endif
 
     result = JitInlineResult(INLINE_PASS, inlineCandidateInfo->ilCallerHandle, fncHandle, NULL);
 
 Exit:
 
+#ifdef DEBUG
+    InlinePolicy::LogDecision(this, &inlineInfo, result);
+#endif // DEBUG
     result.report(info.compCompHnd);
     return result;
 }
@@ -21968,6 +21992,9 @@ void Compiler::fgInsertInlineeBlocks(InlineInfo* pInlineInfo)
                 stmtAfter = fgInsertStmtListAfter(iciBlock,
                                                   stmtAfter,
                                                   InlineeCompiler->fgFirstBB->bbTreeList);
+
+                // Copy inlinee bbFlags to caller bbFlags.
+                iciBlock->bbFlags |= InlineeCompiler->fgFirstBB->bbFlags & (BBF_HAS_NEWOBJ | BBF_HAS_NEWARRAY);
             }
 #ifdef DEBUG
             if (verbose)
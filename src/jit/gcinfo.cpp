@@ -251,6 +251,12 @@ GCInfo::WriteBarrierForm GCInfo::gcIsWriteBarrierCandidate(GenTreePtr tgt, GenTr
 
     tgt = tgt->gtEffectiveVal();
 
+    /* Stores into an object allocated since the last GC safe point cannot create
+       a reference from an older generation (see optElideNewObjWriteBarriers) */
+
+    if (compiler->optIsNoBarrierStore(tgt))
+        return WBF_NoBarrier;
+
     switch (tgt->gtOper)
     {
 
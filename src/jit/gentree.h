@@ -815,9 +815,13 @@ public:
     #define GTF_RELOP_SMALL     0x10000000  // GT_<relop> -- We should use a byte or short sized compare (op1->gtType is the small type)
 
     #define GTF_QMARK_CAST_INSTOF 0x80000000  // GT_QMARK   -- Is this a top (not nested) level qmark created for castclass or instanceof?
+    #define GTF_QMARK_CAST_FAIL_RARE 0x40000000 // GT_QMARK -- The helper fallback of this castclass qmark is only reached when the cast fails
 
     #define GTF_BOX_VALUE 0x80000000  // GT_BOX   -- "box" is on a value type
 
+    #define GTF_LIST_STRUCT_PAIR 0x80000000 // GT_LIST  -- this argument and the next one are the two eightbytes
+                                            //               of a struct passed by value (System V AMD64)
+
     #define GTF_ICON_HDL_MASK   0xF0000000  // Bits used by handle types below
 
     #define GTF_ICON_SCOPE_HDL  0x10000000  // GT_CNS_INT -- constant is a scope handle
@@ -63,17 +63,16 @@ void                Compiler::impInit()
     impTreeList = impTreeLast = NULL;
 #endif
 
-#if defined(DEBUG)
     impInlinedCodeSize = 0;
-#endif
 
     seenConditionalJump = false;  
        
 #ifndef DEBUG
-    impInlineSize = DEFAULT_MAX_INLINE_SIZE;
+    impInlineSize = InlinePolicy::GetPolicy()->MaxInlineILSize();
 #else
     static ConfigDWORD fJitInlineSize;
-    impInlineSize = fJitInlineSize.val_DontUse_(CLRConfig::INTERNAL_JITInlineSize, DEFAULT_MAX_INLINE_SIZE);
+    impInlineSize = fJitInlineSize.val_DontUse_(CLRConfig::INTERNAL_JITInlineSize,
+                                                InlinePolicy::GetPolicy()->MaxInlineILSize());
 
     if (compStressCompile(STRESS_INLINE, 50))
         impInlineSize *= 10;
@@ -1576,7 +1575,9 @@ GenTreePtr Compiler::impMethodPointer(CORINFO_RESOLVED_TOKEN * pResolvedToken, C
           to get the handle.
       2b. pLookup->testForNull == true : Dereference the instantiation-specific handle.
           If it is non-NULL, it is the handle required. Else, call a helper
-          to lookup the handle.
+          to lookup the handle. If pLookup->sizeOffset != CORINFO_NO_SIZE_CHECK,
+          the handle is only dereferenced if the dictionary is large enough to
+          hold it, and taken to be NULL otherwise.
  */
 
 GenTreePtr          Compiler::impRuntimeLookupToTree(CORINFO_RUNTIME_LOOKUP_KIND kind,
@@ -1622,11 +1623,16 @@ GenTreePtr          Compiler::impRuntimeLookupToTree(CORINFO_RUNTIME_LOOKUP_KIND
     // Slot pointer
     GenTreePtr slotPtrTree = ctxTree;
 
+    // Dictionary pointer, if its size needs to be checked before reading the slot
+    GenTreePtr dictPtrTree = NULL;
+
     if (pLookup->testForNull)
     {
         slotPtrTree = impCloneExpr(ctxTree, &ctxTree, NO_CLASS_HANDLE, (unsigned)CHECK_SPILL_ALL, NULL DEBUGARG("impRuntimeLookup slot") );
     }
 
+    assert(pLookup->sizeOffset == CORINFO_NO_SIZE_CHECK || pLookup->testForNull);
+
     // Applied repeated indirections
     for (WORD i = 0; i < pLookup->indirections; i++)
     {
@@ -1636,6 +1642,11 @@ GenTreePtr          Compiler::impRuntimeLookupToTree(CORINFO_RUNTIME_LOOKUP_KIND
             slotPtrTree->gtFlags |= GTF_IND_NONFAULTING;
             slotPtrTree->gtFlags |= GTF_IND_INVARIANT;
         }
+        if ((i == pLookup->indirections - 1) && (pLookup->sizeOffset != CORINFO_NO_SIZE_CHECK))
+        {
+            // The size and the slot must be read from the same dictionary
+            dictPtrTree = impCloneExpr(slotPtrTree, &slotPtrTree, NO_CLASS_HANDLE, (unsigned)CHECK_SPILL_ALL, NULL DEBUGARG("impRuntimeLookup dictionary") );
+        }
         if (pLookup->offsets[i] != 0)
             slotPtrTree = gtNewOperNode(GT_ADD, TYP_I_IMPL, slotPtrTree, gtNewIconNode(pLookup->offsets[i], TYP_I_IMPL));            
     }
@@ -1686,6 +1697,27 @@ GenTreePtr          Compiler::impRuntimeLookupToTree(CORINFO_RUNTIME_LOOKUP_KIND
     GenTreePtr handle = gtNewOperNode(GT_IND, TYP_I_IMPL, slotPtrTree);
     handle->gtFlags |= GTF_IND_NONFAULTING;
 
+    if (dictPtrTree != NULL)
+    {
+        // The dictionary may not have grown to the slot yet. Only read the slot if it is within
+        // the size of the dictionary, and let the helper grow the dictionary otherwise.
+        GenTreePtr sizeTree = gtNewOperNode(GT_ADD, TYP_I_IMPL, dictPtrTree, gtNewIconNode(pLookup->sizeOffset, TYP_I_IMPL));
+        sizeTree = gtNewOperNode(GT_IND, TYP_I_IMPL, sizeTree);
+        sizeTree->gtFlags |= GTF_IND_NONFAULTING;
+
+        GenTreePtr sizeCheck = gtNewOperNode(GT_GT, TYP_INT, sizeTree, gtNewIconNode(pLookup->offsets[pLookup->indirections - 1], TYP_I_IMPL));
+        sizeCheck->gtFlags |= GTF_RELOP_QMARK;
+
+        GenTreePtr sizeColon = new (this, GT_COLON) GenTreeColon(TYP_I_IMPL, 
+                                                                 handle,                          // the slot if it is within the size
+                                                                 gtNewIconNode(0, TYP_I_IMPL));
+        GenTreePtr sizeQmark = gtNewQmarkNode(TYP_I_IMPL, sizeCheck, sizeColon);
+
+        unsigned sizeTmp = lvaGrabTemp(true DEBUGARG("spilling QMark2"));
+        impAssignTempGen(sizeTmp, sizeQmark, (unsigned)CHECK_SPILL_NONE);
+        handle = gtNewLclvNode(sizeTmp, TYP_I_IMPL);
+    }
+
     GenTreePtr handleCopy = impCloneExpr(handle, &handle, NO_CLASS_HANDLE, (unsigned)CHECK_SPILL_ALL, NULL DEBUGARG("impRuntimeLookup typehandle") );
 
     // Call to helper
@@ -4940,6 +4972,22 @@ IVAL_COMMON:
         op1 = gtNewDconNode(dval);
         break;
 
+    case TYP_REF:
+        // Objects can move, so the reference itself cannot be embedded. A null reference is
+        // embedded as a constant. Otherwise the static slot is pinned and will not change
+        // again, so loading it is invariant and can be hoisted and CSE'd.
+        if (*((void **) fldAddr) == NULL)
+        {
+            op1 = gtNewIconNode(0, TYP_REF);
+        }
+        else
+        {
+            op1 = gtNewIconHandleNode((size_t)fldAddr, GTF_ICON_STATIC_HDL);
+            op1 = gtNewOperNode(GT_IND, TYP_REF, op1);
+            op1->gtFlags |= GTF_IND_INVARIANT | GTF_IND_NONFAULTING;
+        }
+        break;
+
     default:
         assert(!"Unexpected lclTyp");
         break;
@@ -8074,6 +8122,7 @@ var_types Compiler::impGetByRefResultType(genTreeOps oper, bool fUnsigned, GenTr
 GenTreePtr Compiler::impCastClassOrIsInstToTree(GenTreePtr op1, GenTreePtr op2, CORINFO_RESOLVED_TOKEN * pResolvedToken, bool isCastClass)
 {
     bool expandInline;  
+    bool isFinal = false;
     
     assert(op1->TypeGet() == TYP_REF);
 
@@ -8090,6 +8139,16 @@ GenTreePtr Compiler::impCastClassOrIsInstToTree(GenTreePtr op1, GenTreePtr op2,
     {
         // We only want to expand inline the normal CHKCASTCLASS helper;
         expandInline = (helper == CORINFO_HELP_CHKCASTCLASS);        
+
+        if (expandInline)
+        {
+            //
+            // If the class is final, an object whose method table doesn't match cannot be cast to it,
+            // so the helper call after the inlined check only runs when the cast is about to throw.
+            //
+            DWORD flags = info.compCompHnd->getClassAttribs(pResolvedToken->hClass);
+            isFinal = ((flags & CORINFO_FLG_FINAL) != 0);
+        }
     }
     else
     {
@@ -8235,6 +8294,10 @@ GenTreePtr Compiler::impCastClassOrIsInstToTree(GenTreePtr op1, GenTreePtr op2,
                                                  );
     qmarkNull = gtNewQmarkNode(TYP_REF, condNull, temp);
     qmarkNull->gtFlags |= GTF_QMARK_CAST_INSTOF;
+    if (isCastClass && isFinal)
+    {
+        qmarkNull->gtFlags |= GTF_QMARK_CAST_FAIL_RARE;
+    }
     condNull->gtFlags |= GTF_RELOP_QMARK;    
 
     // Make QMark node a top level node by spilling it.
@@ -11622,7 +11685,7 @@ DO_LDFTN:
                 if ((aflags & CORINFO_ACCESS_GET) && 
                     (fieldInfo.fieldFlags & CORINFO_FLG_FIELD_FINAL) &&
                     !(fieldInfo.fieldFlags & CORINFO_FLG_FIELD_STATIC_IN_HEAP) &&
-                    (varTypeIsIntegral(lclTyp) || varTypeIsFloating(lclTyp)))
+                    (varTypeIsIntegral(lclTyp) || varTypeIsFloating(lclTyp) || (lclTyp == TYP_REF)))
                 {
                     CorInfoInitClassResult initClassResult = info.compCompHnd->initClass(resolvedToken.hField, info.compMethodHnd,
                         impTokenLookupContextHandle);
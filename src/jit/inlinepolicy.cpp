@@ -0,0 +1,571 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+//
+
+/*XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+XX                                                                           XX
+XX                            InlinePolicy                                   XX
+XX                                                                           XX
+XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+*/
+
+#include "jitpch.h"
+#ifdef _MSC_VER
+#pragma hdrstop
+#endif
+
+static LegacyInlinePolicy        s_legacyInlinePolicy;
+
+#ifdef DEBUG
+
+// Under the profitability policy, candidates up to this many IL bytes are scanned;
+// their native size estimate and the budget decide the rest.
+#define PROFITABILITY_MAX_INLINE_SIZE   (2 * DEFAULT_MAX_INLINE_SIZE)
+
+// The growth budget of a root method is never less than this many IL bytes,
+// so that small methods can still inline a few helpers.
+#define INLINE_BUDGET_MIN_IL_SIZE       (4 * DEFAULT_MAX_INLINE_SIZE)
+
+static ProfitabilityInlinePolicy s_profitabilityInlinePolicy;
+static ReplayInlinePolicy        s_replayInlinePolicy;
+
+static CritSecObject             s_inlineLogLock;
+static FILE*                     s_inlineLogFile       = nullptr;
+static bool                      s_inlineLogFileOpened = false;
+
+CritSecObject                    ReplayInlinePolicy::s_replayLock;
+ReplayInlinePolicy::Decision*    ReplayInlinePolicy::s_decisions     = nullptr;
+unsigned                         ReplayInlinePolicy::s_decisionCount = 0;
+volatile bool                    ReplayInlinePolicy::s_loaded        = false;
+
+#endif // DEBUG
+
+//------------------------------------------------------------------------
+// MakeResult: Construct the result of a profitability decision.
+//
+// Arguments:
+//    comp     - the Compiler instance passed to DetermineProfitability
+//    obs      - the observations passed to DetermineProfitability
+//    decision - INLINE_PASS, INLINE_FAIL or INLINE_NEVER
+//    reason   - the reason for a failure, nullptr for INLINE_PASS
+//
+// Notes:
+//    Without a call site (the static hint for ngen) there is no inliner to report.
+//    A successful profitability decision is not reported to the EE: the inline
+//    may still fail, and the final result is reported by fgInvokeInlineeCompiler.
+
+// static
+JitInlineResult InlinePolicy::MakeResult(Compiler*                 comp,
+                                         const InlineObservations& obs,
+                                         CorInfoInline             decision,
+                                         const char*               reason)
+{
+    InlineInfo* pInlineInfo = obs.hasCallSite ? comp->impInlineInfo : nullptr;
+    JitInlineResult result(decision,
+                           (pInlineInfo != nullptr) ? pInlineInfo->inlineCandidateInfo->ilCallerHandle : nullptr,
+                           (pInlineInfo != nullptr) ? pInlineInfo->fncHandle : nullptr,
+                           reason);
+    if (!dontInline(decision))
+    {
+        result.setReported();
+    }
+    return result;
+}
+
+#ifdef DEBUG
+
+//------------------------------------------------------------------------
+// CallSiteILOffset: Get the IL offset recorded for the statement holding the call
+//                   being inlined, which identifies the call site in the log.
+
+// static
+unsigned InlinePolicy::CallSiteILOffset(InlineInfo* inlineInfo)
+{
+    IL_OFFSETX offsx = inlineInfo->iciStmt->gtStmt.gtStmtILoffsx;
+    return (offsx == BAD_IL_OFFSET) ? BAD_IL_OFFSET : jitGetILoffsAny(offsx);
+}
+
+#endif // DEBUG
+
+//------------------------------------------------------------------------
+// GetPolicy: Get the inline policy selected by COMPlus_JitInlinePolicy.
+
+// static
+InlinePolicy* InlinePolicy::GetPolicy()
+{
+#ifdef DEBUG
+    static ConfigDWORD fJitInlinePolicy;
+    switch (fJitInlinePolicy.val(CLRConfig::INTERNAL_JitInlinePolicy))
+    {
+    case POLICY_PROFITABILITY:
+        return &s_profitabilityInlinePolicy;
+    case POLICY_REPLAY:
+        return &s_replayInlinePolicy;
+    default:
+        return &s_legacyInlinePolicy;
+    }
+#else // !DEBUG
+    return &s_legacyInlinePolicy;
+#endif // !DEBUG
+}
+
+#ifdef DEBUG
+
+//------------------------------------------------------------------------
+// LogDecision: Append the result of an inline attempt to COMPlus_JitInlineLogFile.
+//
+// Arguments:
+//    rootComp   - the Compiler instance performing the inline
+//    inlineInfo - the inline attempt
+//    result     - the final result of the attempt
+//
+// Notes:
+//    See inlinepolicy.h for the format.  The file is opened on the first decision
+//    and kept open for the rest of the process; each line is flushed, so that the
+//    log of a process that does not shut down cleanly is complete.
+
+// static
+void InlinePolicy::LogDecision(Compiler*              rootComp,
+                               InlineInfo*            inlineInfo,
+                               const JitInlineResult& result)
+{
+    static ConfigString fJitInlineLogFile;
+    LPCWSTR inlineLogFile = fJitInlineLogFile.val(CLRConfig::INTERNAL_JitInlineLogFile);
+    if (inlineLogFile == nullptr)
+    {
+        return;
+    }
+
+    Compiler* root = rootComp->impInlineRoot();
+    unsigned rootHash   = root->info.compCompHnd->getMethodHash(root->info.compMethodHnd);
+    unsigned calleeHash = rootComp->info.compCompHnd->getMethodHash(inlineInfo->fncHandle);
+    unsigned ilOffset   = CallSiteILOffset(inlineInfo);
+    const char* reason  = (result.reason() != nullptr) ? result.reason() : "";
+
+    // Query the EE for the name before taking the lock; the EE may take locks of its own.
+    // (eeGetMethodFullName is not available in all builds.)
+    const char* calleeClassName = "";
+    const char* calleeName      = rootComp->info.compCompHnd->getMethodName(inlineInfo->fncHandle, &calleeClassName);
+
+    ClrEnterCriticalSection(s_inlineLogLock.Val());
+    if (!s_inlineLogFileOpened)
+    {
+        // Don't retry a file that could not be opened.
+        s_inlineLogFile       = _wfopen(inlineLogFile, W("a"));
+        s_inlineLogFileOpened = true;
+    }
+    FILE* fp = s_inlineLogFile;
+    if (fp != nullptr)
+    {
+        fprintf(fp, "%u,%u,%u,%u,%s,%u,\"%s:%s\",\"%s\"\n",
+                rootHash, calleeHash, ilOffset, dontInline(result) ? 0 : 1,
+                GetPolicy()->GetName(), inlineInfo->inlineCandidateInfo->methInfo.ILCodeSize,
+                calleeClassName, calleeName, reason);
+        fflush(fp);
+    }
+    ClrLeaveCriticalSection(s_inlineLogLock.Val());
+}
+
+//------------------------------------------------------------------------
+// CloseLog: Close the COMPlus_JitInlineLogFile, if it was opened.
+
+// static
+void InlinePolicy::CloseLog()
+{
+    ClrEnterCriticalSection(s_inlineLogLock.Val());
+    if (s_inlineLogFile != nullptr)
+    {
+        fclose(s_inlineLogFile);
+        s_inlineLogFile = nullptr;
+    }
+    ClrLeaveCriticalSection(s_inlineLogLock.Val());
+}
+
+#endif // DEBUG
+
+/*****************************************************************************/
+
+unsigned LegacyInlinePolicy::MaxInlineILSize()
+{
+    return DEFAULT_MAX_INLINE_SIZE;
+}
+
+//------------------------------------------------------------------------
+// DetermineProfitability: Apply the impCanInlineNative heuristics.
+//
+// Notes:
+//    Candidates of at most ALWAYS_INLINE_SIZE IL bytes are always inlined, and
+//    are not size-estimated.
+
+JitInlineResult LegacyInlinePolicy::DetermineProfitability(Compiler* comp, const InlineObservations& obs)
+{
+    if (obs.ilCodeSize <= ALWAYS_INLINE_SIZE)
+    {
+        return MakeResult(comp, obs, INLINE_PASS, nullptr);
+    }
+    assert(obs.calleeNativeSizeEstimate != NATIVE_SIZE_INVALID);
+    return comp->impCanInlineNative(obs.callsiteNativeSizeEstimate,
+                                    obs.calleeNativeSizeEstimate,
+                                    obs.hints,
+                                    obs.hasCallSite ? comp->impInlineInfo : nullptr);
+}
+
+/*****************************************************************************/
+#ifdef DEBUG
+
+unsigned ProfitabilityInlinePolicy::MaxInlineILSize()
+{
+    return PROFITABILITY_MAX_INLINE_SIZE;
+}
+
+//------------------------------------------------------------------------
+// EstimateBenefitMultiplier: Estimate how much native code growth the candidate
+//                            is worth, as a multiple of the size of the call.
+//
+// Arguments:
+//    comp - the Compiler instance for the candidate
+//    obs  - the observations about the candidate
+//
+// Return Value:
+//    The multiplier; a candidate whose (folded) native size is within the call
+//    size times the multiplier is profitable.
+//
+// Notes:
+//    Unlike impCanInlineNative, constant arguments and the branches they feed add
+//    to the benefit for each occurrence, since each is a chance for the inlined
+//    body to fold away, and the call site frequency is taken from the block weight.
+
+double ProfitabilityInlinePolicy::EstimateBenefitMultiplier(Compiler* comp, const InlineObservations& obs)
+{
+    // Rarely run call sites and class constructors only get inlines that don't grow the code.
+    if (obs.callSiteRarelyRun || ((comp->info.compFlags & FLG_CCTOR) == FLG_CCTOR))
+    {
+        return 1.0;
+    }
+
+    double multiplier = 1.0;
+
+    if (obs.hints & InlLooksLikeWrapperMethod)
+    {
+        multiplier += 1.0;
+    }
+    if (obs.hints & InlMethodMostlyLdSt)
+    {
+        multiplier += 3.0;
+    }
+    if (obs.hints & InlArgFeedsConstantTest)
+    {
+        multiplier += 1.0;
+    }
+    if (obs.hints & InlArgFeedsRngChk)
+    {
+        multiplier += 0.5;
+    }
+
+    multiplier += min(obs.constantArgCount, 4U) * 0.5;
+    multiplier += min(obs.foldableBranchCount, 3U) * 1.5;
+
+    // Instance constructors and methods of promotable structs (see impCanInlineNative).
+    if ((comp->info.compFlags & CORINFO_FLG_CONSTRUCTOR) != 0 &&
+        (comp->info.compFlags & CORINFO_FLG_STATIC)      == 0)
+    {
+        multiplier += 1.5;
+    }
+    if ((comp->info.compClassAttr & CORINFO_FLG_VALUECLASS) != 0)
+    {
+        Compiler::lvaStructPromotionInfo structPromotionInfo;
+        structPromotionInfo.typeHnd            = 0;
+        structPromotionInfo.canPromote         = false;
+        structPromotionInfo.requiresScratchVar = false;
+        comp->lvaCanPromoteStructType(comp->info.compClassHnd, &structPromotionInfo, false);
+        if (structPromotionInfo.canPromote)
+        {
+            multiplier += 3.0;
+        }
+    }
+
+#ifdef FEATURE_SIMD
+    if (obs.hasCallSite && comp->impInlineInfo->hasSIMDTypeArgLocalOrReturn)
+    {
+        static ConfigDWORD fJitInlineSIMDMultiplier;
+        multiplier += fJitInlineSIMDMultiplier.val(CLRConfig::INTERNAL_JitInlineSIMDMultiplier);
+    }
+#endif // FEATURE_SIMD
+
+    // Call site frequency.  Without a call site (the static hint) assume the best case.
+    if (!obs.hasCallSite || obs.callSiteInLoop || obs.callSiteWeight >= BB_MAX_WEIGHT)
+    {
+        multiplier += 3.0;
+    }
+    else if (obs.callSiteWeight > BB_UNITY_WEIGHT)
+    {
+        multiplier += 2.0;
+    }
+    else
+    {
+        multiplier += 1.0;
+    }
+
+    return multiplier;
+}
+
+//------------------------------------------------------------------------
+// DetermineProfitability: Weigh the estimated growth of the candidate against
+//                         its estimated benefit, within the growth budget of
+//                         the root method.
+//
+// Notes:
+//    The budget is COMPlus_JitInlineBudget times the IL size of the root method,
+//    in inlined IL bytes (but no less than INLINE_BUDGET_MIN_IL_SIZE).  Candidates
+//    of at most ALWAYS_INLINE_SIZE IL bytes are no bigger than the call they replace,
+//    and are always inlined.
+
+JitInlineResult ProfitabilityInlinePolicy::DetermineProfitability(Compiler* comp, const InlineObservations& obs)
+{
+    if (obs.ilCodeSize <= ALWAYS_INLINE_SIZE)
+    {
+        return MakeResult(comp, obs, INLINE_PASS, nullptr);
+    }
+    assert(obs.calleeNativeSizeEstimate != NATIVE_SIZE_INVALID);
+
+    if (obs.hasCallSite)
+    {
+        static ConfigDWORD fJitInlineBudget;
+        Compiler* root = comp->impInlineRoot();
+        unsigned budget = root->info.compILCodeSize * fJitInlineBudget.val(CLRConfig::INTERNAL_JitInlineBudget);
+        if (budget < INLINE_BUDGET_MIN_IL_SIZE)
+        {
+            budget = INLINE_BUDGET_MIN_IL_SIZE;
+        }
+        if (root->impInlinedCodeSize + obs.ilCodeSize > budget)
+        {
+            JITDUMP("\nInline budget exhausted: %u + %u > %u IL bytes.\n",
+                    root->impInlinedCodeSize, obs.ilCodeSize, budget);
+            return MakeResult(comp, obs, INLINE_FAIL, "Inline growth budget of the root method is exhausted.");
+        }
+    }
+
+    // Each constant argument, and more so each branch it feeds, is a chance for
+    // part of the inlinee to fold away.  Discount its size accordingly.
+    double foldFactor = 1.0 - (0.15 * obs.foldableBranchCount) - (0.05 * obs.constantArgCount);
+    if (foldFactor < 0.5)
+    {
+        foldFactor = 0.5;
+    }
+    double calleeSize = obs.calleeNativeSizeEstimate * foldFactor;
+    double multiplier = EstimateBenefitMultiplier(comp, obs);
+    double threshold  = obs.callsiteNativeSizeEstimate * multiplier;
+
+    JITDUMP("\nProfitability: callee size %d (folded %g), call size %d, multiplier %g, threshold %g.\n",
+            obs.calleeNativeSizeEstimate, calleeSize, obs.callsiteNativeSizeEstimate, multiplier, threshold);
+
+    if (calleeSize > threshold)
+    {
+        return MakeResult(comp, obs, obs.hasCallSite ? INLINE_FAIL : INLINE_NEVER,
+                          "Estimated growth exceeds the estimated benefit.");
+    }
+    return MakeResult(comp, obs, INLINE_PASS, nullptr);
+}
+
+/*****************************************************************************/
+
+//------------------------------------------------------------------------
+// MaxInlineILSize: Scan candidates as large as the profitability policy does,
+//                  so that the decisions it logged can be replayed.
+
+unsigned ReplayInlinePolicy::MaxInlineILSize()
+{
+    return PROFITABILITY_MAX_INLINE_SIZE;
+}
+
+//------------------------------------------------------------------------
+// DetermineProfitability: Repeat the decision recorded for this call site in
+//                         COMPlus_JitInlineReplayFile, if any.
+//
+// Notes:
+//    Call sites that are not in the file are decided by the legacy policy,
+//    including its IL size limit.
+//    No static (ngen) hint is computed, since recorded decisions are per call site.
+
+JitInlineResult ReplayInlinePolicy::DetermineProfitability(Compiler* comp, const InlineObservations& obs)
+{
+    if (!obs.hasCallSite)
+    {
+        return MakeResult(comp, obs, INLINE_PASS, nullptr);
+    }
+
+    EnsureLoaded();
+
+    Compiler* root = comp->impInlineRoot();
+    unsigned rootHash   = root->info.compCompHnd->getMethodHash(root->info.compMethodHnd);
+    unsigned calleeHash = comp->info.compCompHnd->getMethodHash(comp->info.compMethodHnd);
+    unsigned ilOffset   = CallSiteILOffset(comp->impInlineInfo);
+
+    const Decision* decision = FindDecision(rootHash, calleeHash, ilOffset);
+    if (decision == nullptr)
+    {
+        if (obs.ilCodeSize > LegacyInlinePolicy::MaxInlineILSize())
+        {
+            return MakeResult(comp, obs, INLINE_FAIL, "Method is too big.");
+        }
+        return LegacyInlinePolicy::DetermineProfitability(comp, obs);
+    }
+    if (!decision->inlined)
+    {
+        return MakeResult(comp, obs, INLINE_FAIL, "Inline replay: not inlined in the recorded run.");
+    }
+    return MakeResult(comp, obs, INLINE_PASS, nullptr);
+}
+
+// static
+int __cdecl ReplayInlinePolicy::CompareDecisions(const void* d1, const void* d2)
+{
+    const Decision* decision1 = (const Decision*)d1;
+    const Decision* decision2 = (const Decision*)d2;
+    if (decision1->rootHash != decision2->rootHash)
+    {
+        return (decision1->rootHash < decision2->rootHash) ? -1 : 1;
+    }
+    if (decision1->calleeHash != decision2->calleeHash)
+    {
+        return (decision1->calleeHash < decision2->calleeHash) ? -1 : 1;
+    }
+    if (decision1->ilOffset != decision2->ilOffset)
+    {
+        return (decision1->ilOffset < decision2->ilOffset) ? -1 : 1;
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------
+// RemoveDuplicateDecisions: Merge the decisions recorded more than once for the
+//                           same call site, in a sorted array.
+//
+// Arguments:
+//    decisions     - the decisions, sorted by CompareDecisions
+//    decisionCount - the number of decisions
+//
+// Return Value:
+//    The number of decisions left at the start of the array.
+//
+// Notes:
+//    A call site is logged again whenever its root method is compiled again (for
+//    instance by another process appending to the same log).  If the recorded
+//    decisions agree, one is kept; if they differ, the call site is dropped and
+//    left to the legacy policy, since there is no single decision to replay.
+
+// static
+unsigned ReplayInlinePolicy::RemoveDuplicateDecisions(Decision* decisions, unsigned decisionCount)
+{
+    unsigned kept = 0;
+    unsigned i    = 0;
+    while (i < decisionCount)
+    {
+        unsigned next     = i + 1;
+        bool     conflict = false;
+        while ((next < decisionCount) && (CompareDecisions(&decisions[i], &decisions[next]) == 0))
+        {
+            conflict |= (decisions[next].inlined != decisions[i].inlined);
+            next++;
+        }
+        if (!conflict)
+        {
+            decisions[kept++] = decisions[i];
+        }
+        i = next;
+    }
+    return kept;
+}
+
+const ReplayInlinePolicy::Decision* ReplayInlinePolicy::FindDecision(unsigned rootHash,
+                                                                     unsigned calleeHash,
+                                                                     unsigned ilOffset)
+{
+    if (s_decisionCount == 0)
+    {
+        return nullptr;
+    }
+    Decision key;
+    key.rootHash   = rootHash;
+    key.calleeHash = calleeHash;
+    key.ilOffset   = ilOffset;
+    return (const Decision*)bsearch(&key, s_decisions, s_decisionCount, sizeof(Decision), CompareDecisions);
+}
+
+//------------------------------------------------------------------------
+// EnsureLoaded: Read COMPlus_JitInlineReplayFile, once per process.
+//
+// Notes:
+//    The decisions are kept, sorted and with one per call site, for the lifetime of the process.
+//    Lines that do not start with the four numeric fields (such as comments) are ignored.
+
+void ReplayInlinePolicy::EnsureLoaded()
+{
+    if (s_loaded)
+    {
+        return;
+    }
+
+    ClrEnterCriticalSection(s_replayLock.Val());
+    if (!s_loaded)
+    {
+        static ConfigString fJitInlineReplayFile;
+        LPCWSTR replayFile = fJitInlineReplayFile.val(CLRConfig::INTERNAL_JitInlineReplayFile);
+        FILE* fp = (replayFile != nullptr) ? _wfopen(replayFile, W("r")) : nullptr;
+        if (fp != nullptr)
+        {
+            // Two passes: count the lines, then parse them.
+            char line[256];
+            unsigned lineCount = 0;
+            while (fgets(line, sizeof(line), fp) != nullptr)
+            {
+                if (strchr(line, '\n') != nullptr)
+                {
+                    lineCount++;
+                }
+            }
+            lineCount++; // The last line may not end in a newline.
+
+            Decision* decisions = (Decision*)ClrAllocInProcessHeap(0, S_SIZE_T(lineCount) * S_SIZE_T(sizeof(Decision)));
+            unsigned decisionCount = 0;
+            if (decisions != nullptr)
+            {
+                fseek(fp, 0, SEEK_SET);
+                bool atLineStart = true;
+                while (fgets(line, sizeof(line), fp) != nullptr && decisionCount < lineCount)
+                {
+                    // Only the start of a line holds the decision; skip the rest of long lines.
+                    bool lineStart = atLineStart;
+                    atLineStart = (strchr(line, '\n') != nullptr);
+                    if (!lineStart)
+                    {
+                        continue;
+                    }
+
+                    unsigned rootHash, calleeHash, ilOffset, inlined;
+                    if (sscanf(line, "%u,%u,%u,%u", &rootHash, &calleeHash, &ilOffset, &inlined) == 4)
+                    {
+                        Decision* decision   = &decisions[decisionCount++];
+                        decision->rootHash   = rootHash;
+                        decision->calleeHash = calleeHash;
+                        decision->ilOffset   = ilOffset;
+                        decision->inlined    = (inlined != 0);
+                    }
+                }
+                qsort(decisions, decisionCount, sizeof(Decision), CompareDecisions);
+                decisionCount = RemoveDuplicateDecisions(decisions, decisionCount);
+            }
+            fclose(fp);
+
+            s_decisions     = decisions;
+            s_decisionCount = decisionCount;
+        }
+        s_loaded = true;
+    }
+    ClrLeaveCriticalSection(s_replayLock.Val());
+}
+
+#endif // DEBUG
@@ -0,0 +1,168 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+//
+
+/*XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+XX                                                                           XX
+XX                            InlinePolicy                                   XX
+XX                                                                           XX
+XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+
+    The inliner separates the question of whether a candidate CAN be inlined
+    (impCheckCanInline, impCanInlineIL, impInlineInitVars and the importer itself,
+    which reject anything the JIT cannot correctly expand) from whether it SHOULD
+    be inlined.  The latter is delegated to an InlinePolicy, selected by
+    COMPlus_JitInlinePolicy (DEBUG builds only, retail builds use the legacy policy):
+
+        0 - LegacyInlinePolicy: the IL size limit plus the native size estimate
+            and multiplier heuristics of impCanInlineNative.
+        1 - ProfitabilityInlinePolicy: weighs the estimated size growth of the
+            candidate against the benefit expected from the observations made
+            while scanning its IL (constant arguments, branches that fold under
+            them, the frequency of the call site), within a growth budget for
+            each root method.
+        2 - ReplayInlinePolicy: repeats the decisions recorded in the file named
+            by COMPlus_JitInlineReplayFile, falling back to the legacy policy for
+            call sites that are not in the file.
+
+    In DEBUG builds, every inline attempt can be logged to the file named by
+    COMPlus_JitInlineLogFile, one line per attempt, in the format read back by
+    the replay policy:
+
+        rootHash,calleeHash,ilOffset,inlined,policy,ilSize,"callee","reason"
+
+    where the hashes are the EE method hashes of the root method and of the callee,
+    and ilOffset is the IL offset of the call site statement in the root method.
+
+XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+*/
+
+/*****************************************************************************/
+#ifndef _INLINEPOLICY_H_
+#define _INLINEPOLICY_H_
+/*****************************************************************************/
+
+// The observations made about an inline candidate, from which a policy decides
+// whether inlining it is profitable.
+struct InlineObservations
+{
+    unsigned             ilCodeSize;                 // IL size of the candidate
+    unsigned             instrCount;                 // number of IL instructions in the candidate
+    int                  calleeNativeSizeEstimate;   // NATIVE_SIZE_INVALID if the candidate was not estimated
+    int                  callsiteNativeSizeEstimate; // estimated size of the call being replaced
+    InlInlineHints       hints;                      // hints gathered by fgFindJumpTargets
+    unsigned             argCount;                   // number of arguments, including 'this'
+    unsigned             constantArgCount;           // number of arguments that are constants at the call site
+    unsigned             foldableBranchCount;        // conditional branches fed by a constant argument
+
+    // Information about the call site.  hasCallSite is false when computing the
+    // static (ngen) inlining hint for a method, in which case no call site is known.
+    bool                 hasCallSite;
+    bool                 callSiteInLoop;
+    bool                 callSiteRarelyRun;
+    BasicBlock::weight_t callSiteWeight;
+};
+
+class InlinePolicy
+{
+public:
+    enum PolicyKind
+    {
+        POLICY_LEGACY        = 0,
+        POLICY_PROFITABILITY = 1,
+        POLICY_REPLAY        = 2,
+    };
+
+    // The policy selected by COMPlus_JitInlinePolicy.
+    static InlinePolicy*    GetPolicy();
+
+    virtual const char*     GetName() = 0;
+
+    // Candidates with more IL bytes than this are never considered (unless marked
+    // forceinline).  This bounds the cost of scanning candidates.
+    virtual unsigned        MaxInlineILSize() = 0;
+
+    // Decide whether inlining the candidate described by 'obs' is profitable.
+    // 'comp' is the Compiler instance for the candidate when hasCallSite is true,
+    // and the Compiler instance for the method itself otherwise.
+    // Returns INLINE_PASS, or INLINE_FAIL/INLINE_NEVER with a reason.
+    virtual JitInlineResult DetermineProfitability(Compiler* comp, const InlineObservations& obs) = 0;
+
+#ifdef DEBUG
+    // Append the result of an inline attempt to the COMPlus_JitInlineLogFile, if any.
+    static void             LogDecision(Compiler*              rootComp,
+                                        InlineInfo*            inlineInfo,
+                                        const JitInlineResult& result);
+
+    // Close the COMPlus_JitInlineLogFile, at JIT shutdown.
+    static void             CloseLog();
+#endif // DEBUG
+
+protected:
+    static JitInlineResult  MakeResult(Compiler*                 comp,
+                                       const InlineObservations& obs,
+                                       CorInfoInline             decision,
+                                       const char*               reason);
+#ifdef DEBUG
+    static unsigned         CallSiteILOffset(InlineInfo* inlineInfo);
+#endif // DEBUG
+};
+
+class LegacyInlinePolicy : public InlinePolicy
+{
+public:
+    virtual const char*     GetName() { return "legacy"; }
+    virtual unsigned        MaxInlineILSize();
+    virtual JitInlineResult DetermineProfitability(Compiler* comp, const InlineObservations& obs);
+};
+
+// The other policies are only selectable, through COMPlus_JitInlinePolicy, in DEBUG builds.
+#ifdef DEBUG
+
+class ProfitabilityInlinePolicy : public InlinePolicy
+{
+public:
+    virtual const char*     GetName() { return "profitability"; }
+    virtual unsigned        MaxInlineILSize();
+    virtual JitInlineResult DetermineProfitability(Compiler* comp, const InlineObservations& obs);
+
+private:
+    double                  EstimateBenefitMultiplier(Compiler* comp, const InlineObservations& obs);
+};
+
+class ReplayInlinePolicy : public LegacyInlinePolicy
+{
+public:
+    virtual const char*     GetName() { return "replay"; }
+    virtual unsigned        MaxInlineILSize();
+    virtual JitInlineResult DetermineProfitability(Compiler* comp, const InlineObservations& obs);
+
+private:
+    struct Decision
+    {
+        unsigned            rootHash;
+        unsigned            calleeHash;
+        unsigned            ilOffset;
+        bool                inlined;
+    };
+
+    static int __cdecl      CompareDecisions(const void* d1, const void* d2);
+    static unsigned         RemoveDuplicateDecisions(Decision* decisions, unsigned decisionCount);
+    const Decision*         FindDecision(unsigned rootHash, unsigned calleeHash, unsigned ilOffset);
+    void                    EnsureLoaded();
+
+    static CritSecObject    s_replayLock;
+    static Decision*        s_decisions;
+    static unsigned         s_decisionCount;
+    static volatile bool    s_loaded;
+};
+
+#endif // DEBUG
+
+/*****************************************************************************/
+#endif //_INLINEPOLICY_H_
+/*****************************************************************************/
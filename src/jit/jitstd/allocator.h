@@ -194,7 +194,7 @@ void allocator<T>::construct(pointer ptr, const_reference val)
 template <typename T>
 void allocator<T>::deallocate(pointer ptr, size_type size)
 {
-    // m_pAlloc->Free(ptr);
+    m_pAlloc->FreeSized(ptr, sizeof(value_type) * size);
 }
 
 template <typename T>
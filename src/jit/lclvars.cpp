@@ -649,6 +649,15 @@ void                Compiler::lvaInitUserArgs(InitVarDscInfo *      varDscInfo)
 
 #endif // !_TARGET_ARM_
 
+#ifdef FEATURE_UNIX_AMD64_STRUCT_PASSING
+        // Structs of two INTEGER eightbytes take two consecutive integer registers, or two stack
+        // slots if fewer than two registers are left. Later arguments can still use the registers.
+        if (argType == TYP_STRUCT && cSlots == 2)
+        {
+            varDsc->lvIsMultiRegArg = 1;
+        }
+#endif // FEATURE_UNIX_AMD64_STRUCT_PASSING
+
         if (varDscInfo->canEnreg(argType, cSlotsToEnregister))
         {
             /* Another register argument */
@@ -671,6 +680,13 @@ void                Compiler::lvaInitUserArgs(InitVarDscInfo *      varDscInfo)
             varDsc->lvArgReg = genMapRegArgNumToRegNum(firstAllocatedRegArgNum, argType);
             varDsc->setPrefReg(varDsc->lvArgReg, this);
 
+#ifdef FEATURE_UNIX_AMD64_STRUCT_PASSING
+            if (varDsc->lvIsMultiRegArg)
+            {
+                varDsc->lvOtherArgReg = genMapRegArgNumToRegNum(firstAllocatedRegArgNum + 1, TYP_I_IMPL);
+            }
+#endif // FEATURE_UNIX_AMD64_STRUCT_PASSING
+
 #ifdef _TARGET_ARM_
             if (varDsc->TypeGet() == TYP_LONG)
             {
@@ -4117,7 +4133,9 @@ int Compiler::lvaAssignVirtualFrameOffsetToArg(unsigned lclNum, unsigned argSize
         /* Argument is passed in a register, don't count it
          * when updating the current offset on the stack */
 
-#ifndef _TARGET_ARM_
+#if defined(FEATURE_UNIX_AMD64_STRUCT_PASSING)
+        noway_assert(argSize == (varDsc->lvIsMultiRegArg ? 2 : 1) * sizeof(void *));
+#elif !defined(_TARGET_ARM_)
         noway_assert(argSize == sizeof(void *));
 #endif
 
@@ -4130,7 +4148,7 @@ int Compiler::lvaAssignVirtualFrameOffsetToArg(unsigned lclNum, unsigned argSize
         {
             // The offset for args needs to be set only for the stack homed arguments for System V.
             varDsc->lvStkOffs = argOffs;
-            argOffs += sizeof(void *);
+            argOffs += argSize;
         }
 #ifdef UNIX_AMD64_ABI
         else 
@@ -4341,7 +4359,8 @@ int Compiler::lvaAssignVirtualFrameOffsetToArg(unsigned lclNum, unsigned argSize
         // The last two requirements are met in lvaFixVirtualFrameOffsets method, which fixes the offsets, based on frame pointer existence, 
         // existence of alloca instructions, ret address pushed, ets.
         varDsc->lvStkOffs = *callerArgOffset;
-        *callerArgOffset += TARGET_POINTER_SIZE;
+        // Structs passed by value take as many slots as their size; everything else takes one.
+        *callerArgOffset += argSize;
 #else // !UNIX_AMD64_ABI
         varDsc->lvStkOffs = argOffs;
 #endif // !UNIX_AMD64_ABI
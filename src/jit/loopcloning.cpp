@@ -112,11 +112,12 @@ GenTreePtr LC_Expr::ToGenTree(Compiler* comp)
     case Ident:
         return ident.ToGenTree(comp);
     case IdentPlusConst:
-#ifdef _TARGET_64BIT_
-        return comp->gtNewOperNode(GT_ADD, TYP_LONG, ident.ToGenTree(comp), comp->gtNewLconNode(constant));
-#else
-        return comp->gtNewOperNode(GT_ADD, TYP_INT, ident.ToGenTree(comp), comp->gtNewIconNode((ssize_t) constant));
-#endif
+        {
+            // Add the constant in the type of the ident, so that "a.len + c" stays an int.
+            GenTreePtr identTree = ident.ToGenTree(comp);
+            return comp->gtNewOperNode(GT_ADD, identTree->TypeGet(), identTree,
+                                       comp->gtNewIconNode((ssize_t) constant, identTree->TypeGet()));
+        }
     default:
         assert(!"Could not convert LC_Expr to GenTree");
         unreached();
@@ -152,6 +153,21 @@ GenTreePtr LC_Condition::ToGenTree(Compiler* comp)
 //
 bool LC_Condition::Evaluates(bool* pResult)
 {
+    // "x + c1 relop x + c2" is decided by the constants alone.
+    if (op1.ident == op2.ident && !(op1 == op2))
+    {
+        INT64 c1 = op1.GetConstant();
+        INT64 c2 = op2.GetConstant();
+        switch (oper)
+        {
+        case GT_LT: *pResult = (c1 <  c2); return true;
+        case GT_LE: *pResult = (c1 <= c2); return true;
+        case GT_GT: *pResult = (c1 >  c2); return true;
+        case GT_GE: *pResult = (c1 >= c2); return true;
+        default:    break;
+        }
+    }
+
     switch (oper)
     {
     case GT_EQ:
@@ -193,6 +209,9 @@ bool LC_Condition::Evaluates(bool* pResult)
 // Operation:
 //      Check if both conditions are equal. If so, return just 1 of them.
 //      Reverse their operators and check if their reversed operands match. If so, return either of them.
+//      If both compare the same expression against the same ident plus different constants, return the
+//      stronger one: "n <= a.len + (-2)" implies "n <= a.len", and "i >= 1" implies "i >= 0". This is how
+//      the accesses a[i], a[i + 1] and a[i + 2] in a loop end up needing a single check of a.len.
 //
 // Notes:
 //      This is not a full-fledged expression optimizer, it is supposed
@@ -213,6 +232,30 @@ bool LC_Condition::Combines(const LC_Condition& cond, LC_Condition* newCond)
         *newCond = *this;
         return true;
     }
+    else if ((oper == GT_LT || oper == GT_LE || oper == GT_GT || oper == GT_GE) &&
+            oper == cond.oper && op1 == cond.op1)
+    {
+        // The bounds are comparable if they are the same ident plus constants, or both constants.
+        INT64 c1, c2;
+        if (op2.ident == cond.op2.ident)
+        {
+            c1 = op2.GetConstant();
+            c2 = cond.op2.GetConstant();
+        }
+        else if (op2.ident.type == LC_Ident::Const && cond.op2.ident.type == LC_Ident::Const)
+        {
+            c1 = op2.ident.constant + op2.GetConstant();
+            c2 = cond.op2.ident.constant + cond.op2.GetConstant();
+        }
+        else
+        {
+            return false;
+        }
+        bool upperBound = (oper == GT_LT || oper == GT_LE);
+        bool thisStronger = upperBound ? (c1 <= c2) : (c1 >= c2);
+        *newCond = thisStronger ? *this : cond;
+        return true;
+    }
     return false;
 }
 
@@ -28,6 +28,10 @@ XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
           For ex: to clone a simple "for (i=0; i<n; ++i) { a[i] }" loop, we need the 
           following conditions:
               (a != null) && ((n >= 0) & (n <= a.length) & (stride > 0))
+          An index that is the iter var plus a constant, like a[i + 1], or a local
+          set to one earlier in the iteration ("j = i + 1; a[j]"), is handled by
+          offsetting the limit check: (n <= a.length - 1). The conditions for several
+          such accesses to the same array are combined into the tightest one.
               a) Note the short circuit AND for (a != null). These are called block
               conditions or deref-conditions since these conditions need to be in their
               own blocks to be able to short-circuit.
@@ -102,6 +106,7 @@ struct ArrIndex
 {
     unsigned arrLcl;                        // The array base local num
     ExpandArrayStack<unsigned> indLcls;     // The indices local nums
+    ExpandArrayStack<int> indOffs;          // The constants added to the indices, as in a[i + 1]
     ExpandArrayStack<GenTree*> bndsChks;    // The bounds checks nodes along each dimension.
     unsigned rank;                          // Rank of the array
     BasicBlock* useBlock;                   // Block where the [] occurs
@@ -109,6 +114,7 @@ struct ArrIndex
     ArrIndex(IAllocator* alloc)
         : arrLcl(BAD_VAR_NUM)
         , indLcls(alloc)
+        , indOffs(alloc)
         , bndsChks(alloc)
         , rank(0)
         , useBlock(nullptr)
@@ -120,7 +126,14 @@ struct ArrIndex
         printf("V%02d", arrLcl);
         for (unsigned i = 0; i < ((dim == -1) ? rank : dim); ++i)
         {
-            printf("[V%02d]", indLcls.GetRef(i));
+            if (indOffs.GetRef(i) != 0)
+            {
+                printf("[V%02d%+d]", indLcls.GetRef(i), indOffs.GetRef(i));
+            }
+            else
+            {
+                printf("[V%02d]", indLcls.GetRef(i));
+            }
         }
     }
 #endif
@@ -217,12 +230,15 @@ struct LcJaggedArrayOptInfo : public LcOptInfo
                                    //    then this node is treated as though it were a[i][j]
     ArrIndex arrIndex;             // ArrIndex representation of the array.
     GenTreePtr stmt;               // "stmt" where the optimization opportunity occurs.
+    int offset;                    // The index on "dim" is the loop iter var plus "offset", either directly
+                                   //    (a[i + 1]) or through a local assigned from it (j = i + 1; a[j]).
 
-    LcJaggedArrayOptInfo(ArrIndex& arrIndex, unsigned dim, GenTreePtr stmt)
+    LcJaggedArrayOptInfo(ArrIndex& arrIndex, unsigned dim, GenTreePtr stmt, int offset)
         : LcOptInfo(this, LcJaggedArray)
         , dim(dim)
         , arrIndex(arrIndex)
-        , stmt(stmt) {}
+        , stmt(stmt)
+        , offset(offset) {}
 };
 
 /**
@@ -419,14 +435,20 @@ struct LC_Expr
         return (ident == that.ident);
     }
 
+    // The constant added to the ident, 0 if there is none.
+    INT64 GetConstant() const
+    {
+        return (type == IdentPlusConst) ? constant : 0;
+    }
+
 #ifdef DEBUG
     void Print()
     {
         if (type == IdentPlusConst)
         {
-            printf("(%I64d - ", constant);
+            printf("(");
             ident.Print();
-            printf(")");
+            printf(" + %I64d)", constant);
         }
         else
         {
@@ -439,6 +461,12 @@ struct LC_Expr
     explicit LC_Expr(const LC_Ident& ident) : ident(ident), type(Ident) {}
     LC_Expr(const LC_Ident& ident, INT64 constant) : ident(ident), constant(constant), type(IdentPlusConst) {}
 
+    // "ident + constant", or just "ident" if the constant is 0, so that the two compare equal.
+    static LC_Expr Offset(const LC_Ident& ident, INT64 constant)
+    {
+        return (constant == 0) ? LC_Expr(ident) : LC_Expr(ident, constant);
+    }
+
     // Convert LC_Expr into a tree node.
     GenTreePtr ToGenTree(Compiler* comp);
 };
@@ -468,7 +496,8 @@ struct LC_Condition
     // condition could not be evaluated.
     bool Evaluates(bool* pResult);
 
-    // Check if two conditions can be combined to yield one condition.
+    // Check if two conditions can be combined to yield one condition, either because they are the same
+    // or because one implies the other (i <= a.len - 2 implies i <= a.len - 1).
     bool Combines(const LC_Condition& cond, LC_Condition* newCond);
 
     LC_Condition() {}
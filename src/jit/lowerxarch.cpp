@@ -1047,17 +1047,21 @@ void Lowering::TreeNodeInfoInit(GenTree* stmt)
             //    this threshold is because our last investigation (Fall 2013), more than 95% of initblks 
             //    in our framework assemblies are actually <= INITBLK_UNROLL_LIMIT bytes size, so this is the
             //    preferred code sequence for the vast majority of cases.
+            //    With AVX, zero fills up to INITBLK_AVX_UNROLL_LIMIT bytes are unrolled using 32-byte stores.
+
+            bool isZeroFill = initVal->IsCnsIntOrI() && (initVal->gtIntCon.gtIconVal == 0);
+            ssize_t unrollLimit = comp->getInitBlkUnrollLimit(isZeroFill);
 
             // This threshold will decide from using the helper or let the JIT decide to inline
             // a code sequence of its choice.
-            ssize_t helperThreshold = max(INITBLK_STOS_LIMIT, INITBLK_UNROLL_LIMIT);
+            ssize_t helperThreshold = max((ssize_t)INITBLK_STOS_LIMIT, unrollLimit);
 
             if (blockSize->IsCnsIntOrI() && blockSize->gtIntCon.gtIconVal <= helperThreshold)
             {
                 ssize_t size = blockSize->gtIntCon.gtIconVal;
 
                 // Always favor unrolling vs rep stos.
-                if (size <= INITBLK_UNROLL_LIMIT && initVal->IsCnsIntOrI())
+                if (size <= unrollLimit && initVal->IsCnsIntOrI())
                 {
                     // Replace the integer constant in initVal 
                     // to fill an 8-byte word with the fill value of the InitBlk
@@ -1233,9 +1237,12 @@ void Lowering::TreeNodeInfoInit(GenTree* stmt)
             // In case of a CpBlk with a constant size and less than CPBLK_MOVS_LIMIT size
             // we can use rep movs to generate code instead of the helper call.
 
+            // With AVX, sizes up to CPBLK_AVX_UNROLL_LIMIT bytes are unrolled using 32-byte moves.
+            ssize_t unrollLimit = comp->getCpBlkUnrollLimit();
+
             // This threshold will decide from using the helper or let the JIT decide to inline
             // a code sequence of its choice.
-            ssize_t helperThreshold = max(CPBLK_MOVS_LIMIT, CPBLK_UNROLL_LIMIT);
+            ssize_t helperThreshold = max((ssize_t)CPBLK_MOVS_LIMIT, unrollLimit);
 
             // TODO-X86-CQ: The helper call either is not supported on x86 or required more work
             // (I don't know which).
@@ -1249,7 +1256,7 @@ void Lowering::TreeNodeInfoInit(GenTree* stmt)
                 // If we have a buffer between XMM_REGSIZE_BYTES and CPBLK_UNROLL_LIMIT bytes, we'll use SSE2. 
                 // Structs and buffer with sizes <= CPBLK_UNROLL_LIMIT bytes are occurring in more than 95% of
                 // our framework assemblies, so this is the main code generation scheme we'll use.
-                if (size <= CPBLK_UNROLL_LIMIT)
+                if (size <= unrollLimit)
                 {
                     MakeSrcContained(tree, blockSize);
                     
@@ -1840,7 +1847,15 @@ Lowering::TreeNodeInfoInitSIMD(GenTree* tree, LinearScan* lsra)
         break;
 
     case SIMDIntrinsicDotProduct:
-        if ((comp->getSIMDInstructionSet() == InstructionSet_SSE2) || (simdTree->gtOp.gtOp1->TypeGet() == TYP_SIMD32))
+        if (varTypeIsIntegral(simdTree->gtSIMDBaseType))
+        {
+            // Integer dot product (AVX2 only) computes into xmm scratch registers and
+            // moves the final sum into the integer target register.
+            // See genSIMDIntrinsicDotProduct() for details.
+            info->internalFloatCount = 2;
+            info->setInternalCandidates(lsra, lsra->allSIMDRegs());
+        }
+        else if ((comp->getSIMDInstructionSet() == InstructionSet_SSE2) || (simdTree->gtOp.gtOp1->TypeGet() == TYP_SIMD32))
         {
             // For SSE, or AVX with 32-byte vectors, we also need an internal register as scratch.
             // Further we need the targetReg and internal reg to be distinct registers.
@@ -7086,6 +7086,10 @@ LinearScan::resolveRegisters()
                 break;
             }
             updateMaxSpill(currentRefPosition);
+            if (currentRefPosition->reload || currentRefPosition->spillAfter)
+            {
+                compiler->lsraSpillCount++;
+            }
             GenTree *treeNode = currentRefPosition->treeNode;
 
 #ifdef FEATURE_SIMD
@@ -7733,6 +7737,7 @@ LinearScan::addResolution(BasicBlock* block,
     insertMove(block, insertionPoint, interval->varNum, fromReg, toReg);
     if (fromReg == REG_STK || toReg == REG_STK) interval->isSpilled = true;
     else interval->isSplit = true;
+    compiler->lsraResolutionMoveCount++;
 }
 
 //------------------------------------------------------------------------
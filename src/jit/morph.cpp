@@ -2480,6 +2480,11 @@ GenTreeCall* Compiler::fgMorphArgs(GenTreeCall* callNode)
     }
     else
     {
+#ifdef FEATURE_UNIX_AMD64_STRUCT_PASSING
+        // Pass the two halves of small integer structs as separate arguments.
+        fgSplitRegPassedStructArgs(call);
+#endif // FEATURE_UNIX_AMD64_STRUCT_PASSING
+
         // First we need to count the args
         unsigned numArgs = 0;
         if (call->gtCallObjp)
@@ -2714,6 +2719,11 @@ GenTreeCall* Compiler::fgMorphArgs(GenTreeCall* callNode)
 
 #endif // _TARGET_ARM_
 
+#ifdef FEATURE_UNIX_AMD64_STRUCT_PASSING
+    // Set when the first half of a struct went to the stack, so that the second half follows it.
+    bool structPairOnStack = false;
+#endif // FEATURE_UNIX_AMD64_STRUCT_PASSING
+
     for (args = call->gtCallArgs; args; args = args->gtOp.gtOp2)
     {
         GenTreePtr * parentArgx = &args->gtOp.gtOp1;
@@ -3199,6 +3209,19 @@ GenTreeCall* Compiler::fgMorphArgs(GenTreeCall* callNode)
                 else
                 {
                     isRegArg = intArgRegNum < MAX_REG_ARG;
+#ifdef FEATURE_UNIX_AMD64_STRUCT_PASSING
+                    // The two eightbytes of a struct go either both in registers or both on the stack.
+                    if (args->gtFlags & GTF_LIST_STRUCT_PAIR)
+                    {
+                        isRegArg = (intArgRegNum + 2) <= MAX_REG_ARG;
+                        structPairOnStack = !isRegArg;
+                    }
+                    else if (structPairOnStack)
+                    {
+                        isRegArg = false;
+                        structPairOnStack = false;
+                    }
+#endif // FEATURE_UNIX_AMD64_STRUCT_PASSING
                 }
 #else // !defined(UNIX_AMD64_ABI)
                 isRegArg = intArgRegNum < maxRegArgs;
@@ -3538,6 +3561,113 @@ GenTreeCall* Compiler::fgMorphArgs(GenTreeCall* callNode)
 #pragma warning(pop)
 #endif
 
+#ifdef FEATURE_UNIX_AMD64_STRUCT_PASSING
+//------------------------------------------------------------------------
+// fgSplitRegPassedStructArgs: Replace each struct argument that the System V AMD64 ABI passes
+//    in two integer registers by two arguments, one per eightbyte.
+//
+// Arguments:
+//    call - the call whose arguments have not been morphed yet
+//
+// Notes:
+//    The list node of the first half is marked with GTF_LIST_STRUCT_PAIR, so that fgMorphArgs
+//    places both halves in registers or both on the stack.  The halves are read as fields of
+//    the source local when there is one, and of a temp copy of the struct otherwise; the copy is
+//    done by the first half, which makes fgArgInfo evaluate it before the second half is read.
+//
+void                Compiler::fgSplitRegPassedStructArgs(GenTreeCall* call)
+{
+    for (GenTreePtr args = call->gtCallArgs; args != nullptr; args = args->gtOp.gtOp2)
+    {
+        GenTreePtr argx = args->Current();
+        if (argx->TypeGet() != TYP_STRUCT)
+            continue;
+
+        GenTreePtr ldObj = argx;
+        while (ldObj->gtOper == GT_COMMA)
+            ldObj = ldObj->gtOp.gtOp2;
+
+        unsigned hiSize;
+        if (ldObj->gtOper != GT_LDOBJ || !eeIsRegPassedStruct(ldObj->gtLdObj.gtClass, &hiSize))
+            continue;
+
+        CORINFO_CLASS_HANDLE clsHnd = ldObj->gtLdObj.gtClass;
+        GenTreePtr addr = ldObj->gtOp.gtOp1;
+        GenTreePtr copyBlk = nullptr;
+        unsigned lclNum;
+
+        // Implicit byref parameters have been retyped to TYP_BYREF and are copied like any other address.
+        if (addr->gtOper == GT_ADDR &&
+            addr->gtOp.gtOp1->gtOper == GT_LCL_VAR &&
+            lvaTable[addr->gtOp.gtOp1->gtLclVarCommon.gtLclNum].TypeGet() == TYP_STRUCT)
+        {
+            lclNum = addr->gtOp.gtOp1->gtLclVarCommon.gtLclNum;
+        }
+        else
+        {
+            // Here We don't need unsafe value cls check, since the addr of this temp is used only in copyblk.
+            lclNum = lvaGrabTemp(true DEBUGARG("split struct argument"));
+            lvaSetStruct(lclNum, clsHnd, false);
+
+            GenTreePtr dest = gtNewLclvNode(lclNum, TYP_STRUCT);
+            dest->gtFlags |= (GTF_DONT_CSE | GTF_VAR_DEF);  // This is a def of the local, "entire" by construction.
+            dest = gtNewOperNode(GT_ADDR, TYP_I_IMPL, dest);
+            copyBlk = gtNewCpObjNode(dest, addr, clsHnd, false);
+        }
+
+        // The halves are read as fields, so the local has to live on the frame.
+        lvaSetVarDoNotEnregister(lclNum DEBUG_ARG(DNER_LocalField));
+
+        // Pick the types the same way fgMakeTmpArgNode does for structs passed in one register.
+        BYTE* gcLayout = lvaGetGcLayout(lclNum);
+        var_types partTypes[2];
+        for (unsigned i = 0; i < 2; i++)
+        {
+            switch (gcLayout[i])
+            {
+            case TYPE_GC_REF:   partTypes[i] = TYP_REF;    break;
+            case TYPE_GC_BYREF: partTypes[i] = TYP_BYREF;  break;
+            default:            partTypes[i] = TYP_I_IMPL; break;
+            }
+        }
+        // The size of the second half comes from the VM, so that both sides agree on it.  The VM only
+        // passes structs whose tail is 1, 2, 4 or 8 bytes in registers; for any other size read the
+        // whole slot, which the frame allocation of the local (rounded up to a pointer) covers.
+        switch (hiSize)
+        {
+        case 1: partTypes[1] = TYP_BYTE;  break;
+        case 2: partTypes[1] = TYP_SHORT; break;
+        case 4: partTypes[1] = TYP_INT;   break;
+        default:
+            assert(hiSize == TARGET_POINTER_SIZE);
+            break;
+        }
+
+        GenTreePtr lo = gtNewLclFldNode(lclNum, partTypes[0], 0);
+        GenTreePtr hi = gtNewLclFldNode(lclNum, partTypes[1], TARGET_POINTER_SIZE);
+        if (copyBlk != nullptr)
+        {
+            lo = gtNewOperNode(GT_COMMA, partTypes[0], copyBlk, lo);
+        }
+
+        // Replace the LDOBJ at the end of the COMMA chain by the first half.
+        GenTreePtr* use = &args->gtOp.gtOp1;
+        while ((*use)->gtOper == GT_COMMA)
+        {
+            (*use)->gtType = partTypes[0];
+            use = &(*use)->gtOp.gtOp2;
+        }
+        *use = lo;
+
+        args->gtOp.gtOp2 = gtNewListNode(hi, args->gtOp.gtOp2);
+        args->gtFlags |= GTF_LIST_STRUCT_PAIR;
+
+        // Skip the second half.
+        args = args->gtOp.gtOp2;
+    }
+}
+#endif // FEATURE_UNIX_AMD64_STRUCT_PASSING
+
 // Make a copy of a struct variable if necessary, to pass to a callee.
 // returns: tree that computes address of the outgoing arg
 void
@@ -13250,7 +13380,15 @@ void Compiler::fgExpandQmarkForCastInstOf(BasicBlock* block, GenTreePtr stmt)
     asgBlock->inheritWeight(block);
     cond1Block->inheritWeight(block);
     cond2Block->inheritWeightPercentage(cond1Block, 50);
-    helperBlock->inheritWeightPercentage(cond2Block, 50);
+    if (qmark->gtFlags & GTF_QMARK_CAST_FAIL_RARE)
+    {
+        // The helper only throws InvalidCastException.
+        helperBlock->bbSetRunRarely();
+    }
+    else
+    {
+        helperBlock->inheritWeightPercentage(cond2Block, 50);
+    }
 
     // Append cond1 as JTRUE to cond1Block
     GenTreePtr jmpTree = gtNewOperNode(GT_JTRUE, TYP_VOID, condExpr);
@@ -14085,6 +14223,12 @@ void                Compiler::fgMarkImplicitByRefArgs()
         {
             size_t size;
 
+#ifdef FEATURE_UNIX_AMD64_STRUCT_PASSING
+            // Structs passed in two registers arrive by value.
+            if (varDsc->lvIsMultiRegArg)
+                continue;
+#endif // FEATURE_UNIX_AMD64_STRUCT_PASSING
+
             if (varDsc->lvSize() > REGSIZE_BYTES)
             {
                 size = varDsc->lvSize();
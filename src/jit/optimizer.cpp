@@ -3693,8 +3693,9 @@ void                Compiler::optOptimizeLoops()
 //     for each optimization candidate. Checks if the loop stride is "> 0" if the loop
 //     condition is "less than". If the initializer is "var" init then adds condition
 //     "var >= 0", and if the loop is var limit then, "var >= 0" and "var <= a.len"
-//     are added to "context". These conditions are checked in the pre-header block
-//     and the cloning choice is made.
+//     are added to "context". An index "i + c" needs "limit <= a.len - c" instead, and
+//     "var >= -c" when c is negative. These conditions are checked in the pre-header
+//     block and the cloning choice is made.
 //
 // Assumption:
 //      Callers should assume AND operation is used i.e., if all conditions are
@@ -3791,14 +3792,35 @@ bool                Compiler::optDeriveLoopCloningConditions(unsigned loopNum, L
             {
             case LcOptInfo::LcJaggedArray:
                 {
-                    // limit <= arrLen
+                    // limit <= arrLen - offset, or limit <= arrLen for a negative offset.
                     LcJaggedArrayOptInfo* arrIndexInfo = optInfo->AsLcJaggedArrayOptInfo();
                     LC_Array arrLen(LC_Array::Jagged, &arrIndexInfo->arrIndex, arrIndexInfo->dim, LC_Array::ArrLen);
                     LC_Ident arrLenIdent = LC_Ident(arrLen);
+                    int offset = arrIndexInfo->offset;
 
-                    LC_Condition cond(GT_LE, LC_Expr(ident), LC_Expr(arrLenIdent));
+                    LC_Condition cond(GT_LE, LC_Expr(ident), LC_Expr::Offset(arrLenIdent, (offset > 0) ? -offset : 0));
+
+                    // "a.len <= a.len - 1" for a[i + 1] in a loop up to a.len: the fast path could never
+                    // be taken, so leave the bounds check of this access alone rather than the whole loop.
+                    bool result;
+                    if (cond.Evaluates(&result) && !result)
+                    {
+                        JITDUMP("> Offset %d is out of range for the loop limit, access not optimized\n", offset);
+                        optInfos->Remove(i);
+                        --i;
+                        continue;
+                    }
                     context->EnsureConditions(loopNum)->Push(cond);
 
+                    // initVar >= -offset
+                    if (offset < 0 && (loop->lpFlags & LPFLG_VAR_INIT))
+                    {
+                        LC_Condition geOffset(GT_GE,
+                               LC_Expr(LC_Ident(loop->lpVarInit, LC_Ident::Var)),
+                               LC_Expr(LC_Ident(-offset, LC_Ident::Const)));
+                        context->EnsureConditions(loopNum)->Push(geOffset);
+                    }
+
                     // Ensure that this array must be dereference-able, before executing the actual condition.
                     LC_Array array(LC_Array::Jagged, &arrIndexInfo->arrIndex, arrIndexInfo->dim, LC_Array::None);
                     context->EnsureDerefs(loopNum)->Push(array);
@@ -3823,6 +3845,11 @@ bool                Compiler::optDeriveLoopCloningConditions(unsigned loopNum, L
                 return false;
             }
         }
+        if (optInfos->Size() == 0)
+        {
+            JITDUMP("> No accesses left to optimize\n");
+            return false;
+        }
         JITDUMP("Conditions: (");
         DBEXEC(verbose, context->PrintConditions(loopNum));
         JITDUMP(")\n");
@@ -4607,6 +4634,542 @@ void Compiler::optEnsureUniqueHead(unsigned loopInd, unsigned ambientWeight)
     optUpdateLoopHead(loopInd, optLoopTable[loopInd].lpHead, h2); 
 }
 
+#ifdef FEATURE_SIMD
+
+//--------------------------------------------------------------------------------------------------
+// optVectorizeLoops - Rewrite simple counted loops over primitive arrays into SIMD loops.
+//
+// Operation:
+//      Runs after loop cloning, so the candidates are fast path loops whose bounds checks were
+//      removed under the cloning conditions (init >= 0 and limit <= a.Length for every array
+//      indexed by the iterator).  A single block loop of the form
+//
+//          do { a[i] = b[i] op c[i]; i++; } while (i < limit);
+//
+//      becomes
+//
+//          if (limit - i < VL) goto scalarHead;                    // vecGuard
+//          do { a[i..] = b[i..] op c[i..]; i += VL; }              // vecBody
+//          while (limit - i >= VL);
+//          if (i >= limit) goto exit;                              // vecExit
+//      scalarHead:
+//          do { a[i] = b[i] op c[i]; i++; } while (i < limit);     // original loop, now the epilogue
+//
+//      where VL is the number of elements in a SIMD register.  Every array element must be indexed
+//      by the iterator itself, so each lane only ever touches its own element and the rewrite stays
+//      correct even if two of the arrays are the same object.
+//
+//      The guards compare limit - i rather than i + VL, which could overflow when limit is close
+//      to INT_MAX; i and limit are both non-negative under the cloning conditions.
+//
+//      Off unless COMPlus_JitVectorizeLoops is set; in DEBUG builds COMPlus_JitReportVectorizedLoops
+//      prints one line per loop considered.
+//
+void                Compiler::optVectorizeLoops()
+{
+    JITDUMP("\n*************** In optVectorizeLoops()\n");
+
+    static ConfigDWORD fJitVectorizeLoops;
+    if (!featureSIMD || optLoopCount == 0 || fJitVectorizeLoops.val(CLRConfig::INTERNAL_JitVectorizeLoops) == 0)
+    {
+        return;
+    }
+
+#ifdef DEBUG
+    static ConfigDWORD fJitReportVectorizedLoops;
+    bool report = (fJitReportVectorizedLoops.val(CLRConfig::INTERNAL_JitReportVectorizedLoops) != 0);
+#endif // DEBUG
+
+    for (unsigned lnum = 0; lnum < optLoopCount; lnum++)
+    {
+        var_types   baseType = TYP_UNDEF;
+        const char* reason   = nullptr;
+        bool        vectorized = optVectorizeLoop(lnum, &baseType, &reason);
+
+        if (vectorized)
+        {
+            JITDUMP("Vectorized loop L%02u, base type %s\n", lnum, varTypeName(baseType));
+        }
+        else
+        {
+            JITDUMP("Did not vectorize loop L%02u: %s\n", lnum, reason);
+        }
+
+#ifdef DEBUG
+        if (report)
+        {
+            const char* className  = nullptr;
+            const char* methodName = eeGetMethodName(info.compMethodHnd, &className);
+            if (vectorized)
+            {
+                printf("Vectorized loop L%02u in %s:%s (%d x %u-byte %s)\n",
+                       lnum, className, methodName,
+                       getSIMDVectorLength(getSIMDVectorRegisterByteLength(), baseType),
+                       genTypeSize(baseType),
+                       varTypeIsFloating(baseType) ? "float" : "int");
+            }
+            else
+            {
+                printf("Did not vectorize loop L%02u in %s:%s: %s\n", lnum, className, methodName, reason);
+            }
+        }
+#endif // DEBUG
+    }
+
+#ifdef DEBUG
+    if (verbose)
+    {
+        printf("\nAfter loop vectorization:\n");
+        fgDispBasicBlocks(/*dumpTrees*/true);
+    }
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+// optVectorizeLoop - Try to vectorize loop "loopNum" as described in optVectorizeLoops.
+//
+// Arguments:
+//      loopNum     the loop index
+//      pBaseType   [out] the element type of the vectorized loop
+//      pReason     [out] why the loop was rejected
+//
+// Return Values:
+//      True if the loop was vectorized; the flow graph has been updated in that case.
+//
+bool                Compiler::optVectorizeLoop(unsigned loopNum, var_types* pBaseType, const char** pReason)
+{
+    LoopDsc* loop = &optLoopTable[loopNum];
+
+    if ((loop->lpFlags & LPFLG_REMOVED) != 0)
+    {
+        *pReason = "removed";
+        return false;
+    }
+    if ((loop->lpFlags & LPFLG_ITER) == 0)
+    {
+        *pReason = "not an iterator loop";
+        return false;
+    }
+
+    BasicBlock* head = loop->lpHead;
+    BasicBlock* body = loop->lpFirst;
+    if (body != loop->lpTop || body != loop->lpEntry || body != loop->lpBottom ||
+        body->bbJumpKind != BBJ_COND || body->bbJumpDest != body || body->bbNext == nullptr)
+    {
+        *pReason = "not a single block do-while loop";
+        return false;
+    }
+    if (head->bbNext != body || (head->bbJumpKind != BBJ_NONE && head->bbJumpKind != BBJ_COND) ||
+        !fgDominate(head, body) || !BasicBlock::sameEHRegion(head, body))
+    {
+        *pReason = "no unique loop head";
+        return false;
+    }
+    // The new blocks go between the head and the loop, so they must end up in the parent loop.
+    if (loop->lpParent != BasicBlock::NOT_IN_LOOP && !optLoopTable[loop->lpParent].lpContains(head))
+    {
+        *pReason = "head is outside the parent loop";
+        return false;
+    }
+
+    if ((loop->lpIterOper() != GT_ADD && loop->lpIterOper() != GT_ASG_ADD) || loop->lpIterConst() != 1)
+    {
+        *pReason = "iterator is not incremented by one";
+        return false;
+    }
+    if (loop->lpIsReversed() || loop->lpTestOper() != GT_LT)
+    {
+        *pReason = "loop test is not 'i < limit'";
+        return false;
+    }
+
+    unsigned ivLclNum = loop->lpIterVar();
+    if (lvaTable[ivLclNum].TypeGet() != TYP_INT || lvaVarAddrExposed(ivLclNum))
+    {
+        *pReason = "unsupported iterator";
+        return false;
+    }
+
+    GenTreePtr limit = loop->lpLimit();
+    if ((loop->lpFlags & LPFLG_VAR_LIMIT) != 0)
+    {
+        if (!optIsStackLocalInvariant(loopNum, limit->gtLclVarCommon.gtLclNum))
+        {
+            *pReason = "limit is not invariant";
+            return false;
+        }
+    }
+    else if ((loop->lpFlags & LPFLG_ARRLEN_LIMIT) != 0)
+    {
+        if (limit->gtOper != GT_ARR_LENGTH || limit->gtGetOp1()->gtOper != GT_LCL_VAR ||
+            !optIsStackLocalInvariant(loopNum, limit->gtGetOp1()->gtLclVarCommon.gtLclNum))
+        {
+            *pReason = "limit is not invariant";
+            return false;
+        }
+    }
+    else if ((loop->lpFlags & LPFLG_CONST_LIMIT) == 0)
+    {
+        *pReason = "unsupported limit";
+        return false;
+    }
+
+    // Every statement but the iterator update and the loop test must be a store to an element of
+    // an array indexed by the iterator; build the vector form of each as we go.
+    unsigned               simdSize = getSIMDVectorRegisterByteLength();
+    var_types              baseType = TYP_UNDEF;
+    ArrayStack<GenTreePtr> vecStores(this);
+    GenTreeStmt*           testStmt = body->lastStmt();
+    bool                   sawIter  = false;
+
+    for (GenTreePtr stmt = body->bbTreeList; stmt != nullptr; stmt = stmt->gtNext)
+    {
+        GenTreePtr expr = stmt->gtStmt.gtStmtExpr;
+        if (stmt == testStmt)
+        {
+            if (expr->gtOper != GT_JTRUE || expr->gtGetOp1() != loop->lpTestTree)
+            {
+                *pReason = "unexpected loop test";
+                return false;
+            }
+            continue;
+        }
+        if (expr == loop->lpIterTree)
+        {
+            sawIter = true;
+            continue;
+        }
+        if (sawIter)
+        {
+            *pReason = "statement after the iterator update";
+            return false;
+        }
+        if (expr->gtOper != GT_ASG)
+        {
+            *pReason = "statement is not an assignment";
+            return false;
+        }
+
+        unsigned   arrLclNum;
+        GenTreePtr dst = expr->gtGetOp1();
+        if (!optIsVectorizableArrElem(dst, loopNum, ivLclNum, &arrLclNum))
+        {
+            *pReason = "store is not to an array element indexed by the iterator";
+            return false;
+        }
+        if (baseType == TYP_UNDEF)
+        {
+            baseType = dst->TypeGet();
+        }
+        else if (dst->TypeGet() != baseType)
+        {
+            *pReason = "mixed element types";
+            return false;
+        }
+
+        GenTreePtr vecValue = optVectorizeTree(expr->gtGetOp2(), loopNum, ivLclNum, baseType, simdSize);
+        if (vecValue == nullptr)
+        {
+            *pReason = "stored value cannot be vectorized";
+            return false;
+        }
+
+        GenTreePtr dstAddr = new (this, GT_LEA) GenTreeAddrMode(TYP_BYREF,
+                                                                gtNewLclvNode(arrLclNum, TYP_REF),
+                                                                gtNewLclvNode(ivLclNum, TYP_INT),
+                                                                genTypeSize(baseType),
+                                                                offsetof(CORINFO_Array, u1Elems));
+        GenTreePtr store = gtNewBlkOpNode(GT_COPYBLK,
+                                          dstAddr,
+                                          gtNewOperNode(GT_ADDR, TYP_BYREF, vecValue),
+                                          gtNewIconNode(simdSize),
+                                          false);
+        store->gtFlags |= ((vecValue->gtFlags | dstAddr->gtFlags) & GTF_ALL_EFFECT);
+        vecStores.Push(store);
+    }
+
+    if (vecStores.Height() == 0 || !sawIter)
+    {
+        *pReason = "no array stores";
+        return false;
+    }
+
+    int vectorLength = getSIMDVectorLength(simdSize, baseType);
+    if ((loop->lpFlags & (LPFLG_CONST_INIT | LPFLG_CONST_LIMIT)) == (LPFLG_CONST_INIT | LPFLG_CONST_LIMIT) &&
+        loop->lpConstLimit() - loop->lpConstInit < vectorLength)
+    {
+        *pReason = "trip count is smaller than the vector length";
+        return false;
+    }
+
+    // Build vecGuard, vecBody, vecExit and scalarHead between the head and the loop.
+    BasicBlock* exit       = body->bbNext;
+    BasicBlock* vecGuard   = fgNewBBafter(BBJ_COND, head, /*extendRegion*/true);
+    BasicBlock* vecBody    = fgNewBBafter(BBJ_COND, vecGuard, /*extendRegion*/true);
+    BasicBlock* vecExit    = fgNewBBafter(BBJ_COND, vecBody, /*extendRegion*/true);
+    BasicBlock* scalarHead = fgNewBBafter(BBJ_NONE, vecExit, /*extendRegion*/true);
+
+    vecGuard->bbJumpDest = scalarHead;
+    vecBody->bbJumpDest  = vecBody;
+    vecExit->bbJumpDest  = exit;
+
+    vecGuard->inheritWeight(head);
+    vecBody->inheritWeight(body);
+    vecExit->inheritWeight(head);
+    scalarHead->inheritWeight(head);
+
+    // TODO-Cleanup: Like the slow path of a cloned loop, the vector loop is not in the loop table;
+    // its blocks are part of the surrounding loop, if one exists.
+    vecGuard->bbNatLoopNum   = loop->lpParent;
+    vecBody->bbNatLoopNum    = loop->lpParent;
+    vecExit->bbNatLoopNum    = loop->lpParent;
+    scalarHead->bbNatLoopNum = loop->lpParent;
+
+    vecBody->bbFlags    |= (body->bbFlags & (BBF_BACKWARD_JUMP | BBF_NEEDS_GCPOLL)) |
+                           BBF_LOOP_HEAD | BBF_JMP_TARGET | BBF_HAS_LABEL;
+    scalarHead->bbFlags |= BBF_JMP_TARGET | BBF_HAS_LABEL;
+    exit->bbFlags       |= BBF_JMP_TARGET | BBF_HAS_LABEL;
+
+    // vecGuard: if (limit - i < VL) goto scalarHead
+    GenTreePtr cond = gtNewOperNode(GT_LT, TYP_INT,
+                                    gtNewOperNode(GT_SUB, TYP_INT, gtCloneExpr(limit), gtNewLclvNode(ivLclNum, TYP_INT)),
+                                    gtNewIconNode(vectorLength));
+    optVectorizeAddStmt(vecGuard, gtNewOperNode(GT_JTRUE, TYP_VOID, cond));
+
+    // vecBody: the vector stores, i += VL and if (limit - i >= VL) goto vecBody
+    for (int i = 0; i < vecStores.Height(); i++)
+    {
+        optVectorizeAddStmt(vecBody, vecStores.Bottom(i));
+    }
+    GenTreePtr incr = gtNewAssignNode(gtNewLclvNode(ivLclNum, TYP_INT),
+                                      gtNewOperNode(GT_ADD, TYP_INT, gtNewLclvNode(ivLclNum, TYP_INT), gtNewIconNode(vectorLength)));
+    optVectorizeAddStmt(vecBody, incr);
+    cond = gtNewOperNode(GT_GE, TYP_INT,
+                         gtNewOperNode(GT_SUB, TYP_INT, gtCloneExpr(limit), gtNewLclvNode(ivLclNum, TYP_INT)),
+                         gtNewIconNode(vectorLength));
+    optVectorizeAddStmt(vecBody, gtNewOperNode(GT_JTRUE, TYP_VOID, cond));
+
+    // vecExit: if (i >= limit) goto exit
+    cond = gtNewOperNode(GT_GE, TYP_INT, gtNewLclvNode(ivLclNum, TYP_INT), gtCloneExpr(limit));
+    optVectorizeAddStmt(vecExit, gtNewOperNode(GT_JTRUE, TYP_VOID, cond));
+
+    // The original loop is now the scalar epilogue; its iterator no longer starts at the initial value.
+    optUpdateLoopHead(loopNum, head, scalarHead);
+    loop->lpFlags &= ~(LPFLG_CONST | LPFLG_CONST_INIT | LPFLG_VAR_INIT | LPFLG_HAS_PREHEAD);
+    loop->lpFlags |= LPFLG_DONT_UNROLL;
+
+    compFloatingPointUsed = true;
+    *pBaseType = baseType;
+
+    fgUpdateChangedFlowGraph();
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+// optVectorizeAddStmt - Append "tree" as a new statement at the end of "block" and morph it.
+//
+void                Compiler::optVectorizeAddStmt(BasicBlock* block, GenTreePtr tree)
+{
+    GenTreePtr stmt = fgNewStmtFromTree(tree);
+    fgInsertStmtAtEnd(block, stmt);
+    fgMorphBlockStmt(block, stmt DEBUGARG("Loop vectorization"));
+}
+
+//--------------------------------------------------------------------------------------------------
+// optIsVectorizableArrElem - Check whether "tree" is a bounds-check-free "arr[i]", where "arr" is
+//      loop invariant and "i" is the iterator of loop "loopNum".
+//
+// Arguments:
+//      tree        the tree to check
+//      loopNum     the loop index
+//      ivLclNum    the iterator of the loop
+//      pArrLclNum  [out] the array local
+//
+// Return Values:
+//      True if "tree" matches.  Only int, long, float and double elements are accepted.
+//
+// Operation:
+//      Matches the morphed form described in optExtractArrIndex, wrapped in the GT_COMMA whose
+//      bounds check optRemoveRangeCheck has replaced with a GT_NOP.  Requiring that wrapper means
+//      the access is covered by the loop cloning conditions.
+//
+bool                Compiler::optIsVectorizableArrElem(GenTreePtr tree, unsigned loopNum, unsigned ivLclNum, unsigned* pArrLclNum)
+{
+    bool bndsChkRemoved = false;
+    while (tree->gtOper == GT_COMMA && tree->gtGetOp1()->IsNothingNode())
+    {
+        bndsChkRemoved = true;
+        tree = tree->gtGetOp2();
+    }
+    if (!bndsChkRemoved || tree->gtOper != GT_IND || (tree->gtFlags & GTF_IND_VOLATILE) != 0)
+    {
+        return false;
+    }
+
+    var_types elemType = tree->TypeGet();
+    if (elemType != TYP_INT && elemType != TYP_LONG && elemType != TYP_FLOAT && elemType != TYP_DOUBLE)
+    {
+        return false;
+    }
+
+    GenTreePtr sibo = tree->gtGetOp1();
+    if (sibo->gtOper != GT_ADD)
+    {
+        return false;
+    }
+    GenTreePtr sib = sibo->gtGetOp1();
+    GenTreePtr ofs = sibo->gtGetOp2();
+    if (ofs->gtOper != GT_CNS_INT || ofs->gtIntCon.gtIconVal != (ssize_t)offsetof(CORINFO_Array, u1Elems))
+    {
+        return false;
+    }
+    if (sib->gtOper != GT_ADD)
+    {
+        return false;
+    }
+    GenTreePtr base = sib->gtGetOp1();
+    GenTreePtr si   = sib->gtGetOp2();
+    if (base->gtOper != GT_LCL_VAR || base->TypeGet() != TYP_REF ||
+        !optIsStackLocalInvariant(loopNum, base->gtLclVarCommon.gtLclNum))
+    {
+        return false;
+    }
+    if (si->gtOper != GT_LSH || si->gtGetOp2()->gtOper != GT_CNS_INT ||
+        (1 << si->gtGetOp2()->gtIntCon.gtIconVal) != (ssize_t)genTypeSize(elemType))
+    {
+        return false;
+    }
+    GenTreePtr index = si->gtGetOp1();
+#ifdef _TARGET_AMD64_
+    if (index->gtOper != GT_CAST || index->gtOverflow())
+    {
+        return false;
+    }
+    index = index->gtGetOp1();
+#endif
+    if (index->gtOper != GT_LCL_VAR || index->gtLclVarCommon.gtLclNum != ivLclNum)
+    {
+        return false;
+    }
+
+    *pArrLclNum = base->gtLclVarCommon.gtLclNum;
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+// optVectorizeTree - Build the SIMD form of the scalar expression "tree" from the body of loop
+//      "loopNum".
+//
+// Arguments:
+//      tree        the scalar expression
+//      loopNum     the loop index
+//      ivLclNum    the iterator of the loop
+//      baseType    the element type of the loop
+//      simdSize    the size of the SIMD vector in bytes
+//
+// Return Values:
+//      A TYP_STRUCT GT_SIMD tree computing "tree" for VL consecutive iterations, or nullptr if
+//      "tree" contains anything other than iterator-indexed array elements, invariant locals,
+//      constants and arithmetic with a SIMD equivalent.
+//
+// Notes:
+//      TODO-CQ: invariant operands are broadcast on every iteration of the vector loop.
+//
+GenTreePtr          Compiler::optVectorizeTree(GenTreePtr tree, unsigned loopNum, unsigned ivLclNum, var_types baseType, unsigned simdSize)
+{
+    if (tree->TypeGet() != baseType)
+    {
+        return nullptr;
+    }
+
+    unsigned arrLclNum;
+    if (optIsVectorizableArrElem(tree, loopNum, ivLclNum, &arrLclNum))
+    {
+        return gtNewSIMDNode(TYP_STRUCT,
+                             gtNewLclvNode(arrLclNum, TYP_REF),
+                             gtNewLclvNode(ivLclNum, TYP_INT),
+                             SIMDIntrinsicInitArray,
+                             baseType,
+                             simdSize);
+    }
+
+    SIMDIntrinsicID simdIntrinsicID;
+    switch (tree->OperGet())
+    {
+    case GT_LCL_VAR:
+        if (!optIsStackLocalInvariant(loopNum, tree->gtLclVarCommon.gtLclNum))
+        {
+            return nullptr;
+        }
+        __fallthrough;
+
+    case GT_CNS_INT:
+    case GT_CNS_LNG:
+    case GT_CNS_DBL:
+        return gtNewSIMDNode(TYP_STRUCT, gtCloneExpr(tree), nullptr, SIMDIntrinsicInit, baseType, simdSize);
+
+    case GT_ADD:
+        simdIntrinsicID = SIMDIntrinsicAdd;
+        break;
+
+    case GT_SUB:
+        simdIntrinsicID = SIMDIntrinsicSub;
+        break;
+
+    case GT_MUL:
+        // There is no packed 64-bit multiply.
+        if (baseType == TYP_LONG)
+        {
+            return nullptr;
+        }
+        simdIntrinsicID = SIMDIntrinsicMul;
+        break;
+
+    case GT_DIV:
+        if (!varTypeIsFloating(baseType))
+        {
+            return nullptr;
+        }
+        simdIntrinsicID = SIMDIntrinsicDiv;
+        break;
+
+    case GT_AND:
+        simdIntrinsicID = SIMDIntrinsicBitwiseAnd;
+        break;
+
+    case GT_OR:
+        simdIntrinsicID = SIMDIntrinsicBitwiseOr;
+        break;
+
+    case GT_XOR:
+        simdIntrinsicID = SIMDIntrinsicBitwiseXor;
+        break;
+
+    default:
+        return nullptr;
+    }
+
+    if (tree->gtOverflowEx())
+    {
+        return nullptr;
+    }
+
+    GenTreePtr op1 = optVectorizeTree(tree->gtGetOp1(), loopNum, ivLclNum, baseType, simdSize);
+    if (op1 == nullptr)
+    {
+        return nullptr;
+    }
+    GenTreePtr op2 = optVectorizeTree(tree->gtGetOp2(), loopNum, ivLclNum, baseType, simdSize);
+    if (op2 == nullptr)
+    {
+        return nullptr;
+    }
+
+    return gtNewSIMDNode(TYP_STRUCT, op1, op2, simdIntrinsicID, baseType, simdSize);
+}
+
+#endif // FEATURE_SIMD
+
 /*****************************************************************************
  *
  *  Determine the kind of interference for the call.
@@ -6933,6 +7496,7 @@ void                Compiler::optRemoveRangeCheck(GenTreePtr tree,
 
     // Just replace the bndsChk with a NOP as an operand to the GT_COMMA, if there are no side effects.
     tree->gtOp.gtOp1 = (sideEffList != NULL) ? sideEffList : gtNewNothingNode();
+    optRangeChecksRemoved++;
 
     // TODO-CQ: We should also remove the GT_COMMA, but in any case we can no longer CSE the GT_COMMA.
     tree->gtFlags |= GTF_DONT_CSE;
@@ -7313,7 +7877,15 @@ bool Compiler::optExtractArrIndex(GenTreePtr tree, ArrIndex* result, unsigned lh
     {
         return false;
     }
-    if (arrBndsChk->gtIndex->gtOper != GT_LCL_VAR)
+    // The index is a local, or a local plus a constant.
+    GenTreePtr indexLcl = arrBndsChk->gtIndex;
+    int        indOff   = 0;
+    if (indexLcl->gtOper == GT_ADD && !indexLcl->gtOverflow() && indexLcl->gtGetOp2()->IsIntCnsFitsInI32())
+    {
+        indOff   = (int) indexLcl->gtGetOp2()->gtIntCon.gtIconVal;
+        indexLcl = indexLcl->gtGetOp1();
+    }
+    if (indexLcl->gtOper != GT_LCL_VAR || indexLcl->TypeGet() != TYP_INT || indOff == INT_MIN)
     {
         return false;
     }
@@ -7323,7 +7895,7 @@ bool Compiler::optExtractArrIndex(GenTreePtr tree, ArrIndex* result, unsigned lh
         return false;
     }
 
-    unsigned indLcl = arrBndsChk->gtIndex->gtLclVarCommon.gtLclNum;
+    unsigned indLcl = indexLcl->gtLclVarCommon.gtLclNum;
 
     GenTreePtr after = tree->gtGetOp2();
 
@@ -7371,6 +7943,11 @@ bool Compiler::optExtractArrIndex(GenTreePtr tree, ArrIndex* result, unsigned lh
 #else
     GenTreePtr indexVar = index;
 #endif
+    // The constant part of an index like "i + 1" may have been folded into "ofs".
+    if (indexVar->gtOper == GT_ADD && indOff != 0)
+    {
+        indexVar = indexVar->gtGetOp1();
+    }
     if (indexVar->gtOper != GT_LCL_VAR || indexVar->gtLclVarCommon.gtLclNum != indLcl)
     {
         return false;
@@ -7380,6 +7957,7 @@ bool Compiler::optExtractArrIndex(GenTreePtr tree, ArrIndex* result, unsigned lh
         result->arrLcl = arrLcl;
     }
     result->indLcls.Push(indLcl);
+    result->indOffs.Push(indOff);
     result->bndsChks.Push(tree);
     result->useBlock = compCurBB;
     result->rank++;
@@ -7486,6 +8064,76 @@ bool Compiler::optIsStackLocalInvariant(unsigned loopNum, unsigned lclNum)
     return true;
 }
 
+//----------------------------------------------------------------------------------------------
+//  optIsIterVarIndex: Check if a local used as an array index is the iter var of the loop, or
+//      a copy of it plus a constant made earlier in the same block.
+//
+//  Arguments:
+//      loopNum      The loop whose iter var is looked for.
+//      stmt         The statement that contains the array access.
+//      lclNum       The local used as the index.
+//      pOffset      [out] The constant that the index differs from the iter var by.
+//
+//  Return Value:
+//      Returns true if the value of "lclNum" at "stmt" is "iterVar + *pOffset".
+//
+//  Notes:
+//      A local defined as "j = i + c" is only accepted if that is its only definition in the
+//      loop and "i" is not incremented between the definition and "stmt".
+//
+bool Compiler::optIsIterVarIndex(unsigned loopNum, GenTreePtr stmt, unsigned lclNum, int* pOffset)
+{
+    LoopDsc* loop    = &optLoopTable[loopNum];
+    unsigned iterVar = loop->lpIterVar();
+
+    *pOffset = 0;
+    if (lclNum == iterVar)
+    {
+        return true;
+    }
+
+    LclVarDsc* varDsc = &lvaTable[lclNum];
+    if (varDsc->lvAddrExposed || varDsc->TypeGet() != TYP_INT)
+    {
+        return false;
+    }
+
+    // Look for the definition in the statements before "stmt", stopping at the increment.
+    BasicBlock* block = compCurBB;
+    for (GenTreePtr prev = stmt; prev != block->bbTreeList; )
+    {
+        prev = prev->gtPrev;
+
+        GenTreePtr expr = prev->gtStmt.gtStmtExpr;
+        if (expr == loop->lpIterTree)
+        {
+            return false;
+        }
+        if (expr->gtOper != GT_ASG || expr->gtGetOp1()->gtOper != GT_LCL_VAR ||
+            expr->gtGetOp1()->gtLclVarCommon.gtLclNum != lclNum)
+        {
+            continue;
+        }
+
+        GenTreePtr value  = expr->gtGetOp2();
+        int        offset = 0;
+        if (value->gtOper == GT_ADD && !value->gtOverflow() && value->gtGetOp2()->IsIntCnsFitsInI32())
+        {
+            offset = (int) value->gtGetOp2()->gtIntCon.gtIconVal;
+            value  = value->gtGetOp1();
+        }
+        if (value->gtOper != GT_LCL_VAR || value->gtLclVarCommon.gtLclNum != iterVar || offset == INT_MIN ||
+            optIsVarAssigned(loop->lpHead->bbNext, loop->lpBottom, expr, lclNum))
+        {
+            return false;
+        }
+
+        *pOffset = offset;
+        return true;
+    }
+    return false;
+}
+
 //----------------------------------------------------------------------------------------------
 //  optCanOptimizeByLoopCloning: Check if the tree can be optimized by loop cloning and if so,
 //      identify as potential candidate and update the loop context.
@@ -7497,9 +8145,9 @@ bool Compiler::optIsStackLocalInvariant(unsigned loopNum, unsigned lclNum)
 //                   candidates. Also supplies loopNum.
 //
 //  Operation:
-//      If array index can be reconstructed, check if the iter var of the loop matches the
-//      array index var in some dim. Also ensure other index vars before the identified
-//      dim are loop invariant.
+//      If array index can be reconstructed, check if the iter var of the loop, plus a
+//      constant, matches the array index in some dim. Also ensure other index vars before
+//      the identified dim are loop invariant.
 //  
 //  Return Value:
 //      Skip sub trees if the optimization candidate is identified or else continue walking
@@ -7530,13 +8178,31 @@ Compiler::fgWalkResult Compiler::optCanOptimizeByLoopCloning(GenTreePtr tree, Lo
         // Walk the dimensions and see if iterVar of the loop is used as index.
         for (unsigned dim = 0; dim < arrIndex.rank; ++dim)
         {
-            // Is index variable also used as the loop iter var.
-            if (arrIndex.indLcls[dim] == optLoopTable[info->loopNum].lpIterVar())
+            // Is index variable also used as the loop iter var, possibly with a constant offset.
+            int offset;
+            if (optIsIterVarIndex(info->loopNum, info->stmt, arrIndex.indLcls[dim], &offset))
             {
+                LoopDsc* loop = &optLoopTable[info->loopNum];
+
+                // The index ranges over [init + offset, limit + offset), so a constant init
+                // must not take it below zero. A variable init is checked at run time.
+                INT64 totalOffset = (INT64) offset + arrIndex.indOffs[dim];
+                if (totalOffset <= INT_MIN || totalOffset > INT_MAX)
+                {
+                    JITDUMP("Index V%02d%+d overflows with the iter var offset %d\n", arrIndex.indLcls[dim], arrIndex.indOffs[dim], offset);
+                    continue;
+                }
+                offset = (int) totalOffset;
+                if ((loop->lpFlags & LPFLG_CONST_INIT) && ((INT64) loop->lpConstInit + offset < 0))
+                {
+                    JITDUMP("Index V%02d%+d is negative on the first iteration\n", arrIndex.indLcls[dim], arrIndex.indOffs[dim]);
+                    continue;
+                }
+
                 // Check the previous indices are all loop invariant.
                 for (unsigned dim2 = 0; dim2 < dim; ++dim2)
                 {
-                    if (optIsVarAssgLoop(info->loopNum, arrIndex.indLcls[dim2]))
+                    if (arrIndex.indOffs[dim2] != 0 || optIsVarAssgLoop(info->loopNum, arrIndex.indLcls[dim2]))
                     {
                         JITDUMP("V%02d is assigned in loop\n", arrIndex.indLcls[dim2]);
                         return WALK_SKIP_SUBTREES;
@@ -7547,11 +8213,11 @@ Compiler::fgWalkResult Compiler::optCanOptimizeByLoopCloning(GenTreePtr tree, Lo
                 {
                     JITDUMP("Loop %d can be cloned for ArrIndex ", info->loopNum);
                     arrIndex.Print();
-                    JITDUMP(" on dim %d\n", dim);
+                    JITDUMP(" on dim %d with offset %d\n", dim, offset);
                 }
 #endif
                 // Update the loop context.
-                info->context->EnsureLoopOptInfo(info->loopNum)->Push(new (this, CMK_LoopOpt) LcJaggedArrayOptInfo(arrIndex, dim, info->stmt));
+                info->context->EnsureLoopOptInfo(info->loopNum)->Push(new (this, CMK_LoopOpt) LcJaggedArrayOptInfo(arrIndex, dim, info->stmt, offset));
             }
             else
             {
@@ -8887,3 +9553,180 @@ void                Compiler::optOptimizeBools()
     fgDebugCheckBBlist();
 #endif
 }
+
+/*****************************************************************************
+ *
+ *  A store of an object reference into the heap goes through a write barrier,
+ *  which marks the card covering the updated field so that the next ephemeral
+ *  GC can find the references from older generations into younger ones.  An
+ *  object returned by one of the small object allocation helpers is in gen0,
+ *  and stays there until the next GC, so a store into it cannot create such a
+ *  reference before then.
+ *
+ *  Unless the method is fully interruptible, a GC can only happen at a call.
+ *  So, within each block, we look for stores of object references into the
+ *  fields of the object allocated by the last call, when that call was a small
+ *  object allocation -- typically the field stores of an inlined constructor.
+ *  The new object is identified by the value number of the allocation, which
+ *  is unique to it, so that the copies of its reference made by the inliner
+ *  are recognized as well.  The stores found are recorded in optNoBarrierStores
+ *  for gcIsWriteBarrierCandidate.
+ */
+
+void                Compiler::optElideNewObjWriteBarriers()
+{
+#ifdef DEBUG
+    if  (verbose)
+        printf("*************** In optElideNewObjWriteBarriers()\n");
+#endif
+
+#if FEATURE_WRITE_BARRIER
+#ifdef DEBUG
+    static ConfigDWORD fJitNoBarrierElision;
+    if (fJitNoBarrierElision.val(CLRConfig::INTERNAL_JitNoBarrierElision) != 0)
+        return;
+#endif // DEBUG
+
+    // A fully interruptible method can be stopped for a GC between any two instructions.
+    if (genInterruptible)
+    {
+        JITDUMP("Method is fully interruptible, no write barriers elided\n");
+        return;
+    }
+
+    for (BasicBlock* block = fgFirstBB; block != nullptr; block = block->bbNext)
+    {
+        if ((block->bbFlags & BBF_HAS_NEWOBJ) == 0)
+            continue;
+
+        // The value number of the object allocated by the last call, if there has
+        // been no GC safe point since, and the size of its fields.
+        ValueNum newObjVN   = ValueNumStore::NoVN;
+        unsigned newObjSize = 0;
+
+        for (GenTreeStmt* stmt = block->firstStmt(); stmt != nullptr; stmt = stmt->gtNextStmt)
+        {
+            for (GenTreePtr tree = stmt->gtStmtList; tree != nullptr; tree = tree->gtNext)
+            {
+                switch (tree->OperGet())
+                {
+                case GT_CALL:
+                    newObjVN = optNewObjValueNum(tree->AsCall(), &newObjSize);
+                    break;
+
+                // These may be expanded into helper calls by the backend.
+                case GT_MATH:
+                case GT_LCLHEAP:
+                case GT_INITBLK:
+                case GT_COPYBLK:
+                case GT_COPYOBJ:
+                    newObjVN = ValueNumStore::NoVN;
+                    break;
+
+                case GT_ASG:
+                    {
+                        if (newObjVN == ValueNumStore::NoVN)
+                            break;
+
+                        GenTreePtr dst = tree->gtOp.gtOp1;
+                        if (dst->OperGet() != GT_IND || dst->TypeGet() != TYP_REF)
+                            break;
+
+                        GenTreePtr obj;
+                        int        offset;
+                        if (!dst->gtOp.gtOp1->IsAddWithI32Const(&obj, &offset) || obj->TypeGet() != TYP_REF)
+                            break;
+
+                        // The field must be one of the new object's, past its method table pointer.
+                        if (offset < TARGET_POINTER_SIZE || (unsigned)offset > newObjSize)
+                            break;
+
+                        if (vnStore->VNNormVal(obj->gtVNPair.GetConservative()) != newObjVN)
+                            break;
+
+                        if (optNoBarrierStores == nullptr)
+                            optNoBarrierStores = new (getAllocator()) NodeSet(getAllocator());
+
+                        optNoBarrierStores->Set(dst, true);
+                        optWriteBarriersElided++;
+
+                        JITDUMP("BB%02u: store [%06u] into a new object needs no write barrier\n",
+                                block->bbNum, dspTreeID(tree));
+                    }
+                    break;
+
+                default:
+                    break;
+                }
+            }
+        }
+    }
+
+    JITDUMP("%u write barrier(s) elided\n", optWriteBarriersElided);
+#endif // FEATURE_WRITE_BARRIER
+}
+
+/*****************************************************************************
+ *
+ *  If "call" allocates an object in gen0 (a small, non-array object), returns
+ *  the value number of the new object, and sets "*pObjSize" to the size of its
+ *  fields.  Returns NoVN otherwise.
+ */
+
+ValueNum            Compiler::optNewObjValueNum(GenTreeCall* call, unsigned* pObjSize)
+{
+    // Well below the size at which objects are allocated in the large object heap.
+    const unsigned maxObjSize = 0x10000;
+
+    if (call->gtCallType != CT_HELPER)
+        return ValueNumStore::NoVN;
+
+    switch (eeGetHelperNum(call->gtCallMethHnd))
+    {
+    case CORINFO_HELP_NEWFAST:
+    case CORINFO_HELP_NEWSFAST:
+    case CORINFO_HELP_NEWSFAST_ALIGN8:
+        break;
+
+    default:
+        return ValueNumStore::NoVN;
+    }
+
+    ValueNum  newObjVN = vnStore->VNNormVal(call->gtVNPair.GetConservative());
+    VNFuncApp funcApp;
+    if (!vnStore->GetVNFunc(newObjVN, &funcApp) || funcApp.m_func != VNF_JitNew)
+        return ValueNumStore::NoVN;
+
+    // The class handle is a constant (possibly loaded through an indirection cell)
+    // unless it is looked up at runtime.
+    GenTreePtr clsNode = gtArgEntryByArgNum(call, 0)->node;
+    if (clsNode->OperGet() == GT_IND)
+        clsNode = clsNode->gtOp.gtOp1;
+
+    if (clsNode->OperGet() != GT_CNS_INT ||
+        !clsNode->IsIconHandle(GTF_ICON_CLASS_HDL) ||
+        clsNode->gtIntCon.gtCompileTimeHandle == 0)
+        return ValueNumStore::NoVN;
+
+    CORINFO_CLASS_HANDLE clsHnd = CORINFO_CLASS_HANDLE(clsNode->gtIntCon.gtCompileTimeHandle);
+    unsigned             size   = info.compCompHnd->getClassSize(clsHnd);
+    if (size > maxObjSize)
+        return ValueNumStore::NoVN;
+
+    *pObjSize = size;
+    return newObjVN;
+}
+
+bool                Compiler::optIsNoBarrierStore(GenTreePtr store)
+{
+    return (optNoBarrierStores != nullptr) && optNoBarrierStores->Lookup(store);
+}
+
+void                Compiler::optReplaceNoBarrierStore(GenTreePtr oldStore, GenTreePtr newStore)
+{
+    if (optIsNoBarrierStore(oldStore))
+    {
+        optNoBarrierStores->Remove(oldStore);
+        optNoBarrierStores->Set(newStore, true);
+    }
+}
@@ -1631,6 +1631,7 @@ Compiler::fgWalkResult Rationalizer::SimpleTransformHelper(GenTree **ppTree, Com
                 if (tree->IsReverseOp()) store->gtFlags |= GTF_REVERSE_OPS;
                 store->gtFlags |= (lhs->gtFlags & GTF_IND_FLAGS);
                 store->CopyCosts(tree);
+                comp->optReplaceNoBarrierStore(lhs, store);
 
                 JITDUMP("Rewriting GT_ASG(GT_IND, X) to GT_STOREIND(X):\n");
                 DISPTREE(store);
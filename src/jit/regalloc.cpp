@@ -676,6 +676,14 @@ regNumber     Compiler::raUpdateRegStateForArg(RegState *regState, LclVarDsc *ar
 
     regState->rsCalleeRegArgMaskLiveIn |= genRegMask(inArgReg);
 
+#ifdef FEATURE_UNIX_AMD64_STRUCT_PASSING
+    if (argDsc->lvIsMultiRegArg)
+    {
+        assert(!regState->rsIsFloat);
+        regState->rsCalleeRegArgMaskLiveIn |= genRegMask(argDsc->lvOtherArgReg);
+    }
+#endif // FEATURE_UNIX_AMD64_STRUCT_PASSING
+
 #ifdef _TARGET_ARM_
     if (argDsc->lvType == TYP_DOUBLE)
     {
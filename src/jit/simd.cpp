@@ -1308,6 +1308,10 @@ GenTreePtr  Compiler::impSIMDMinMax(SIMDIntrinsicID intrinsicId,
     //        op1 = op1 + 2^7  ; to make it unsigned
     //        result = SSE2 unsigned byte Min/Max(op1, op2)
     //        result = result - 2^15 ; readjust it back
+    //
+    // AVX2 has direct support for signed byte, unsigned word and signed/unsigned dword
+    // (pminsb/pminuw/pminsd/pminud and their max counterparts), so only int64/uint64
+    // need the compare-and-select sequence there.
              
     GenTree* simdTree = nullptr;
 
@@ -1316,6 +1320,12 @@ GenTreePtr  Compiler::impSIMDMinMax(SIMDIntrinsicID intrinsicId,
         // SSE2 has direct support
         simdTree = gtNewSIMDNode(TYP_STRUCT, op1, op2, intrinsicId, baseType, size);
     }
+    else if (canUseAVX() &&
+             (baseType == TYP_BYTE || baseType == TYP_CHAR || baseType == TYP_INT || baseType == TYP_UINT))
+    {
+        // AVX2 has direct support
+        simdTree = gtNewSIMDNode(TYP_STRUCT, op1, op2, intrinsicId, baseType, size);
+    }
     else if (baseType == TYP_CHAR || baseType == TYP_BYTE)
     {
         int constVal;
@@ -2393,15 +2403,19 @@ GenTreePtr Compiler::impSIMDIntrinsic(OPCODE                   opcode,
 
     case SIMDIntrinsicDotProduct:
         {
-#if defined(_TARGET_AMD64_) && defined(DEBUG)
-            // Right now dot product is supported only for float vectors.
+#if defined(_TARGET_AMD64_)
+            // Dot product is supported on float vectors, and on int/uint vectors when
+            // AVX2 is available (pmulld + phaddd).  SSE2 has no packed 32-bit multiply,
+            // so leave the call to the managed implementation in that case.
             // See SIMDIntrinsicList.h for supported base types for this intrinsic.
             if (!varTypeIsFloating(baseType)) 
             {
-                assert(!"Dot product on integer type vectors not supported");
-                return nullptr;
+                if ((baseType != TYP_INT && baseType != TYP_UINT) || !canUseAVX())
+                {
+                    return nullptr;
+                }
             }
-#endif //_TARGET_AMD64_ && DEBUG
+#endif //_TARGET_AMD64_
 
             // op1 is a SIMD variable that is the first source and also "this" arg.
             // op2 is a SIMD variable which is the second source.
@@ -2411,7 +2425,7 @@ GenTreePtr Compiler::impSIMDIntrinsic(OPCODE                   opcode,
             assert(op1->TypeGet() == TYP_STRUCT);
             assert(op2->TypeGet() == TYP_STRUCT);
 
-            simdTree = gtNewSIMDNode(baseType, op1, op2, simdIntrinsicID, baseType, size);
+            simdTree = gtNewSIMDNode(genActualType(baseType), op1, op2, simdIntrinsicID, baseType, size);
             retVal = simdTree;
         }
         break;
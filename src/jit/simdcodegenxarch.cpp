@@ -232,6 +232,27 @@ CodeGen::getOpForSIMDIntrinsic(SIMDIntrinsicID intrinsicId,
             {
                 result = INS_pminsw;
             }
+            else if (compiler->canUseAVX())
+            {
+                // AVX2 (like SSE4.1) has direct support for the remaining
+                // byte, word and dword integer types.
+                if (baseType == TYP_BYTE)
+                {
+                    result = INS_pminsb;
+                }
+                else if (baseType == TYP_CHAR)
+                {
+                    result = INS_pminuw;
+                }
+                else if (baseType == TYP_INT)
+                {
+                    result = INS_pminsd;
+                }
+                else if (baseType == TYP_UINT)
+                {
+                    result = INS_pminud;
+                }
+            }
             else
             {
                 unreached();
@@ -255,6 +276,27 @@ CodeGen::getOpForSIMDIntrinsic(SIMDIntrinsicID intrinsicId,
             {
                 result = INS_pmaxsw;
             }
+            else if (compiler->canUseAVX())
+            {
+                // AVX2 (like SSE4.1) has direct support for the remaining
+                // byte, word and dword integer types.
+                if (baseType == TYP_BYTE)
+                {
+                    result = INS_pmaxsb;
+                }
+                else if (baseType == TYP_CHAR)
+                {
+                    result = INS_pmaxuw;
+                }
+                else if (baseType == TYP_INT)
+                {
+                    result = INS_pmaxsd;
+                }
+                else if (baseType == TYP_UINT)
+                {
+                    result = INS_pmaxud;
+                }
+            }
             else
             {
                 unreached();
@@ -1208,15 +1250,50 @@ CodeGen::genSIMDIntrinsicDotProduct(GenTreeSIMD* simdNode)
     regNumber targetReg = simdNode->gtRegNum;
     assert(targetReg != REG_NA);
 
-    // DotProduct is only supported on floating point types.
     var_types targetType = simdNode->TypeGet();
-    assert(targetType == baseType);
-    assert(varTypeIsFloating(baseType));
+    assert(targetType == genActualType(baseType));
 
     genConsumeOperands(simdNode);
     regNumber op1Reg = op1->gtRegNum;
     regNumber op2Reg = op2->gtRegNum;
 
+    if (varTypeIsIntegral(baseType))
+    {
+        // Integer DotProduct is only imported when AVX2 is available, in which case
+        // Vector<int> is always a 32-byte vector.  The result is produced in an integer
+        // register, so both the product and the upper-half reduction need xmm temps.
+        //
+        // tmpReg1 = op1Reg * op2Reg                     ; vpmulld, 8 x int32
+        // tmpReg2 = vextractf128(tmpReg1, 1)            ; upper 4 lanes
+        // tmpReg1 = tmpReg1 + tmpReg2                   ; vpaddd, 4 x int32
+        // tmpReg1 = phaddd(tmpReg1, tmpReg1)            ; (0+1, 2+3, 0+1, 2+3)
+        // tmpReg1 = phaddd(tmpReg1, tmpReg1)            ; (0+1+2+3, ...)
+        // targetReg = lower 32-bits of tmpReg1
+        assert(compiler->canUseAVX());
+        assert(simdEvalType == TYP_SIMD32);
+        assert(simdNode->gtRsvdRegs != RBM_NONE);
+        assert(genCountBits(simdNode->gtRsvdRegs) == 2);
+
+        regMaskTP tmpRegsMask = simdNode->gtRsvdRegs;
+        regMaskTP tmpReg1Mask = genFindLowestBit(tmpRegsMask);
+        tmpRegsMask &= ~tmpReg1Mask;
+        regNumber tmpReg1 = genRegNumFromMask(tmpReg1Mask);
+        regNumber tmpReg2 = genRegNumFromMask(tmpRegsMask);
+
+        inst_RV_RV(ins_Copy(simdType), tmpReg1, op1Reg, simdEvalType, emitActualTypeSize(simdType));
+        inst_RV_RV(INS_pmulld, tmpReg1, op2Reg, simdEvalType, emitActualTypeSize(simdType));
+        getEmitter()->emitIns_R_R_I(INS_vextractf128, EA_32BYTE, tmpReg2, tmpReg1, 0x01);
+        inst_RV_RV(INS_paddd, tmpReg1, tmpReg2, TYP_SIMD16, EA_16BYTE);
+        inst_RV_RV(INS_phaddd, tmpReg1, tmpReg1, TYP_SIMD16, EA_16BYTE);
+        inst_RV_RV(INS_phaddd, tmpReg1, tmpReg1, TYP_SIMD16, EA_16BYTE);
+
+        // (Note that for mov_xmm2i, the int register is always in the reg2 position.)
+        inst_RV_RV(INS_mov_xmm2i, tmpReg1, targetReg, TYP_INT);
+
+        genProduceReg(simdNode);
+        return;
+    }
+
     regNumber tmpReg = REG_NA;
     // For SSE, or AVX with 32-byte vectors, we need an additional Xmm register as scratch.
     // However, it must be distinct from targetReg, so we request two from the register allocator.
@@ -636,6 +636,8 @@ typedef unsigned short          regPairNoSmall; // arm: need 12 bits
                                            //       on pre-Ivy Bridge hardware.
                                            // threshold to stop generating rep movs and switch to the helper call.
   #define INITBLK_UNROLL_LIMIT     128     // Upper bound to let the code generator to loop unroll InitBlk.
+  #define CPBLK_AVX_UNROLL_LIMIT   128     // Same as CPBLK_UNROLL_LIMIT when the unrolled loop can use 32-byte AVX moves.
+  #define INITBLK_AVX_UNROLL_LIMIT 256     // Same as INITBLK_UNROLL_LIMIT when the unrolled loop can use 32-byte AVX stores.
   #define CPOBJ_NONGC_SLOTS_LIMIT  4       // For CpObj code generation, this is the the threshold of the number 
                                            // of contiguous non-gc slots that trigger generating rep movsq instead of 
                                            // sequences of movsq instructions
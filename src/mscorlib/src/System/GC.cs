@@ -60,6 +60,75 @@ namespace System {
         NotApplicable = 4
     }
 
+    // !!!!!!!!!!!!!!!!!!!!!!!
+    // make sure you change the def in vm\threadsuspend.h 
+    // if you change this!
+    internal enum GCSuspensionStallReason
+    {
+        Unknown = 0,
+        InterruptibleCode = 1,
+        HijackableCode = 2,
+        NativeCode = 3
+    }
+
+    // !!!!!!!!!!!!!!!!!!!!!!!
+    // make sure you change the def in vm\comutilnative.h 
+    // if you change this!
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct GCSuspensionStats
+    {
+        internal int ThreadCount;
+        internal int ActivationCount;
+        internal int RetryCount;
+        internal int InterruptibleCount;
+        internal int HijackableCount;
+        internal int NativeCount;
+        internal int UnknownCount;
+        internal int MaxMicroseconds;
+        internal int OffenderThreadId;
+        internal int OffenderReason;
+        internal IntPtr OffenderIP;
+    }
+
+    // Describes how long the threads running managed code took to reach a safe
+    // point the last time the runtime was suspended, and which one took longest.
+    // Not public; tools get the same data from the GCSuspendEEStats event.
+    internal struct GCSuspensionInfo
+    {
+        private GCSuspensionStats m_stats;
+        private String m_offenderMethod;
+
+        internal GCSuspensionInfo(GCSuspensionStats stats, String offenderMethod)
+        {
+            m_stats = stats;
+            m_offenderMethod = offenderMethod;
+        }
+
+        // Number of threads the runtime had to wait for.
+        public int ThreadCount { get { return m_stats.ThreadCount; } }
+
+        // Number of times the runtime gave up waiting and interrupted them again.
+        public int RetryCount { get { return m_stats.RetryCount; } }
+
+        // Number of threads waited for, by where they were last seen running.
+        public int InterruptibleCount { get { return m_stats.InterruptibleCount; } }
+        public int HijackableCount { get { return m_stats.HijackableCount; } }
+        public int NativeCount { get { return m_stats.NativeCount; } }
+        public int UnknownCount { get { return m_stats.UnknownCount; } }
+
+        // The longest time a thread took to reach a safe point.
+        public TimeSpan MaxTimeToSafePoint {
+            get { return TimeSpan.FromTicks((long)m_stats.MaxMicroseconds * (TimeSpan.TicksPerMillisecond / 1000)); }
+        }
+
+        // The operating system id of the thread that took that long, where it was
+        // last seen running and the method that contains that code, if any.
+        public int OffenderThreadId { get { return m_stats.OffenderThreadId; } }
+        public GCSuspensionStallReason OffenderReason { get { return (GCSuspensionStallReason)m_stats.OffenderReason; } }
+        public IntPtr OffenderInstructionPointer { get { return m_stats.OffenderIP; } }
+        public String OffenderMethod { get { return m_offenderMethod; } }
+    }
+
     public static class GC 
     {
         [System.Security.SecurityCritical]  // auto-generated
@@ -322,6 +391,21 @@ namespace System {
             // QCalls can not be exposed from mscorlib directly, need to wrap it.
             _WaitForPendingFinalizers();
         }
+
+        [System.Security.SecurityCritical]
+        [DllImport(JitHelpers.QCall, CharSet = CharSet.Unicode)]
+        [SuppressUnmanagedCodeSecurity]
+        private static extern void _GetLastSuspensionInfo(ref GCSuspensionStats stats, StringHandleOnStack retOffenderMethod);
+
+        // Returns how long the threads took to reach a safe point the last time
+        // the runtime was suspended, for a garbage collection or otherwise.
+        [System.Security.SecuritySafeCritical]
+        internal static GCSuspensionInfo GetLastSuspensionInfo() {
+            GCSuspensionStats stats = new GCSuspensionStats();
+            String offenderMethod = null;
+            _GetLastSuspensionInfo(ref stats, JitHelpers.GetStringHandleOnStack(ref offenderMethod));
+            return new GCSuspensionInfo(stats, offenderMethod);
+        }
     
         // Indicates that the system should not call the Finalize() method on
         // an object that would normally require this call.
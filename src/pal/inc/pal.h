@@ -1188,7 +1188,65 @@ ReadFile(
      OUT LPDWORD lpNumberOfBytesRead,
      IN LPOVERLAPPED lpOverlapped);
 
-#define STD_INPUT_HANDLE         ((DWORD)-10)
+typedef struct _OVERLAPPED_ENTRY {
+    ULONG_PTR lpCompletionKey;
+    LPOVERLAPPED lpOverlapped;
+    ULONG_PTR Internal;
+    DWORD dwNumberOfBytesTransferred;
+} OVERLAPPED_ENTRY, *LPOVERLAPPED_ENTRY;
+
+// The PAL does not perform overlapped I/O. A handle associated with a
+// completion port instead queues a packet each time it becomes ready:
+// lpOverlapped is PAL_IOCP_READINESS_OVERLAPPED, which must not be
+// dereferenced, and dwNumberOfBytesTransferred holds the POLLIN, POLLOUT,
+// POLLERR and POLLHUP bits the handle became ready with. As on Windows,
+// packets queued by PostQueuedCompletionStatus are returned unchanged,
+// so a packet with a NULL lpOverlapped was always posted. Posting
+// PAL_IOCP_READINESS_OVERLAPPED fails with ERROR_INVALID_PARAMETER.
+// Completion ports are only supported where epoll is available.
+
+#define PAL_IOCP_READINESS_OVERLAPPED ((LPOVERLAPPED)(SIZE_T)-1)
+
+PALIMPORT
+HANDLE
+PALAPI
+CreateIoCompletionPort(
+    IN HANDLE FileHandle,
+    IN HANDLE ExistingCompletionPort,
+    IN ULONG_PTR CompletionKey,
+    IN DWORD NumberOfConcurrentThreads);
+
+PALIMPORT
+BOOL
+PALAPI
+PostQueuedCompletionStatus(
+    IN HANDLE CompletionPort,
+    IN DWORD dwNumberOfBytesTransferred,
+    IN ULONG_PTR dwCompletionKey,
+    IN LPOVERLAPPED lpOverlapped);
+
+PALIMPORT
+BOOL
+PALAPI
+GetQueuedCompletionStatus(
+    IN HANDLE CompletionPort,
+    OUT LPDWORD lpNumberOfBytesTransferred,
+    OUT PULONG_PTR lpCompletionKey,
+    OUT LPOVERLAPPED *lpOverlapped,
+    IN DWORD dwMilliseconds);
+
+PALIMPORT
+BOOL
+PALAPI
+GetQueuedCompletionStatusEx(
+    IN HANDLE CompletionPort,
+    OUT LPOVERLAPPED_ENTRY lpCompletionPortEntries,
+    IN ULONG ulCount,
+    OUT PULONG ulNumEntriesRemoved,
+    IN DWORD dwMilliseconds,
+    IN BOOL fAlertable);
+
+#define STD_INPUT_HANDLE        ((DWORD)-10)
 #define STD_OUTPUT_HANDLE        ((DWORD)-11)
 #define STD_ERROR_HANDLE         ((DWORD)-12)
 
@@ -5903,6 +5961,27 @@ VOID
 PALAPI
 PAL_SetHardwareExceptionHandler(IN PHARDWARE_EXCEPTION_HANDLER handler);
 
+// Called on a thread that was interrupted by PAL_InjectActivation, with the
+// context of the interrupted code. Changes to the context are applied when the
+// thread resumes.
+typedef VOID (PALAPI *PAL_ActivationFunction)(CONTEXT *context);
+
+// Called before the activation function to check whether the interrupted
+// instruction pointer is a place where the activation can run at all.
+typedef BOOL (PALAPI *PAL_SafeActivationCheckFunction)(SIZE_T ip);
+
+PALIMPORT
+VOID
+PALAPI
+PAL_SetActivationFunction(
+    IN PAL_ActivationFunction pActivationFunction,
+    IN PAL_SafeActivationCheckFunction pSafeActivationCheckFunction);
+
+PALIMPORT
+BOOL
+PALAPI
+PAL_InjectActivation(IN HANDLE hThread);
+
 #endif // __cplusplus
 
 // Start of a try block for exceptions raised by RaiseException
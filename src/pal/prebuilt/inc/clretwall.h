@@ -257,12 +257,14 @@ EXTERN_C __declspec(selectany) const GUID MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVID
 #define CLR_GC_BULKROOTCCW_OPCODE 0x26
 #define CLR_GC_BULKRCW_OPCODE 0x27
 #define CLR_GC_BULKROOTSTATICVAR_OPCODE 0x28
+#define CLR_GC_SUSPENDEESTATS_OPCODE 0x29
 #define CLR_GC_INCREASEMEMORYPRESSURE_OPCODE 0xc8
 #define CLR_GC_DECREASEMEMORYPRESSURE_OPCODE 0xc9
 #define CLR_GC_MARK_OPCODE 0xca
 #define CLR_GC_JOIN_OPCODE 0xcb
 #define CLR_GC_GCPERHEAPHISTORY_OPCODE 0xcc
 #define CLR_GC_GCGLOBALHEAPHISTORY_OPCODE 0xcd
+#define CLR_CONTENTION_STATS_OPCODE 0xa
 #define CLR_METHOD_DCSTARTCOMPLETE_OPCODE 0xe
 #define CLR_METHOD_DCENDCOMPLETE_OPCODE 0xf
 #define CLR_METHOD_METHODLOAD_OPCODE 0x21
@@ -434,6 +436,10 @@ EXTERN_C __declspec(selectany) const EVENT_DESCRIPTOR GCSuspendEEEnd = {0x8, 0x0
 #define GCSuspendEEEnd_value 0x8
 EXTERN_C __declspec(selectany) const EVENT_DESCRIPTOR GCSuspendEEEnd_V1 = {0x8, 0x1, 0x0, 0x4, 0x89, 0x1, 0x1};
 #define GCSuspendEEEnd_V1_value 0x8
+EXTERN_C __declspec(selectany) const EVENT_DESCRIPTOR GCSuspendEEEnd_V2 = {0x8, 0x2, 0x0, 0x4, 0x89, 0x1, 0x1};
+#define GCSuspendEEEnd_V2_value 0x8
+EXTERN_C __declspec(selectany) const EVENT_DESCRIPTOR GCSuspendEEStats = {0x5d, 0x0, 0x0, 0x4, 0x29, 0x1, 0x1};
+#define GCSuspendEEStats_value 0x5d
 EXTERN_C __declspec(selectany) const EVENT_DESCRIPTOR GCSuspendEEBegin = {0x9, 0x0, 0x0, 0x4, 0xa, 0x1, 0x1};
 #define GCSuspendEEBegin_value 0x9
 EXTERN_C __declspec(selectany) const EVENT_DESCRIPTOR GCSuspendEEBegin_V1 = {0x9, 0x1, 0x0, 0x4, 0xa, 0x1, 0x1};
@@ -576,6 +582,8 @@ EXTERN_C __declspec(selectany) const EVENT_DESCRIPTOR ContentionStart_V1 = {0x51
 #define ContentionStart_V1_value 0x51
 EXTERN_C __declspec(selectany) const EVENT_DESCRIPTOR ContentionStop = {0x5b, 0x0, 0x0, 0x4, 0x2, 0x8, 0x4000};
 #define ContentionStop_value 0x5b
+EXTERN_C __declspec(selectany) const EVENT_DESCRIPTOR ContentionStats = {0x5c, 0x0, 0x0, 0x5, 0xa, 0x8, 0x4000};
+#define ContentionStats_value 0x5c
 EXTERN_C __declspec(selectany) const EVENT_DESCRIPTOR CLRStackWalk = {0x52, 0x0, 0x0, 0x0, 0x52, 0xb, 0x40000000};
 #define CLRStackWalk_value 0x52
 EXTERN_C __declspec(selectany) const EVENT_DESCRIPTOR AppDomainMemAllocated = {0x53, 0x0, 0x0, 0x4, 0x30, 0xe, 0x800};
@@ -747,9 +755,9 @@ EXTERN_C __declspec(selectany) const EVENT_DESCRIPTOR DebugExceptionProcessingEn
 //
 
 EXTERN_C __declspec(selectany) DECLSPEC_CACHEALIGN ULONG Microsoft_Windows_DotNETRuntimeEnableBits[1];
-EXTERN_C __declspec(selectany) const ULONGLONG Microsoft_Windows_DotNETRuntimeKeywords[30] = {0x1, 0x1, 0x10001, 0x80000, 0x100000, 0x200000, 0x400000, 0x2, 0x2000000, 0x10000, 0x10000, 0x80010000, 0x80010000, 0x0, 0x8000, 0x4000, 0x40000000, 0x800, 0x10800, 0x2000, 0x30, 0x10, 0x1000, 0x20000, 0x8, 0x20000008, 0x20000000, 0x400, 0x400, 0x100000000};
-EXTERN_C __declspec(selectany) const UCHAR Microsoft_Windows_DotNETRuntimeLevels[30] = {4, 5, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 4, 4, 2, 4, 0, 4, 4, 4, 4, 5, 5, 5, 4, 4, 4, 5, 4, 4};
-EXTERN_C __declspec(selectany) MCGEN_TRACE_CONTEXT MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_Context = {0, 0, 0, 0, 0, 0, 0, 0, 30, Microsoft_Windows_DotNETRuntimeEnableBits, Microsoft_Windows_DotNETRuntimeKeywords, Microsoft_Windows_DotNETRuntimeLevels};
+EXTERN_C __declspec(selectany) const ULONGLONG Microsoft_Windows_DotNETRuntimeKeywords[31] = {0x1, 0x1, 0x10001, 0x80000, 0x100000, 0x200000, 0x400000, 0x2, 0x2000000, 0x10000, 0x10000, 0x80010000, 0x80010000, 0x0, 0x8000, 0x4000, 0x40000000, 0x800, 0x10800, 0x2000, 0x30, 0x10, 0x1000, 0x20000, 0x8, 0x20000008, 0x20000000, 0x400, 0x400, 0x100000000, 0x4000};
+EXTERN_C __declspec(selectany) const UCHAR Microsoft_Windows_DotNETRuntimeLevels[31] = {4, 5, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 4, 4, 2, 4, 0, 4, 4, 4, 4, 5, 5, 5, 4, 4, 4, 5, 4, 4, 5};
+EXTERN_C __declspec(selectany) MCGEN_TRACE_CONTEXT MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_Context = {0, 0, 0, 0, 0, 0, 0, 0, 31, Microsoft_Windows_DotNETRuntimeEnableBits, Microsoft_Windows_DotNETRuntimeKeywords, Microsoft_Windows_DotNETRuntimeLevels};
 
 EXTERN_C __declspec(selectany) REGHANDLE Microsoft_Windows_DotNETRuntimeHandle = (REGHANDLE)0;
 
@@ -1084,6 +1092,34 @@ Remarks:
         CoTemplate_h(Microsoft_Windows_DotNETRuntimeHandle, &GCSuspendEEEnd_V1, ClrInstanceID)\
         : ERROR_SUCCESS\
 
+//
+// Enablement check macro for GCSuspendEEEnd_V2
+//
+
+#define EventEnabledGCSuspendEEEnd_V2() ((Microsoft_Windows_DotNETRuntimeEnableBits[0] & 0x00000001) != 0)
+
+//
+// Event Macro for GCSuspendEEEnd_V2
+//
+#define FireEtwGCSuspendEEEnd_V2(ClrInstanceID, SuspendDuration, RendezvousCount, ActivationCount)\
+        EventEnabledGCSuspendEEEnd_V2() ?\
+        CoTemplate_hqqq(Microsoft_Windows_DotNETRuntimeHandle, &GCSuspendEEEnd_V2, ClrInstanceID, SuspendDuration, RendezvousCount, ActivationCount)\
+        : ERROR_SUCCESS\
+
+//
+// Enablement check macro for GCSuspendEEStats
+//
+
+#define EventEnabledGCSuspendEEStats() ((Microsoft_Windows_DotNETRuntimeEnableBits[0] & 0x00000001) != 0)
+
+//
+// Event Macro for GCSuspendEEStats
+//
+#define FireEtwGCSuspendEEStats(ClrInstanceID, RetryCount, InterruptibleCount, HijackableCount, NativeCount, UnknownCount, MaxTimeToSafePoint, OffenderThreadID, OffenderReason, OffenderIP)\
+        EventEnabledGCSuspendEEStats() ?\
+        CoTemplate_hqqqqqqqqp(Microsoft_Windows_DotNETRuntimeHandle, &GCSuspendEEStats, ClrInstanceID, RetryCount, InterruptibleCount, HijackableCount, NativeCount, UnknownCount, MaxTimeToSafePoint, OffenderThreadID, OffenderReason, OffenderIP)\
+        : ERROR_SUCCESS\
+
 //
 // Enablement check macro for GCSuspendEEBegin
 //
@@ -2078,6 +2114,20 @@ Remarks:
         CoTemplate_ch(Microsoft_Windows_DotNETRuntimeHandle, &ContentionStop, ContentionFlags, ClrInstanceID)\
         : ERROR_SUCCESS\
 
+//
+// Enablement check macro for ContentionStats
+//
+
+#define EventEnabledContentionStats() ((Microsoft_Windows_DotNETRuntimeEnableBits[0] & 0x40000000) != 0)
+
+//
+// Event Macro for ContentionStats
+//
+#define FireEtwContentionStats(LockID, OwnerThreadID, WaitDuration, SpinSucceeded, SpinSuccessRate, ContentionCount, SpinSuccessCount, TotalWaitDuration, ClrInstanceID)\
+        EventEnabledContentionStats() ?\
+        CoTemplate_pqxchqqxh(Microsoft_Windows_DotNETRuntimeHandle, &ContentionStats, LockID, OwnerThreadID, WaitDuration, SpinSucceeded, SpinSuccessRate, ContentionCount, SpinSuccessCount, TotalWaitDuration, ClrInstanceID)\
+        : ERROR_SUCCESS\
+
 //
 // Enablement check macro for CLRStackWalk
 //
@@ -7672,6 +7722,108 @@ MCGEN_CALLOUT(RegHandle,
 }
 #endif
 
+//
+//Template from manifest : GCSuspendEEEnd_V2
+//
+#ifndef CoTemplate_hqqq_def
+#define CoTemplate_hqqq_def
+ETW_INLINE
+ULONG
+CoTemplate_hqqq(
+    _In_ REGHANDLE RegHandle,
+    _In_ PCEVENT_DESCRIPTOR Descriptor,
+    _In_ const unsigned short  _Arg0,
+    _In_ const unsigned int  _Arg1,
+    _In_ const unsigned int  _Arg2,
+    _In_ const unsigned int  _Arg3
+    )
+{
+#define ARGUMENT_COUNT_hqqq 4
+    ULONG Error = ERROR_SUCCESS;
+
+    EVENT_DATA_DESCRIPTOR EventData[ARGUMENT_COUNT_hqqq];
+
+    EventDataDescCreate(&EventData[0], &_Arg0, sizeof(const unsigned short)  );
+
+    EventDataDescCreate(&EventData[1], &_Arg1, sizeof(const unsigned int)  );
+
+    EventDataDescCreate(&EventData[2], &_Arg2, sizeof(const unsigned int)  );
+
+    EventDataDescCreate(&EventData[3], &_Arg3, sizeof(const unsigned int)  );
+
+    Error = EventWrite(RegHandle, Descriptor, ARGUMENT_COUNT_hqqq, EventData);
+
+#ifdef MCGEN_CALLOUT
+MCGEN_CALLOUT(RegHandle,
+              Descriptor,
+              ARGUMENT_COUNT_hqqq,
+              EventData);
+#endif
+
+    return Error;
+}
+#endif
+
+//
+//Template from manifest : GCSuspendEEStats
+//
+#ifndef CoTemplate_hqqqqqqqqp_def
+#define CoTemplate_hqqqqqqqqp_def
+ETW_INLINE
+ULONG
+CoTemplate_hqqqqqqqqp(
+    _In_ REGHANDLE RegHandle,
+    _In_ PCEVENT_DESCRIPTOR Descriptor,
+    _In_ const unsigned short  _Arg0,
+    _In_ const unsigned int  _Arg1,
+    _In_ const unsigned int  _Arg2,
+    _In_ const unsigned int  _Arg3,
+    _In_ const unsigned int  _Arg4,
+    _In_ const unsigned int  _Arg5,
+    _In_ const unsigned int  _Arg6,
+    _In_ const unsigned int  _Arg7,
+    _In_ const unsigned int  _Arg8,
+    _In_opt_ const void *  _Arg9
+    )
+{
+#define ARGUMENT_COUNT_hqqqqqqqqp 10
+    ULONG Error = ERROR_SUCCESS;
+
+    EVENT_DATA_DESCRIPTOR EventData[ARGUMENT_COUNT_hqqqqqqqqp];
+
+    EventDataDescCreate(&EventData[0], &_Arg0, sizeof(const unsigned short)  );
+
+    EventDataDescCreate(&EventData[1], &_Arg1, sizeof(const unsigned int)  );
+
+    EventDataDescCreate(&EventData[2], &_Arg2, sizeof(const unsigned int)  );
+
+    EventDataDescCreate(&EventData[3], &_Arg3, sizeof(const unsigned int)  );
+
+    EventDataDescCreate(&EventData[4], &_Arg4, sizeof(const unsigned int)  );
+
+    EventDataDescCreate(&EventData[5], &_Arg5, sizeof(const unsigned int)  );
+
+    EventDataDescCreate(&EventData[6], &_Arg6, sizeof(const unsigned int)  );
+
+    EventDataDescCreate(&EventData[7], &_Arg7, sizeof(const unsigned int)  );
+
+    EventDataDescCreate(&EventData[8], &_Arg8, sizeof(const unsigned int)  );
+
+    EventDataDescCreate(&EventData[9], &_Arg9, sizeof(PVOID)  );
+
+    Error = EventWrite(RegHandle, Descriptor, ARGUMENT_COUNT_hqqqqqqqqp, EventData);
+
+#ifdef MCGEN_CALLOUT
+MCGEN_CALLOUT(RegHandle,
+              Descriptor,
+              ARGUMENT_COUNT_hqqqqqqqqp,
+              EventData);
+#endif
+
+    return Error;
+}
+#endif
+
 //
 //Template from manifest : GCHeapStats
 //
@@ -8762,6 +8914,63 @@ MCGEN_CALLOUT(RegHandle,
 }
 #endif
 
+//
+//Template from manifest : ContentionStats
+//
+#ifndef CoTemplate_pqxchqqxh_def
+#define CoTemplate_pqxchqqxh_def
+ETW_INLINE
+ULONG
+CoTemplate_pqxchqqxh(
+    _In_ REGHANDLE RegHandle,
+    _In_ PCEVENT_DESCRIPTOR Descriptor,
+    _In_opt_ const void *  _Arg0,
+    _In_ const unsigned int  _Arg1,
+    _In_ unsigned __int64  _Arg2,
+    _In_ const UCHAR  _Arg3,
+    _In_ const unsigned short  _Arg4,
+    _In_ const unsigned int  _Arg5,
+    _In_ const unsigned int  _Arg6,
+    _In_ unsigned __int64  _Arg7,
+    _In_ const unsigned short  _Arg8
+    )
+{
+#define ARGUMENT_COUNT_pqxchqqxh 9
+    ULONG Error = ERROR_SUCCESS;
+
+    EVENT_DATA_DESCRIPTOR EventData[ARGUMENT_COUNT_pqxchqqxh];
+
+    EventDataDescCreate(&EventData[0], &_Arg0, sizeof(PVOID)  );
+
+    EventDataDescCreate(&EventData[1], &_Arg1, sizeof(const unsigned int)  );
+
+    EventDataDescCreate(&EventData[2], &_Arg2, sizeof(unsigned __int64)  );
+
+    EventDataDescCreate(&EventData[3], &_Arg3, sizeof(const UCHAR)  );
+
+    EventDataDescCreate(&EventData[4], &_Arg4, sizeof(const unsigned short)  );
+
+    EventDataDescCreate(&EventData[5], &_Arg5, sizeof(const unsigned int)  );
+
+    EventDataDescCreate(&EventData[6], &_Arg6, sizeof(const unsigned int)  );
+
+    EventDataDescCreate(&EventData[7], &_Arg7, sizeof(unsigned __int64)  );
+
+    EventDataDescCreate(&EventData[8], &_Arg8, sizeof(const unsigned short)  );
+
+    Error = EventWrite(RegHandle, Descriptor, ARGUMENT_COUNT_pqxchqqxh, EventData);
+
+#ifdef MCGEN_CALLOUT
+MCGEN_CALLOUT(RegHandle,
+              Descriptor,
+              ARGUMENT_COUNT_pqxchqqxh,
+              EventData);
+#endif
+
+    return Error;
+}
+#endif
+
 //
 //Template from manifest : ClrStackWalk
 //
@@ -12325,6 +12534,7 @@ MCGEN_CALLOUT(RegHandle,
 #define MSG_RuntimePublisher_GCBulkRootCCWOpcodeMessage 0x30010026L
 #define MSG_RuntimePublisher_GCBulkRCWOpcodeMessage 0x30010027L
 #define MSG_RuntimePublisher_GCBulkRootStaticVarOpcodeMessage 0x30010028L
+#define MSG_RuntimePublisher_GCSuspendEEStatsOpcodeMessage 0x30010029L
 #define MSG_RuntimePublisher_GCRestartEEEndOpcodeMessage 0x30010084L
 #define MSG_RuntimePublisher_GCHeapStatsOpcodeMessage 0x30010085L
 #define MSG_RuntimePublisher_GCCreateSegmentOpcodeMessage 0x30010086L
@@ -12646,6 +12856,8 @@ MCGEN_CALLOUT(RegHandle,
 #define MSG_RuntimePublisher_ILStubGeneratedEventMessage 0xB0000058L
 #define MSG_RuntimePublisher_ILStubCacheHitEventMessage 0xB0000059L
 #define MSG_RuntimePublisher_ContentionStopEventMessage 0xB000005BL
+#define MSG_RuntimePublisher_ContentionStatsEventMessage 0xB000005CL
+#define MSG_RuntimePublisher_GCSuspendEEStatsEventMessage 0xB000005DL
 #define MSG_RuntimePublisher_DCStartCompleteEventMessage 0xB0000087L
 #define MSG_RuntimePublisher_DCEndCompleteEventMessage 0xB0000088L
 #define MSG_RuntimePublisher_MethodDCStartEventMessage 0xB0000089L
@@ -12716,6 +12928,7 @@ MCGEN_CALLOUT(RegHandle,
 #define MSG_RuntimePublisher_AuthenticodeVerificationStart_V1EventMessage 0xB00100B7L
 #define MSG_RuntimePublisher_AuthenticodeVerificationEnd_V1EventMessage 0xB00100B8L
 #define MSG_RuntimePublisher_GCStart_V2EventMessage 0xB0020001L
+#define MSG_RuntimePublisher_GCSuspendEEEnd_V2EventMessage 0xB0020008L
 #define MSG_RuntimePublisher_GCAllocationTick_V2EventMessage 0xB002000AL
 #define MSG_RuntimePublisher_MethodLoad_V2EventMessage 0xB002008DL
 #define MSG_RuntimePublisher_MethodUnload_V2EventMessage 0xB002008EL
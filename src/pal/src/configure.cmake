@@ -25,6 +25,8 @@ check_include_files(libunwind.h HAVE_LIBUNWIND_H)
 check_include_files(runetype.h HAVE_RUNETYPE_H)
 
 check_function_exists(kqueue HAVE_KQUEUE)
+check_function_exists(epoll_create1 HAVE_EPOLL)
+check_function_exists(eventfd HAVE_EVENTFD)
 check_function_exists(getpwuid_r HAVE_GETPWUID_R)
 check_function_exists(pthread_suspend HAVE_PTHREAD_SUSPEND)
 check_function_exists(pthread_suspend_np HAVE_PTHREAD_SUSPEND_NP)
@@ -144,6 +144,36 @@ PAL_SetHardwareExceptionHandler(PHARDWARE_EXCEPTION_HANDLER handler)
     g_hardwareExceptionHandler = handler;
 }
 
+PAL_ActivationFunction g_activationFunction = NULL;
+PAL_SafeActivationCheckFunction g_safeActivationCheckFunction = NULL;
+
+/*++
+Function :
+    PAL_SetActivationFunction
+
+    Register the functions called on a thread interrupted by
+    PAL_InjectActivation. They must be registered before the first
+    activation is injected and cannot be changed afterwards.
+
+Parameters :
+    PAL_ActivationFunction pActivationFunction : runs on the interrupted thread
+    PAL_SafeActivationCheckFunction pSafeActivationCheckFunction : decides
+        whether the interrupted instruction pointer can run the activation
+
+    (no return value)
+--*/
+VOID
+PALAPI
+PAL_SetActivationFunction(
+    IN PAL_ActivationFunction pActivationFunction,
+    IN PAL_SafeActivationCheckFunction pSafeActivationCheckFunction)
+{
+    _ASSERTE(g_activationFunction == NULL && g_safeActivationCheckFunction == NULL);
+
+    g_safeActivationCheckFunction = pSafeActivationCheckFunction;
+    g_activationFunction = pActivationFunction;
+}
+
 #ifdef FEATURE_PAL_SXS
 BOOL
 PALAPI
@@ -56,6 +56,13 @@ typedef void *siginfo_t;
 #endif  /* !HAVE_SIGINFO_T */
 typedef void (*SIGFUNC)(int, siginfo_t *, void *);
 
+#ifdef SIGRTMIN
+// Signal used by PAL_InjectActivation to interrupt a thread. Real-time
+// signals are queued rather than coalesced and the PAL uses none of them
+// for anything else.
+#define INJECT_ACTIVATION_SIGNAL SIGRTMIN
+#endif
+
 /* Static variables ***********************************************************/
 static LONG fatal_signal_received;
 
@@ -69,6 +76,9 @@ static void sigsegv_handler(int code, siginfo_t *siginfo, void *context);
 static void sigtrap_handler(int code, siginfo_t *siginfo, void *context);
 static void sigbus_handler(int code, siginfo_t *siginfo, void *context);
 static void fatal_signal_handler(int code, siginfo_t *siginfo, void *context);
+#ifdef INJECT_ACTIVATION_SIGNAL
+static void inject_activation_handler(int code, siginfo_t *siginfo, void *context);
+#endif
 static void common_signal_handler(PEXCEPTION_POINTERS pointers, int code, 
                                   native_context_t *ucontext);
 
@@ -132,6 +142,9 @@ void SEHInitializeSignals(DWORD flags)
     handle_signal(SIGFPE,    sigfpe_handler);
     handle_signal(SIGBUS,    sigbus_handler);
     handle_signal(SIGSEGV,   sigsegv_handler);
+#ifdef INJECT_ACTIVATION_SIGNAL
+    handle_signal(INJECT_ACTIVATION_SIGNAL, inject_activation_handler);
+#endif
 
     if (flags & PAL_INITIALIZE_ALL_SIGNALS)
     {
@@ -202,6 +215,9 @@ void SEHCleanupSignals (DWORD flags)
     handle_signal(SIGFPE, NULL);
     handle_signal(SIGBUS, NULL);
     handle_signal(SIGSEGV, NULL);
+#ifdef INJECT_ACTIVATION_SIGNAL
+    handle_signal(INJECT_ACTIVATION_SIGNAL, NULL);
+#endif
 
     if (flags & PAL_INITIALIZE_ALL_SIGNALS)
     {
@@ -448,6 +464,74 @@ static void sigbus_handler(int code, siginfo_t *siginfo, void *context)
     TRACE("SIGBUS Signal was handled; continuing execution.\n");
 }
 
+#ifdef INJECT_ACTIVATION_SIGNAL
+/*++
+Function :
+    inject_activation_handler
+
+    handle the activation signal sent by InjectActivationInternal: run the
+    registered activation function on the context of the interrupted code
+
+Parameters :
+    POSIX signal handler parameter list ("man sigaction" for details)
+
+    (no return value)
+--*/
+static void inject_activation_handler(int code, siginfo_t *siginfo, void *context)
+{
+    // Only activations sent by this process are honored; the signal is
+    // otherwise ignored, as it was before the handler was installed.
+    if (g_activationFunction != NULL && siginfo->si_pid == (pid_t)gPID)
+    {
+        native_context_t *ucontext = (native_context_t *)context;
+        int savedErrNo = errno;
+
+        if (g_safeActivationCheckFunction((SIZE_T)CONTEXTGetPC(ucontext)))
+        {
+            CONTEXT winContext;
+            CONTEXTFromNativeContext(ucontext, &winContext,
+                                     CONTEXT_CONTROL | CONTEXT_INTEGER);
+
+            g_activationFunction(&winContext);
+
+            // The activation function may have changed the context
+            CONTEXTToNativeContext(&winContext, ucontext);
+        }
+
+        errno = savedErrNo;
+    }
+}
+
+/*++
+Function :
+    InjectActivationInternal
+
+    Interrupt the specified thread with the activation signal
+
+Parameters :
+    CPalThread * pThread : thread to interrupt
+
+Return value :
+    NO_ERROR if the signal was sent, an error code otherwise
+--*/
+PAL_ERROR InjectActivationInternal(CorUnix::CPalThread *pThread)
+{
+    int status = pthread_kill(pThread->GetPThreadSelf(), INJECT_ACTIVATION_SIGNAL);
+    if (status != 0)
+    {
+        // ESRCH means the thread has already exited
+        return (status == ESRCH) ? ERROR_INVALID_HANDLE : ERROR_INTERNAL_ERROR;
+    }
+
+    return NO_ERROR;
+}
+#else // INJECT_ACTIVATION_SIGNAL
+PAL_ERROR InjectActivationInternal(CorUnix::CPalThread *pThread)
+{
+    return ERROR_NOT_SUPPORTED;
+}
+#endif // INJECT_ACTIVATION_SIGNAL
+
 /*++
 Function :
     SEHSetSafeState
@@ -0,0 +1,1030 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+//
+
+/*++
+
+
+
+Module Name:
+
+    iocompletion.cpp
+
+Abstract:
+
+    Implementation of I/O completion ports on top of epoll. The epoll set
+    of a port holds the descriptors of the handles associated with it and
+    an eventfd that counts the packets queued by PostQueuedCompletionStatus,
+    so that a single epoll_wait returns both kinds of packets.
+
+
+
+--*/
+
+#include "pal/thread.hpp"
+#include "pal/file.hpp"
+#include "pal/iocompletion.hpp"
+#include "pal/malloc.hpp"
+#include "pal/palinternal.h"
+#include "pal/dbgmsg.h"
+
+#include <errno.h>
+#include <unistd.h>
+#include <poll.h>
+
+#if HAVE_EPOLL && HAVE_EVENTFD
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#endif // HAVE_EPOLL && HAVE_EVENTFD
+
+using namespace CorUnix;
+
+SET_DEFAULT_DEBUG_CHANNEL(FILE);
+
+//
+// Upper bound on the number of epoll events collected by one wait.
+// GetQueuedCompletionStatusEx callers asking for more get at most this
+// many entries per call.
+//
+
+#define IOCP_MAX_EVENTS_PER_WAIT 64
+
+//
+// epoll_wait takes the timeout as an int. Longer finite waits are split
+// into waits of at most this many milliseconds.
+//
+
+#define IOCP_MAX_WAIT_MILLISECONDS 0x7fffffff
+
+void
+IOCompletionPortCleanupRoutine(
+    CPalThread *pThread,
+    IPalObject *pObjectToCleanup,
+    bool fShutdown,
+    bool fCleanupSharedState
+    );
+
+PAL_ERROR
+IOCompletionPortInitializationRoutine(
+    CPalThread *pThread,
+    CObjectType *pObjectType,
+    void *pImmutableData,
+    void *pSharedData,
+    void *pProcessLocalData
+    );
+
+CObjectType CorUnix::otIOCompletionPort(
+                otiIOCompletionPort,
+                IOCompletionPortCleanupRoutine,
+                IOCompletionPortInitializationRoutine,
+                0,      // No immutable data
+                sizeof(CIOCompletionPortProcessLocalData),
+                0,      // No shared data
+                0,      // Should be IO_COMPLETION_ALL_ACCESS; currently ignored (no Win32 security)
+                CObjectType::SecuritySupported,
+                CObjectType::SecurityInfoNotPersisted,
+                CObjectType::UnnamedObject,
+                CObjectType::LocalDuplicationOnly,
+                CObjectType::UnwaitableObject,
+                CObjectType::SignalingNotApplicable,
+                CObjectType::ThreadReleaseNotApplicable,
+                CObjectType::OwnershipNotApplicable
+                );
+
+CAllowedObjectTypes CorUnix::aotIOCompletionPort(otiIOCompletionPort);
+
+PAL_ERROR
+IOCompletionPortInitializationRoutine(
+    CPalThread *pThread,
+    CObjectType *pObjectType,
+    void *pvImmutableData,
+    void *pvSharedData,
+    void *pvProcessLocalData
+    )
+{
+    CIOCompletionPortProcessLocalData *pLocalData =
+        reinterpret_cast<CIOCompletionPortProcessLocalData *>(pvProcessLocalData);
+
+    pLocalData->epollFd = -1;
+    pLocalData->eventFd = -1;
+    pLocalData->pFirstPacket = NULL;
+    pLocalData->pLastPacket = NULL;
+
+    return NO_ERROR;
+}
+
+void
+IOCompletionPortCleanupRoutine(
+    CPalThread *pThread,
+    IPalObject *pObjectToCleanup,
+    bool fShutdown,
+    bool fCleanupSharedState
+    )
+{
+    PAL_ERROR palError = NO_ERROR;
+    CIOCompletionPortProcessLocalData *pLocalData = NULL;
+    IDataLock *pLocalDataLock = NULL;
+    PIOCP_PACKET pPacket;
+
+    if (TRUE == fShutdown)
+    {
+        //
+        // The descriptors and the packet memory go away with the process
+        //
+
+        return;
+    }
+
+    palError = pObjectToCleanup->GetProcessLocalData(
+        pThread,
+        WriteLock,
+        &pLocalDataLock,
+        reinterpret_cast<void**>(&pLocalData)
+        );
+
+    if (NO_ERROR != palError)
+    {
+        ASSERT("Unable to obtain process local data for object to be reclaimed");
+        return;
+    }
+
+    if (-1 != pLocalData->epollFd)
+    {
+        close(pLocalData->epollFd);
+        pLocalData->epollFd = -1;
+    }
+
+    if (-1 != pLocalData->eventFd)
+    {
+        close(pLocalData->eventFd);
+        pLocalData->eventFd = -1;
+    }
+
+    while (NULL != pLocalData->pFirstPacket)
+    {
+        pPacket = pLocalData->pFirstPacket;
+        pLocalData->pFirstPacket = pPacket->pNext;
+        InternalFree(pThread, pPacket);
+    }
+    pLocalData->pLastPacket = NULL;
+
+    pLocalDataLock->ReleaseLock(pThread, TRUE);
+}
+
+/*++
+Function:
+  CreateIoCompletionPort
+
+Note:
+  NumberOfConcurrentThreads is ignored: the PAL does not throttle the
+  number of threads that are released from a port.
+  Only handles backed by a descriptor that epoll supports (pipes,
+  sockets, character devices) can be associated with a port.
+
+See MSDN doc.
+--*/
+HANDLE
+PALAPI
+CreateIoCompletionPort(
+    IN HANDLE FileHandle,
+    IN HANDLE ExistingCompletionPort,
+    IN ULONG_PTR CompletionKey,
+    IN DWORD NumberOfConcurrentThreads)
+{
+    HANDLE hCompletionPort = NULL;
+    CPalThread *pThread;
+    PAL_ERROR palError;
+
+    PERF_ENTRY(CreateIoCompletionPort);
+    ENTRY("CreateIoCompletionPort(FileHandle=%p, ExistingCompletionPort=%p, "
+          "CompletionKey=%p, NumberOfConcurrentThreads=%u)\n",
+          FileHandle, ExistingCompletionPort, (void *)CompletionKey,
+          NumberOfConcurrentThreads);
+
+    pThread = InternalGetCurrentThread();
+
+    palError = InternalCreateIoCompletionPort(
+        pThread,
+        FileHandle,
+        ExistingCompletionPort,
+        CompletionKey,
+        &hCompletionPort
+        );
+
+    if (NO_ERROR != palError)
+    {
+        pThread->SetLastError(palError);
+    }
+
+    LOGEXIT("CreateIoCompletionPort returns HANDLE %p\n", hCompletionPort);
+    PERF_EXIT(CreateIoCompletionPort);
+    return hCompletionPort;
+}
+
+/*++
+Function:
+  PostQueuedCompletionStatus
+
+See MSDN doc.
+--*/
+BOOL
+PALAPI
+PostQueuedCompletionStatus(
+    IN HANDLE CompletionPort,
+    IN DWORD dwNumberOfBytesTransferred,
+    IN ULONG_PTR dwCompletionKey,
+    IN LPOVERLAPPED lpOverlapped)
+{
+    CPalThread *pThread;
+    PAL_ERROR palError;
+
+    PERF_ENTRY(PostQueuedCompletionStatus);
+    ENTRY("PostQueuedCompletionStatus(CompletionPort=%p, dwNumberOfBytesTransferred=%u, "
+          "dwCompletionKey=%p, lpOverlapped=%p)\n",
+          CompletionPort, dwNumberOfBytesTransferred, (void *)dwCompletionKey,
+          lpOverlapped);
+
+    pThread = InternalGetCurrentThread();
+
+    palError = InternalPostQueuedCompletionStatus(
+        pThread,
+        CompletionPort,
+        dwNumberOfBytesTransferred,
+        dwCompletionKey,
+        lpOverlapped
+        );
+
+    if (NO_ERROR != palError)
+    {
+        pThread->SetLastError(palError);
+    }
+
+    LOGEXIT("PostQueuedCompletionStatus returns BOOL %d\n", NO_ERROR == palError);
+    PERF_EXIT(PostQueuedCompletionStatus);
+    return NO_ERROR == palError;
+}
+
+/*++
+Function:
+  GetQueuedCompletionStatus
+
+See MSDN doc.
+--*/
+BOOL
+PALAPI
+GetQueuedCompletionStatus(
+    IN HANDLE CompletionPort,
+    OUT LPDWORD lpNumberOfBytesTransferred,
+    OUT PULONG_PTR lpCompletionKey,
+    OUT LPOVERLAPPED *lpOverlapped,
+    IN DWORD dwMilliseconds)
+{
+    CPalThread *pThread;
+    PAL_ERROR palError;
+    OVERLAPPED_ENTRY entry;
+    ULONG ulNumEntriesRemoved = 0;
+
+    PERF_ENTRY(GetQueuedCompletionStatus);
+    ENTRY("GetQueuedCompletionStatus(CompletionPort=%p, lpNumberOfBytesTransferred=%p, "
+          "lpCompletionKey=%p, lpOverlapped=%p, dwMilliseconds=%u)\n",
+          CompletionPort, lpNumberOfBytesTransferred, lpCompletionKey,
+          lpOverlapped, dwMilliseconds);
+
+    pThread = InternalGetCurrentThread();
+
+    palError = InternalGetQueuedCompletionStatus(
+        pThread,
+        CompletionPort,
+        &entry,
+        1,
+        &ulNumEntriesRemoved,
+        dwMilliseconds
+        );
+
+    if (NO_ERROR == palError)
+    {
+        *lpNumberOfBytesTransferred = entry.dwNumberOfBytesTransferred;
+        *lpCompletionKey = entry.lpCompletionKey;
+        *lpOverlapped = entry.lpOverlapped;
+    }
+    else
+    {
+        *lpOverlapped = NULL;
+        pThread->SetLastError(palError);
+    }
+
+    LOGEXIT("GetQueuedCompletionStatus returns BOOL %d\n", NO_ERROR == palError);
+    PERF_EXIT(GetQueuedCompletionStatus);
+    return NO_ERROR == palError;
+}
+
+/*++
+Function:
+  GetQueuedCompletionStatusEx
+
+Note:
+  fAlertable is ignored: the PAL does not deliver APCs to threads that
+  wait on a completion port.
+  At most IOCP_MAX_EVENTS_PER_WAIT entries are removed per call.
+
+See MSDN doc.
+--*/
+BOOL
+PALAPI
+GetQueuedCompletionStatusEx(
+    IN HANDLE CompletionPort,
+    OUT LPOVERLAPPED_ENTRY lpCompletionPortEntries,
+    IN ULONG ulCount,
+    OUT PULONG ulNumEntriesRemoved,
+    IN DWORD dwMilliseconds,
+    IN BOOL fAlertable)
+{
+    CPalThread *pThread;
+    PAL_ERROR palError;
+
+    PERF_ENTRY(GetQueuedCompletionStatusEx);
+    ENTRY("GetQueuedCompletionStatusEx(CompletionPort=%p, lpCompletionPortEntries=%p, "
+          "ulCount=%u, ulNumEntriesRemoved=%p, dwMilliseconds=%u, fAlertable=%d)\n",
+          CompletionPort, lpCompletionPortEntries, ulCount, ulNumEntriesRemoved,
+          dwMilliseconds, fAlertable);
+
+    pThread = InternalGetCurrentThread();
+
+    palError = InternalGetQueuedCompletionStatus(
+        pThread,
+        CompletionPort,
+        lpCompletionPortEntries,
+        ulCount,
+        ulNumEntriesRemoved,
+        dwMilliseconds
+        );
+
+    if (NO_ERROR != palError)
+    {
+        pThread->SetLastError(palError);
+    }
+
+    LOGEXIT("GetQueuedCompletionStatusEx returns BOOL %d\n", NO_ERROR == palError);
+    PERF_EXIT(GetQueuedCompletionStatusEx);
+    return NO_ERROR == palError;
+}
+
+#if HAVE_EPOLL && HAVE_EVENTFD
+
+static
+PAL_ERROR
+IOCPAssociateHandle(
+    CPalThread *pThread,
+    CIOCompletionPortProcessLocalData *pPortData,
+    HANDLE hFile,
+    ULONG_PTR CompletionKey
+    )
+{
+    PAL_ERROR palError = NO_ERROR;
+    IPalObject *pFileObject = NULL;
+    CFileProcessLocalData *pFileLocalData = NULL;
+    IDataLock *pFileLocalDataLock = NULL;
+    struct epoll_event ev;
+
+    palError = g_pObjectManager->ReferenceObjectByHandle(
+        pThread,
+        hFile,
+        &aotFile,
+        0,
+        &pFileObject
+        );
+
+    if (NO_ERROR != palError)
+    {
+        ERROR("Unable to obtain file data.\n");
+        goto IOCPAssociateHandleExit;
+    }
+
+    palError = pFileObject->GetProcessLocalData(
+        pThread,
+        ReadLock,
+        &pFileLocalDataLock,
+        reinterpret_cast<void**>(&pFileLocalData)
+        );
+
+    if (NO_ERROR != palError)
+    {
+        goto IOCPAssociateHandleExit;
+    }
+
+    //
+    // Readiness is edge triggered: a packet is queued each time the
+    // descriptor goes from not ready to ready, and the owner of the
+    // handle is expected to consume it until the call would block.
+    //
+
+    ev.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+    ev.data.u64 = (UINT64)CompletionKey;
+
+    if (-1 == epoll_ctl(pPortData->epollFd, EPOLL_CTL_ADD, pFileLocalData->unix_fd, &ev))
+    {
+        ERROR("epoll_ctl(EPOLL_CTL_ADD) failed for fd %d (%s)\n",
+              pFileLocalData->unix_fd, strerror(errno));
+
+        switch (errno)
+        {
+        case EEXIST:
+            palError = ERROR_INVALID_PARAMETER;
+            break;
+        case EPERM:
+            palError = ERROR_NOT_SUPPORTED;
+            break;
+        case ENOMEM:
+        case ENOSPC:
+            palError = ERROR_NOT_ENOUGH_MEMORY;
+            break;
+        default:
+            palError = ERROR_INVALID_HANDLE;
+            break;
+        }
+    }
+
+    pFileLocalDataLock->ReleaseLock(pThread, FALSE);
+
+IOCPAssociateHandleExit:
+
+    if (NULL != pFileObject)
+    {
+        pFileObject->ReleaseReference(pThread);
+    }
+
+    return palError;
+}
+
+static
+PAL_ERROR
+IOCPAllocatePort(
+    CPalThread *pThread,
+    HANDLE *phCompletionPort,
+    IPalObject **ppobjRegisteredPort
+    )
+{
+    CObjectAttributes oa;
+    PAL_ERROR palError = NO_ERROR;
+    IPalObject *pobjPort = NULL;
+    CIOCompletionPortProcessLocalData *pLocalData = NULL;
+    IDataLock *pLocalDataLock = NULL;
+    int epollFd = -1;
+    int eventFd = -1;
+    struct epoll_event ev;
+
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (-1 == epollFd)
+    {
+        ERROR("epoll_create1 failed (%s)\n", strerror(errno));
+        palError = (ENOMEM == errno) ? ERROR_NOT_ENOUGH_MEMORY : ERROR_INTERNAL_ERROR;
+        goto IOCPAllocatePortExit;
+    }
+
+    eventFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (-1 == eventFd)
+    {
+        ERROR("eventfd failed (%s)\n", strerror(errno));
+        palError = (ENOMEM == errno) ? ERROR_NOT_ENOUGH_MEMORY : ERROR_INTERNAL_ERROR;
+        goto IOCPAllocatePortExit;
+    }
+
+    palError = g_pObjectManager->AllocateObject(
+        pThread,
+        &otIOCompletionPort,
+        &oa,
+        &pobjPort
+        );
+
+    if (NO_ERROR != palError)
+    {
+        goto IOCPAllocatePortExit;
+    }
+
+    palError = pobjPort->GetProcessLocalData(
+        pThread,
+        WriteLock,
+        &pLocalDataLock,
+        reinterpret_cast<void**>(&pLocalData)
+        );
+
+    if (NO_ERROR != palError)
+    {
+        goto IOCPAllocatePortExit;
+    }
+
+    //
+    // The eventfd is level triggered so that every waiter keeps being
+    // woken up while posted packets remain. Its epoll data is the address
+    // of the port's own data, which no caller can use as a completion key.
+    //
+
+    ev.events = EPOLLIN;
+    ev.data.ptr = pLocalData;
+
+    if (-1 == epoll_ctl(epollFd, EPOLL_CTL_ADD, eventFd, &ev))
+    {
+        ERROR("epoll_ctl(EPOLL_CTL_ADD) failed for the eventfd (%s)\n", strerror(errno));
+        palError = ERROR_INTERNAL_ERROR;
+        goto IOCPAllocatePortExit;
+    }
+
+    pLocalData->epollFd = epollFd;
+    pLocalData->eventFd = eventFd;
+    epollFd = -1;
+    eventFd = -1;
+
+    pLocalDataLock->ReleaseLock(pThread, TRUE);
+    pLocalDataLock = NULL;
+
+    palError = g_pObjectManager->RegisterObject(
+        pThread,
+        pobjPort,
+        &aotIOCompletionPort,
+        0, // Should be IO_COMPLETION_ALL_ACCESS; currently ignored (no Win32 security)
+        phCompletionPort,
+        ppobjRegisteredPort
+        );
+
+    //
+    // pobjPort is invalidated by the call to RegisterObject, so NULL it
+    // out here to ensure that we don't try to release a reference on
+    // it down the line. The descriptors are now owned by the object.
+    //
+
+    pobjPort = NULL;
+
+IOCPAllocatePortExit:
+
+    if (NULL != pLocalDataLock)
+    {
+        pLocalDataLock->ReleaseLock(pThread, TRUE);
+    }
+
+    if (NULL != pobjPort)
+    {
+        pobjPort->ReleaseReference(pThread);
+    }
+
+    if (-1 != epollFd)
+    {
+        close(epollFd);
+    }
+
+    if (-1 != eventFd)
+    {
+        close(eventFd);
+    }
+
+    return palError;
+}
+
+PAL_ERROR
+CorUnix::InternalCreateIoCompletionPort(
+    CPalThread *pThread,
+    HANDLE hFile,
+    HANDLE hExistingCompletionPort,
+    ULONG_PTR CompletionKey,
+    HANDLE *phCompletionPort
+    )
+{
+    PAL_ERROR palError = NO_ERROR;
+    IPalObject *pobjPort = NULL;
+    CIOCompletionPortProcessLocalData *pLocalData = NULL;
+    IDataLock *pLocalDataLock = NULL;
+    HANDLE hNewCompletionPort = NULL;
+
+    _ASSERTE(NULL != pThread);
+    _ASSERTE(NULL != phCompletionPort);
+
+    ENTRY("InternalCreateIoCompletionPort(pThread=%p, hFile=%p, "
+          "hExistingCompletionPort=%p, CompletionKey=%p, phCompletionPort=%p)\n",
+          pThread, hFile, hExistingCompletionPort, (void *)CompletionKey,
+          phCompletionPort);
+
+    if (INVALID_HANDLE_VALUE == hFile && NULL != hExistingCompletionPort)
+    {
+        ERROR("A completion port is given without a handle to associate with it\n");
+        palError = ERROR_INVALID_PARAMETER;
+        goto InternalCreateIoCompletionPortExit;
+    }
+
+    if (NULL == hExistingCompletionPort)
+    {
+        palError = IOCPAllocatePort(pThread, &hNewCompletionPort, &pobjPort);
+    }
+    else
+    {
+        palError = g_pObjectManager->ReferenceObjectByHandle(
+            pThread,
+            hExistingCompletionPort,
+            &aotIOCompletionPort,
+            0,
+            &pobjPort
+            );
+    }
+
+    if (NO_ERROR != palError)
+    {
+        goto InternalCreateIoCompletionPortExit;
+    }
+
+    if (INVALID_HANDLE_VALUE != hFile)
+    {
+        palError = pobjPort->GetProcessLocalData(
+            pThread,
+            ReadLock,
+            &pLocalDataLock,
+            reinterpret_cast<void**>(&pLocalData)
+            );
+
+        if (NO_ERROR != palError)
+        {
+            goto InternalCreateIoCompletionPortExit;
+        }
+
+        palError = IOCPAssociateHandle(pThread, pLocalData, hFile, CompletionKey);
+
+        pLocalDataLock->ReleaseLock(pThread, FALSE);
+
+        if (NO_ERROR != palError)
+        {
+            goto InternalCreateIoCompletionPortExit;
+        }
+    }
+
+    *phCompletionPort = (NULL != hNewCompletionPort) ? hNewCompletionPort : hExistingCompletionPort;
+    hNewCompletionPort = NULL;
+
+InternalCreateIoCompletionPortExit:
+
+    if (NULL != hNewCompletionPort)
+    {
+        g_pObjectManager->RevokeHandle(pThread, hNewCompletionPort);
+    }
+
+    if (NULL != pobjPort)
+    {
+        pobjPort->ReleaseReference(pThread);
+    }
+
+    LOGEXIT("InternalCreateIoCompletionPort returns %d\n", palError);
+
+    return palError;
+}
+
+PAL_ERROR
+CorUnix::InternalPostQueuedCompletionStatus(
+    CPalThread *pThread,
+    HANDLE hCompletionPort,
+    DWORD dwNumberOfBytesTransferred,
+    ULONG_PTR CompletionKey,
+    LPOVERLAPPED lpOverlapped
+    )
+{
+    PAL_ERROR palError = NO_ERROR;
+    IPalObject *pobjPort = NULL;
+    CIOCompletionPortProcessLocalData *pLocalData = NULL;
+    IDataLock *pLocalDataLock = NULL;
+    PIOCP_PACKET pPacket = NULL;
+    int eventFd;
+    UINT64 one = 1;
+
+    if (PAL_IOCP_READINESS_OVERLAPPED == lpOverlapped)
+    {
+        palError = ERROR_INVALID_PARAMETER;
+        goto InternalPostQueuedCompletionStatusExit;
+    }
+
+    pPacket = (PIOCP_PACKET)InternalMalloc(pThread, sizeof(IOCP_PACKET));
+    if (NULL == pPacket)
+    {
+        palError = ERROR_NOT_ENOUGH_MEMORY;
+        goto InternalPostQueuedCompletionStatusExit;
+    }
+
+    pPacket->pNext = NULL;
+    pPacket->dwNumberOfBytesTransferred = dwNumberOfBytesTransferred;
+    pPacket->CompletionKey = CompletionKey;
+    pPacket->lpOverlapped = lpOverlapped;
+
+    palError = g_pObjectManager->ReferenceObjectByHandle(
+        pThread,
+        hCompletionPort,
+        &aotIOCompletionPort,
+        0,
+        &pobjPort
+        );
+
+    if (NO_ERROR != palError)
+    {
+        goto InternalPostQueuedCompletionStatusExit;
+    }
+
+    palError = pobjPort->GetProcessLocalData(
+        pThread,
+        WriteLock,
+        &pLocalDataLock,
+        reinterpret_cast<void**>(&pLocalData)
+        );
+
+    if (NO_ERROR != palError)
+    {
+        goto InternalPostQueuedCompletionStatusExit;
+    }
+
+    if (NULL == pLocalData->pLastPacket)
+    {
+        pLocalData->pFirstPacket = pPacket;
+    }
+    else
+    {
+        pLocalData->pLastPacket->pNext = pPacket;
+    }
+    pLocalData->pLastPacket = pPacket;
+    pPacket = NULL;
+
+    eventFd = pLocalData->eventFd;
+
+    pLocalDataLock->ReleaseLock(pThread, TRUE);
+
+    //
+    // The packet is in the queue before the count is raised, so a waiter
+    // that takes a count from the eventfd always finds a packet to dequeue.
+    //
+
+    if (sizeof(one) != write(eventFd, &one, sizeof(one)))
+    {
+        ASSERT("write to the eventfd of the completion port failed (%s)\n", strerror(errno));
+        palError = ERROR_INTERNAL_ERROR;
+    }
+
+InternalPostQueuedCompletionStatusExit:
+
+    if (NULL != pPacket)
+    {
+        InternalFree(pThread, pPacket);
+    }
+
+    if (NULL != pobjPort)
+    {
+        pobjPort->ReleaseReference(pThread);
+    }
+
+    return palError;
+}
+
+PAL_ERROR
+CorUnix::InternalGetQueuedCompletionStatus(
+    CPalThread *pThread,
+    HANDLE hCompletionPort,
+    LPOVERLAPPED_ENTRY lpCompletionPortEntries,
+    ULONG ulCount,
+    PULONG pulNumEntriesRemoved,
+    DWORD dwMilliseconds
+    )
+{
+    PAL_ERROR palError = NO_ERROR;
+    IPalObject *pobjPort = NULL;
+    CIOCompletionPortProcessLocalData *pLocalData = NULL;
+    IDataLock *pLocalDataLock = NULL;
+    struct epoll_event events[IOCP_MAX_EVENTS_PER_WAIT];
+    int epollFd;
+    int eventFd;
+    int nEvents;
+    int iEvent;
+    ULONG ulMaxEntries;
+    ULONG ulRemoved = 0;
+    DWORD dwStartTime;
+    DWORD dwElapsed;
+    DWORD dwRemaining = dwMilliseconds;
+    int iTimeout;
+    BOOL fPosted;
+    UINT64 count;
+    UINT64 taken;
+    PIOCP_PACKET pPacket;
+
+    *pulNumEntriesRemoved = 0;
+
+    if (0 == ulCount || NULL == lpCompletionPortEntries)
+    {
+        palError = ERROR_INVALID_PARAMETER;
+        goto InternalGetQueuedCompletionStatusExit;
+    }
+
+    ulMaxEntries = (ulCount < IOCP_MAX_EVENTS_PER_WAIT) ? ulCount : IOCP_MAX_EVENTS_PER_WAIT;
+
+    palError = g_pObjectManager->ReferenceObjectByHandle(
+        pThread,
+        hCompletionPort,
+        &aotIOCompletionPort,
+        0,
+        &pobjPort
+        );
+
+    if (NO_ERROR != palError)
+    {
+        goto InternalGetQueuedCompletionStatusExit;
+    }
+
+    //
+    // The descriptors do not change for the lifetime of the port, and the
+    // reference held here keeps the port from being cleaned up, so they
+    // can be used outside of the data lock.
+    //
+
+    palError = pobjPort->GetProcessLocalData(
+        pThread,
+        ReadLock,
+        &pLocalDataLock,
+        reinterpret_cast<void**>(&pLocalData)
+        );
+
+    if (NO_ERROR != palError)
+    {
+        goto InternalGetQueuedCompletionStatusExit;
+    }
+
+    epollFd = pLocalData->epollFd;
+    eventFd = pLocalData->eventFd;
+
+    pLocalDataLock->ReleaseLock(pThread, FALSE);
+
+    dwStartTime = GetTickCount();
+
+    while (TRUE)
+    {
+        if (INFINITE == dwRemaining)
+        {
+            iTimeout = -1;
+        }
+        else if (dwRemaining > IOCP_MAX_WAIT_MILLISECONDS)
+        {
+            iTimeout = IOCP_MAX_WAIT_MILLISECONDS;
+        }
+        else
+        {
+            iTimeout = (int)dwRemaining;
+        }
+
+        nEvents = epoll_wait(
+            epollFd,
+            events,
+            (int)ulMaxEntries,
+            iTimeout
+            );
+
+        if (-1 == nEvents && EINTR != errno)
+        {
+            ASSERT("epoll_wait failed (%s)\n", strerror(errno));
+            palError = ERROR_INTERNAL_ERROR;
+            break;
+        }
+
+        fPosted = FALSE;
+
+        for (iEvent = 0; iEvent < nEvents; iEvent++)
+        {
+            if (events[iEvent].data.ptr == pLocalData)
+            {
+                fPosted = TRUE;
+                continue;
+            }
+
+            lpCompletionPortEntries[ulRemoved].lpCompletionKey = (ULONG_PTR)events[iEvent].data.u64;
+            lpCompletionPortEntries[ulRemoved].lpOverlapped = PAL_IOCP_READINESS_OVERLAPPED;
+            lpCompletionPortEntries[ulRemoved].Internal = 0;
+            lpCompletionPortEntries[ulRemoved].dwNumberOfBytesTransferred =
+                events[iEvent].events & (POLLIN | POLLOUT | POLLERR | POLLHUP);
+            ulRemoved++;
+        }
+
+        //
+        // Claim all the posted packets at once and give back the ones that
+        // do not fit. Another waiter may have emptied the eventfd since the
+        // wait returned, in which case there is nothing to claim.
+        //
+
+        if (fPosted && ulRemoved < ulMaxEntries &&
+            sizeof(count) == read(eventFd, &count, sizeof(count)))
+        {
+            taken = ulMaxEntries - ulRemoved;
+            if (taken > count)
+            {
+                taken = count;
+            }
+
+            palError = pobjPort->GetProcessLocalData(
+                pThread,
+                WriteLock,
+                &pLocalDataLock,
+                reinterpret_cast<void**>(&pLocalData)
+                );
+
+            if (NO_ERROR != palError)
+            {
+                break;
+            }
+
+            for (; taken > 0; taken--, count--)
+            {
+                pPacket = pLocalData->pFirstPacket;
+                _ASSERTE(NULL != pPacket);
+
+                pLocalData->pFirstPacket = pPacket->pNext;
+                if (NULL == pLocalData->pFirstPacket)
+                {
+                    pLocalData->pLastPacket = NULL;
+                }
+
+                lpCompletionPortEntries[ulRemoved].lpCompletionKey = pPacket->CompletionKey;
+                lpCompletionPortEntries[ulRemoved].lpOverlapped = pPacket->lpOverlapped;
+                lpCompletionPortEntries[ulRemoved].Internal = 0;
+                lpCompletionPortEntries[ulRemoved].dwNumberOfBytesTransferred = pPacket->dwNumberOfBytesTransferred;
+                ulRemoved++;
+
+                InternalFree(pThread, pPacket);
+            }
+
+            pLocalDataLock->ReleaseLock(pThread, TRUE);
+
+            if (0 != count && sizeof(count) != write(eventFd, &count, sizeof(count)))
+            {
+                ASSERT("write to the eventfd of the completion port failed (%s)\n", strerror(errno));
+            }
+        }
+
+        if (0 != ulRemoved)
+        {
+            break;
+        }
+
+        if (INFINITE != dwRemaining)
+        {
+            dwElapsed = GetTickCount() - dwStartTime;
+            if (dwElapsed >= dwMilliseconds)
+            {
+                palError = WAIT_TIMEOUT;
+                break;
+            }
+            dwRemaining = dwMilliseconds - dwElapsed;
+        }
+    }
+
+    *pulNumEntriesRemoved = ulRemoved;
+
+InternalGetQueuedCompletionStatusExit:
+
+    if (NULL != pobjPort)
+    {
+        pobjPort->ReleaseReference(pThread);
+    }
+
+    return palError;
+}
+
+#else // HAVE_EPOLL && HAVE_EVENTFD
+
+PAL_ERROR
+CorUnix::InternalCreateIoCompletionPort(
+    CPalThread *pThread,
+    HANDLE hFile,
+    HANDLE hExistingCompletionPort,
+    ULONG_PTR CompletionKey,
+    HANDLE *phCompletionPort
+    )
+{
+    ERROR("I/O completion ports are not supported on this platform\n");
+    return ERROR_NOT_SUPPORTED;
+}
+
+PAL_ERROR
+CorUnix::InternalPostQueuedCompletionStatus(
+    CPalThread *pThread,
+    HANDLE hCompletionPort,
+    DWORD dwNumberOfBytesTransferred,
+    ULONG_PTR CompletionKey,
+    LPOVERLAPPED lpOverlapped
+    )
+{
+    ERROR("I/O completion ports are not supported on this platform\n");
+    return ERROR_NOT_SUPPORTED;
+}
+
+PAL_ERROR
+CorUnix::InternalGetQueuedCompletionStatus(
+    CPalThread *pThread,
+    HANDLE hCompletionPort,
+    LPOVERLAPPED_ENTRY lpCompletionPortEntries,
+    ULONG ulCount,
+    PULONG pulNumEntriesRemoved,
+    DWORD dwMilliseconds
+    )
+{
+    ERROR("I/O completion ports are not supported on this platform\n");
+    *pulNumEntriesRemoved = 0;
+    return ERROR_NOT_SUPPORTED;
+}
+
+#endif // HAVE_EPOLL && HAVE_EVENTFD
@@ -0,0 +1,84 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+//
+
+/*++
+
+
+
+Module Name:
+
+    include/pal/iocompletion.hpp
+
+Abstract:
+
+    I/O completion port object structure definition.
+
+
+
+--*/
+
+#ifndef _PAL_IOCOMPLETION_H_
+#define _PAL_IOCOMPLETION_H_
+
+#include "corunix.hpp"
+
+namespace CorUnix
+{
+    extern CObjectType otIOCompletionPort;
+    extern CAllowedObjectTypes aotIOCompletionPort;
+
+    //
+    // A packet queued by PostQueuedCompletionStatus. Readiness of the
+    // handles associated with the port is reported by epoll and never
+    // goes through this queue.
+    //
+
+    typedef struct _IOCP_PACKET
+    {
+        struct _IOCP_PACKET *pNext;
+        DWORD dwNumberOfBytesTransferred;
+        ULONG_PTR CompletionKey;
+        LPOVERLAPPED lpOverlapped;
+    } IOCP_PACKET, *PIOCP_PACKET;
+
+    class CIOCompletionPortProcessLocalData
+    {
+    public:
+        int epollFd;            // epoll set of the associated handles and of eventFd
+        int eventFd;            // counts the packets in the posted queue
+        PIOCP_PACKET pFirstPacket;
+        PIOCP_PACKET pLastPacket;
+    };
+
+    PAL_ERROR
+    InternalCreateIoCompletionPort(
+        CPalThread *pThread,
+        HANDLE hFile,
+        HANDLE hExistingCompletionPort,
+        ULONG_PTR CompletionKey,
+        HANDLE *phCompletionPort
+        );
+
+    PAL_ERROR
+    InternalPostQueuedCompletionStatus(
+        CPalThread *pThread,
+        HANDLE hCompletionPort,
+        DWORD dwNumberOfBytesTransferred,
+        ULONG_PTR CompletionKey,
+        LPOVERLAPPED lpOverlapped
+        );
+
+    PAL_ERROR
+    InternalGetQueuedCompletionStatus(
+        CPalThread *pThread,
+        HANDLE hCompletionPort,
+        LPOVERLAPPED_ENTRY lpCompletionPortEntries,
+        ULONG ulCount,
+        PULONG pulNumEntriesRemoved,
+        DWORD dwMilliseconds
+        );
+}
+
+#endif //_PAL_IOCOMPLETION_H_
@@ -26,6 +26,8 @@ Abstract:
 #include "pal/corunix.hpp"
 
 extern PHARDWARE_EXCEPTION_HANDLER g_hardwareExceptionHandler;
+extern PAL_ActivationFunction g_activationFunction;
+extern PAL_SafeActivationCheckFunction g_safeActivationCheckFunction;
 
 // Uncomment this define to turn off the signal handling thread.
 // #define DO_NOT_USE_SIGNAL_HANDLING_THREAD
@@ -107,6 +109,21 @@ Notes :
     installed), the default behavior is to call ExitProcess
 --*/
 void SEHHandleControlEvent(DWORD event, LPVOID eip);
+
+/*++
+Function :
+    InjectActivationInternal
+
+    Interrupt the specified thread with the activation signal so that it
+    runs the registered activation function
+
+Parameters :
+    CPalThread * pThread : thread to interrupt
+
+Return value :
+    NO_ERROR if the signal was sent, an error code otherwise
+--*/
+PAL_ERROR InjectActivationInternal(CorUnix::CPalThread *pThread);
 #endif // !HAVE_MACH_EXCEPTIONS
 
 #if !HAVE_MACH_EXCEPTIONS
@@ -1432,6 +1432,59 @@ GetThreadTimesExit:
     return (retval);
 }
 
+/*++
+Function:
+  PAL_InjectActivation
+
+Interrupt the specified thread and have it run the activation function
+registered with PAL_SetActivationFunction on the context of the code it
+was executing. The call returns as soon as the thread has been signaled;
+it does not wait for the activation function to run.
+--*/
+BOOL
+PALAPI
+PAL_InjectActivation(
+    IN HANDLE hThread)
+{
+    PAL_ERROR palError;
+    CPalThread *pThread;
+    CPalThread *pTargetThread = NULL;
+    IPalObject *pobjThread = NULL;
+
+    ENTRY("PAL_InjectActivation(hThread=%p)\n", hThread);
+
+    pThread = InternalGetCurrentThread();
+
+    palError = InternalGetThreadDataFromHandle(
+        pThread,
+        hThread,
+        0,
+        &pTargetThread,
+        &pobjThread
+        );
+
+    if (NO_ERROR == palError)
+    {
+#if !HAVE_MACH_EXCEPTIONS
+        palError = InjectActivationInternal(pTargetThread);
+#else
+        palError = ERROR_NOT_SUPPORTED;
+#endif
+        if (NULL != pobjThread)
+        {
+            pobjThread->ReleaseReference(pThread);
+        }
+    }
+
+    if (NO_ERROR != palError)
+    {
+        pThread->SetLastError(palError);
+    }
+
+    LOGEXIT("PAL_InjectActivation returns BOOL %d\n", NO_ERROR == palError);
+    return NO_ERROR == palError;
+}
+
 
 
 void *
@@ -0,0 +1,149 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+//
+
+/*============================================================
+**
+** Source: test1.c
+**
+** Purpose: Posts packets to a completion port and dequeues them one at
+** a time and in batches, checking their order, their contents and that
+** an empty port times out. A packet posted without an overlapped comes
+** back as a successful dequeue with a NULL overlapped, as on Windows.
+**
+**
+**=========================================================*/
+
+#include <palsuite.h>
+
+#define PACKET_COUNT 100
+
+int __cdecl main(int argc, char *argv[])
+{
+    HANDLE hPort;
+    DWORD dwBytes;
+    ULONG_PTR key;
+    LPOVERLAPPED pOverlapped;
+    OVERLAPPED_ENTRY entries[16];
+    ULONG ulRemoved;
+    ULONG ulTotal;
+    ULONG i;
+    DWORD dwStart;
+
+    if (0 != PAL_Initialize(argc, argv))
+    {
+        return FAIL;
+    }
+
+    hPort = CreateIoCompletionPort(INVALID_HANDLE_VALUE, NULL, 0, 0);
+    if (hPort == NULL)
+    {
+        Fail("CreateIoCompletionPort failed (%u)\n", GetLastError());
+    }
+
+    /* An empty port times out */
+    dwStart = GetTickCount();
+    if (GetQueuedCompletionStatus(hPort, &dwBytes, &key, &pOverlapped, 50) ||
+        GetLastError() != WAIT_TIMEOUT || pOverlapped != NULL)
+    {
+        Fail("GetQueuedCompletionStatus did not time out on an empty port (%u)\n", GetLastError());
+    }
+    if (GetTickCount() - dwStart < 40)
+    {
+        Fail("GetQueuedCompletionStatus returned before its timeout\n");
+    }
+
+    /* Packets come back one at a time in the order they were posted */
+    for (i = 0; i < PACKET_COUNT; i++)
+    {
+        if (!PostQueuedCompletionStatus(hPort, i, (ULONG_PTR)(i + 1), (LPOVERLAPPED)(SIZE_T)(i + 1000)))
+        {
+            Fail("PostQueuedCompletionStatus failed (%u)\n", GetLastError());
+        }
+    }
+
+    for (i = 0; i < PACKET_COUNT / 2; i++)
+    {
+        if (!GetQueuedCompletionStatus(hPort, &dwBytes, &key, &pOverlapped, 0))
+        {
+            Fail("GetQueuedCompletionStatus failed for packet %u (%u)\n", i, GetLastError());
+        }
+        if (dwBytes != i || key != (ULONG_PTR)(i + 1) || pOverlapped != (LPOVERLAPPED)(SIZE_T)(i + 1000))
+        {
+            Fail("Packet %u came back as (%u, %p, %p)\n", i, dwBytes, (void *)key, pOverlapped);
+        }
+    }
+
+    /* The rest come back in batches no larger than the array */
+    ulTotal = 0;
+    while (ulTotal < PACKET_COUNT / 2)
+    {
+        if (!GetQueuedCompletionStatusEx(hPort, entries, 16, &ulRemoved, 0, FALSE))
+        {
+            Fail("GetQueuedCompletionStatusEx failed after %u packets (%u)\n", ulTotal, GetLastError());
+        }
+        if (ulRemoved == 0 || ulRemoved > 16)
+        {
+            Fail("GetQueuedCompletionStatusEx removed %u entries\n", ulRemoved);
+        }
+        for (i = 0; i < ulRemoved; i++)
+        {
+            ULONG n = PACKET_COUNT / 2 + ulTotal + i;
+            if (entries[i].dwNumberOfBytesTransferred != n ||
+                entries[i].lpCompletionKey != (ULONG_PTR)(n + 1) ||
+                entries[i].lpOverlapped != (LPOVERLAPPED)(SIZE_T)(n + 1000))
+            {
+                Fail("Batched packet %u came back out of order\n", n);
+            }
+        }
+        ulTotal += ulRemoved;
+    }
+
+    if (ulTotal != PACKET_COUNT / 2)
+    {
+        Fail("GetQueuedCompletionStatusEx returned %u packets instead of %u\n", ulTotal, PACKET_COUNT / 2);
+    }
+
+    /* Nothing is left behind */
+    if (GetQueuedCompletionStatusEx(hPort, entries, 16, &ulRemoved, 0, FALSE) ||
+        GetLastError() != WAIT_TIMEOUT || ulRemoved != 0)
+    {
+        Fail("The port is not empty after all packets were dequeued\n");
+    }
+
+    /* A packet posted without an overlapped is dequeued successfully */
+    if (!PostQueuedCompletionStatus(hPort, 7, 42, NULL))
+    {
+        Fail("PostQueuedCompletionStatus failed without an overlapped (%u)\n", GetLastError());
+    }
+    if (!GetQueuedCompletionStatus(hPort, &dwBytes, &key, &pOverlapped, 0))
+    {
+        Fail("GetQueuedCompletionStatus failed for a packet without an overlapped (%u)\n", GetLastError());
+    }
+    if (dwBytes != 7 || key != 42 || pOverlapped != NULL)
+    {
+        Fail("The packet without an overlapped came back as (%u, %p, %p)\n", dwBytes, (void *)key, pOverlapped);
+    }
+
+    /* Readiness packets cannot be forged */
+    if (PostQueuedCompletionStatus(hPort, 0, 0, PAL_IOCP_READINESS_OVERLAPPED) ||
+        GetLastError() != ERROR_INVALID_PARAMETER)
+    {
+        Fail("PostQueuedCompletionStatus accepted PAL_IOCP_READINESS_OVERLAPPED\n");
+    }
+
+    /* Only a new port may be created without a handle */
+    if (CreateIoCompletionPort(INVALID_HANDLE_VALUE, hPort, 0, 0) != NULL)
+    {
+        Fail("CreateIoCompletionPort accepted an existing port without a handle\n");
+    }
+
+    if (!CloseHandle(hPort))
+    {
+        Fail("CloseHandle failed (%u)\n", GetLastError());
+    }
+
+    PAL_Terminate();
+    return PASS;
+}
@@ -0,0 +1,151 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+//
+
+/*============================================================
+**
+** Source: test2.c
+**
+** Purpose: Associates the read end of a pipe with a completion port and
+** streams data through the pipe from another thread. The writer waits
+** for each chunk to be consumed, so every chunk makes the pipe readable
+** once and is announced by exactly one readiness packet. The throughput
+** is traced so that runs can be compared.
+**
+**
+**=========================================================*/
+
+#include <palsuite.h>
+
+#define CHUNK_SIZE  512
+#define CHUNK_COUNT 20000
+#define READ_KEY    0x1234
+
+HANDLE hReadPipe;
+HANDLE hWritePipe;
+HANDLE hConsumed;
+
+DWORD PALAPI WriterThread(LPVOID lpParam)
+{
+    BYTE buffer[CHUNK_SIZE];
+    DWORD dwWritten;
+    int i;
+
+    for (i = 0; i < CHUNK_COUNT; i++)
+    {
+        memset(buffer, (BYTE)i, sizeof(buffer));
+
+        if (!WriteFile(hWritePipe, buffer, sizeof(buffer), &dwWritten, NULL) ||
+            dwWritten != sizeof(buffer))
+        {
+            Trace("WriteFile failed for chunk %d (%u)\n", i, GetLastError());
+            return FAIL;
+        }
+
+        if (WaitForSingleObject(hConsumed, 10000) != WAIT_OBJECT_0)
+        {
+            Trace("Chunk %d was not consumed\n", i);
+            return FAIL;
+        }
+    }
+
+    return PASS;
+}
+
+int __cdecl main(int argc, char *argv[])
+{
+    HANDLE hPort;
+    HANDLE hThread;
+    DWORD dwThreadId;
+    DWORD dwBytes;
+    DWORD dwRead;
+    DWORD dwExitCode;
+    ULONG_PTR key;
+    LPOVERLAPPED pOverlapped;
+    BYTE buffer[CHUNK_SIZE];
+    DWORD dwStart;
+    DWORD dwElapsed;
+    int i;
+
+    if (0 != PAL_Initialize(argc, argv))
+    {
+        return FAIL;
+    }
+
+    if (!CreatePipe(&hReadPipe, &hWritePipe, NULL, 0))
+    {
+        Fail("CreatePipe failed (%u)\n", GetLastError());
+    }
+
+    hConsumed = CreateEvent(NULL, FALSE, FALSE, NULL);
+    if (hConsumed == NULL)
+    {
+        Fail("CreateEvent failed (%u)\n", GetLastError());
+    }
+
+    hPort = CreateIoCompletionPort(hReadPipe, NULL, READ_KEY, 0);
+    if (hPort == NULL)
+    {
+        Fail("CreateIoCompletionPort failed to associate the pipe (%u)\n", GetLastError());
+    }
+
+    /* The same handle cannot be associated twice */
+    if (CreateIoCompletionPort(hReadPipe, hPort, READ_KEY, 0) != NULL)
+    {
+        Fail("CreateIoCompletionPort associated the pipe twice\n");
+    }
+
+    hThread = CreateThread(NULL, 0, WriterThread, NULL, 0, &dwThreadId);
+    if (hThread == NULL)
+    {
+        Fail("CreateThread failed (%u)\n", GetLastError());
+    }
+
+    dwStart = GetTickCount();
+
+    for (i = 0; i < CHUNK_COUNT; i++)
+    {
+        if (!GetQueuedCompletionStatus(hPort, &dwBytes, &key, &pOverlapped, 10000))
+        {
+            Fail("No readiness packet for chunk %d (%u)\n", i, GetLastError());
+        }
+
+        if (key != READ_KEY || pOverlapped != PAL_IOCP_READINESS_OVERLAPPED || dwBytes == 0)
+        {
+            Fail("Unexpected packet (%u, %p, %p) for chunk %d\n", dwBytes, (void *)key, pOverlapped, i);
+        }
+
+        if (!ReadFile(hReadPipe, buffer, sizeof(buffer), &dwRead, NULL) ||
+            dwRead != sizeof(buffer) || buffer[0] != (BYTE)i || buffer[CHUNK_SIZE - 1] != (BYTE)i)
+        {
+            Fail("ReadFile returned the wrong data for chunk %d (%u)\n", i, GetLastError());
+        }
+
+        if (!SetEvent(hConsumed))
+        {
+            Fail("SetEvent failed (%u)\n", GetLastError());
+        }
+    }
+
+    dwElapsed = GetTickCount() - dwStart;
+
+    if (WaitForSingleObject(hThread, 10000) != WAIT_OBJECT_0 ||
+        !GetExitCodeThread(hThread, &dwExitCode) || dwExitCode != PASS)
+    {
+        Fail("The writer thread failed\n");
+    }
+
+    Trace("%d chunks of %d bytes in %u ms (%u packets/s)\n",
+          CHUNK_COUNT, CHUNK_SIZE, dwElapsed,
+          dwElapsed == 0 ? 0 : (DWORD)((ULONGLONG)CHUNK_COUNT * 1000 / dwElapsed));
+
+    CloseHandle(hThread);
+    CloseHandle(hPort);
+    CloseHandle(hConsumed);
+    CloseHandle(hWritePipe);
+    CloseHandle(hReadPipe);
+
+    PAL_Terminate();
+    return PASS;
+}
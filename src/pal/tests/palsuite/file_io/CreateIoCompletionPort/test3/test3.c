@@ -0,0 +1,170 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+//
+
+/*============================================================
+**
+** Source: test3.c
+**
+** Purpose: Echo benchmark for completion ports. A client and a server
+** thread exchange fixed size messages over a pair of pipes, which stand
+** in for a connected socket since the PAL has no socket handles. Each
+** side waits for its read end to become ready on its own completion port
+** before reading, so every message costs one readiness packet at each
+** end. The number of round trips per second is traced so that runs can
+** be compared.
+**
+**
+**=========================================================*/
+
+#include <palsuite.h>
+
+#define MESSAGE_SIZE    64
+#define ROUND_TRIPS     20000
+#define SERVER_KEY      0x5e
+#define CLIENT_KEY      0xc1
+
+HANDLE hRequestRead;
+HANDLE hRequestWrite;
+HANDLE hResponseRead;
+HANDLE hResponseWrite;
+HANDLE hServerPort;
+
+/* Waits for the next readiness packet of a read end and reads one message from it */
+BOOL ReceiveMessage(HANDLE hPort, ULONG_PTR expectedKey, HANDLE hRead, BYTE *buffer)
+{
+    DWORD dwBytes;
+    DWORD dwRead;
+    ULONG_PTR key;
+    LPOVERLAPPED pOverlapped;
+
+    if (!GetQueuedCompletionStatus(hPort, &dwBytes, &key, &pOverlapped, 10000))
+    {
+        Trace("No readiness packet (%u)\n", GetLastError());
+        return FALSE;
+    }
+
+    if (key != expectedKey || pOverlapped != PAL_IOCP_READINESS_OVERLAPPED)
+    {
+        Trace("Unexpected packet (%u, %p, %p)\n", dwBytes, (void *)key, pOverlapped);
+        return FALSE;
+    }
+
+    if (!ReadFile(hRead, buffer, MESSAGE_SIZE, &dwRead, NULL) || dwRead != MESSAGE_SIZE)
+    {
+        Trace("ReadFile failed (%u)\n", GetLastError());
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+DWORD PALAPI ServerThread(LPVOID lpParam)
+{
+    BYTE buffer[MESSAGE_SIZE];
+    DWORD dwWritten;
+    int i;
+
+    for (i = 0; i < ROUND_TRIPS; i++)
+    {
+        if (!ReceiveMessage(hServerPort, SERVER_KEY, hRequestRead, buffer))
+        {
+            Trace("The server failed to receive request %d\n", i);
+            return FAIL;
+        }
+
+        if (!WriteFile(hResponseWrite, buffer, sizeof(buffer), &dwWritten, NULL) ||
+            dwWritten != sizeof(buffer))
+        {
+            Trace("WriteFile failed for response %d (%u)\n", i, GetLastError());
+            return FAIL;
+        }
+    }
+
+    return PASS;
+}
+
+int __cdecl main(int argc, char *argv[])
+{
+    HANDLE hClientPort;
+    HANDLE hThread;
+    DWORD dwThreadId;
+    DWORD dwWritten;
+    DWORD dwExitCode;
+    BYTE request[MESSAGE_SIZE];
+    BYTE response[MESSAGE_SIZE];
+    DWORD dwStart;
+    DWORD dwElapsed;
+    int i;
+
+    if (0 != PAL_Initialize(argc, argv))
+    {
+        return FAIL;
+    }
+
+    if (!CreatePipe(&hRequestRead, &hRequestWrite, NULL, 0) ||
+        !CreatePipe(&hResponseRead, &hResponseWrite, NULL, 0))
+    {
+        Fail("CreatePipe failed (%u)\n", GetLastError());
+    }
+
+    hServerPort = CreateIoCompletionPort(hRequestRead, NULL, SERVER_KEY, 0);
+    hClientPort = CreateIoCompletionPort(hResponseRead, NULL, CLIENT_KEY, 0);
+    if (hServerPort == NULL || hClientPort == NULL)
+    {
+        Fail("CreateIoCompletionPort failed to associate the pipes (%u)\n", GetLastError());
+    }
+
+    hThread = CreateThread(NULL, 0, ServerThread, NULL, 0, &dwThreadId);
+    if (hThread == NULL)
+    {
+        Fail("CreateThread failed (%u)\n", GetLastError());
+    }
+
+    dwStart = GetTickCount();
+
+    for (i = 0; i < ROUND_TRIPS; i++)
+    {
+        memset(request, (BYTE)i, sizeof(request));
+
+        if (!WriteFile(hRequestWrite, request, sizeof(request), &dwWritten, NULL) ||
+            dwWritten != sizeof(request))
+        {
+            Fail("WriteFile failed for request %d (%u)\n", i, GetLastError());
+        }
+
+        if (!ReceiveMessage(hClientPort, CLIENT_KEY, hResponseRead, response))
+        {
+            Fail("The client failed to receive response %d\n", i);
+        }
+
+        if (response[0] != (BYTE)i || response[MESSAGE_SIZE - 1] != (BYTE)i)
+        {
+            Fail("Response %d does not echo its request\n", i);
+        }
+    }
+
+    dwElapsed = GetTickCount() - dwStart;
+
+    if (WaitForSingleObject(hThread, 10000) != WAIT_OBJECT_0 ||
+        !GetExitCodeThread(hThread, &dwExitCode) || dwExitCode != PASS)
+    {
+        Fail("The server thread failed\n");
+    }
+
+    Trace("%d round trips of %d bytes in %u ms (%u round trips/s)\n",
+          ROUND_TRIPS, MESSAGE_SIZE, dwElapsed,
+          dwElapsed == 0 ? 0 : (DWORD)((ULONGLONG)ROUND_TRIPS * 1000 / dwElapsed));
+
+    CloseHandle(hThread);
+    CloseHandle(hClientPort);
+    CloseHandle(hServerPort);
+    CloseHandle(hResponseWrite);
+    CloseHandle(hResponseRead);
+    CloseHandle(hRequestWrite);
+    CloseHandle(hRequestRead);
+
+    PAL_Terminate();
+    return PASS;
+}
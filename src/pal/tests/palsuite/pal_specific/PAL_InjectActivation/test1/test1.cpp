@@ -0,0 +1,131 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+//
+
+/*============================================================
+**
+** Source: test1.cpp
+**
+** Purpose: Interrupts a thread spinning in a loop with
+** PAL_InjectActivation and checks that the activation function runs on
+** that thread, with the interrupted context, and that the thread resumes
+** where it was interrupted. Also checks that an invalid handle fails.
+**
+**
+**=========================================================*/
+
+#include <palsuite.h>
+
+volatile LONG g_stop = 0;
+volatile LONG g_iterations = 0;
+volatile LONG g_checks = 0;
+volatile LONG g_activations = 0;
+volatile DWORD g_activationThreadId = 0;
+volatile DWORD64 g_activationIp = 0;
+
+BOOL PALAPI SafeActivationCheck(SIZE_T ip)
+{
+    InterlockedIncrement(&g_checks);
+    return TRUE;
+}
+
+VOID PALAPI Activation(CONTEXT *context)
+{
+    g_activationIp = context->Rip;
+    g_activationThreadId = GetCurrentThreadId();
+    InterlockedIncrement(&g_activations);
+}
+
+DWORD PALAPI SpinningThread(LPVOID lpParam)
+{
+    while (g_stop == 0)
+    {
+        g_iterations++;
+    }
+
+    return PASS;
+}
+
+int __cdecl main(int argc, char *argv[])
+{
+    HANDLE hThread;
+    DWORD dwThreadId;
+    DWORD dwExitCode;
+    LONG iterations;
+    int i;
+
+    if (0 != PAL_Initialize(argc, argv))
+    {
+        return FAIL;
+    }
+
+    PAL_SetActivationFunction(Activation, SafeActivationCheck);
+
+    hThread = CreateThread(NULL, 0, SpinningThread, NULL, 0, &dwThreadId);
+    if (hThread == NULL)
+    {
+        Fail("CreateThread failed (%u)\n", GetLastError());
+    }
+
+    // Wait for the thread to start spinning
+    while (g_iterations == 0)
+    {
+        Sleep(1);
+    }
+
+    if (!PAL_InjectActivation(hThread))
+    {
+        Fail("PAL_InjectActivation failed (%u)\n", GetLastError());
+    }
+
+    for (i = 0; i < 1000 && g_activations == 0; i++)
+    {
+        Sleep(10);
+    }
+
+    if (g_activations != 1 || g_checks != 1)
+    {
+        Fail("The activation ran %d times after %d checks\n", g_activations, g_checks);
+    }
+
+    if (g_activationThreadId != dwThreadId)
+    {
+        Fail("The activation ran on thread %u instead of %u\n", g_activationThreadId, dwThreadId);
+    }
+
+    if (g_activationIp == 0)
+    {
+        Fail("The activation did not receive the interrupted context\n");
+    }
+
+    // The interrupted thread keeps running where it left off
+    iterations = g_iterations;
+    for (i = 0; i < 1000 && g_iterations == iterations; i++)
+    {
+        Sleep(10);
+    }
+
+    if (g_iterations == iterations)
+    {
+        Fail("The thread did not resume after the activation\n");
+    }
+
+    g_stop = 1;
+
+    if (WaitForSingleObject(hThread, 10000) != WAIT_OBJECT_0 ||
+        !GetExitCodeThread(hThread, &dwExitCode) || dwExitCode != PASS)
+    {
+        Fail("The spinning thread did not exit\n");
+    }
+
+    if (PAL_InjectActivation(NULL))
+    {
+        Fail("PAL_InjectActivation succeeded for a NULL handle\n");
+    }
+
+    CloseHandle(hThread);
+
+    PAL_Terminate();
+    return PASS;
+}
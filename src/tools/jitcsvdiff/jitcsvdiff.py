@@ -0,0 +1,93 @@
+#
+# Copyright (c) Microsoft. All rights reserved.
+# Licensed under the MIT license. See LICENSE file in the project root for full license information.
+#
+
+# Compare the code quality columns of two COMPlus_JitTimeLogCsv files.
+#
+# Usage: python jitcsvdiff.py [--top N] <base.csv> <diff.csv>
+#
+# Produce the two files by running the same corpus (e.g. crossgen of a set of
+# assemblies) with the baseline and the modified JIT, each with
+# COMPlus_JitTimeLogCsv pointing at a different (non-existent) file.
+# Methods are matched by name; methods compiled more than once keep their last
+# row.  The totals over the methods present in both files are reported, followed
+# by the methods with the largest code size regressions and improvements.
+
+from __future__ import print_function
+
+import csv
+import getopt
+import sys
+
+METHOD_COLUMN = "Method Name"
+METRIC_COLUMNS = ["Code Bytes", "Spills", "Resolution Moves", "Bounds Checks Removed"]
+
+# Columns added after the first version of the log; files without them read as 0.
+OPTIONAL_COLUMNS = ["Bounds Checks Removed"]
+
+def ReadMetric(row, column):
+    if column in OPTIONAL_COLUMNS and row.get(column) is None:
+        return 0
+    return int(row[column])
+
+def ReadCsv(path):
+    methods = {}
+    with open(path) as f:
+        for row in csv.DictReader(f):
+            try:
+                methods[row[METHOD_COLUMN]] = [ReadMetric(row, c) for c in METRIC_COLUMNS]
+            except (KeyError, ValueError):
+                required = [c for c in METRIC_COLUMNS if c not in OPTIONAL_COLUMNS]
+                print("ERROR: " + path + " does not have the columns " + ", ".join(required))
+                sys.exit(2)
+    return methods
+
+def PrintDelta(name, base, diff):
+    delta = diff - base
+    pct = (100.0 * delta / base) if base != 0 else 0.0
+    print("  %-22s %12d %12d %+10d (%+.2f%%)" % (name, base, diff, delta, pct))
+
+def Main(argv):
+    try:
+        opts, args = getopt.getopt(argv, "n:", ["top="])
+    except getopt.GetoptError:
+        args = []
+    if len(args) != 2:
+        print("usage: python jitcsvdiff.py [--top N] <base.csv> <diff.csv>")
+        return 2
+
+    top = 20
+    for opt, arg in opts:
+        if opt in ("-n", "--top"):
+            top = int(arg)
+
+    base = ReadCsv(args[0])
+    diff = ReadCsv(args[1])
+    common = [m for m in base if m in diff]
+
+    print("Methods: %d in base, %d in diff, %d in both" % (len(base), len(diff), len(common)))
+    print("  %-22s %12s %12s %10s" % ("", "base", "diff", "delta"))
+    for i in range(len(METRIC_COLUMNS)):
+        PrintDelta(METRIC_COLUMNS[i],
+                   sum(base[m][i] for m in common),
+                   sum(diff[m][i] for m in common))
+
+    changed = [(diff[m][0] - base[m][0], m) for m in common if diff[m] != base[m]]
+    print("Methods with changed code bytes, spills, resolution moves or bounds checks: %d" % len(changed))
+
+    changed.sort()
+    print("\nTop code size improvements:")
+    for delta, m in changed[:top]:
+        if delta >= 0:
+            break
+        print("  %+6d %s" % (delta, m))
+    print("\nTop code size regressions:")
+    for delta, m in reversed(changed[-top:]):
+        if delta <= 0:
+            break
+        print("  %+6d %s" % (delta, m))
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(Main(sys.argv[1:]))
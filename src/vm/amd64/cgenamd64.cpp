@@ -255,7 +255,7 @@ void FaultingExceptionFrame::UpdateRegDisplay(const PREGDISPLAY pRD)
     pRD->IsCallerSPValid      = FALSE;        // Don't add usage of this field.  This is only temporary.
 }
 
-#ifdef FEATURE_HIJACK
+#if defined(FEATURE_HIJACK) || defined(FEATURE_ACTIVATION_INJECTION)
 TADDR ResumableFrame::GetReturnAddressPtr()
 {
     LIMITED_METHOD_DAC_CONTRACT;
@@ -300,7 +300,9 @@ void ResumableFrame::UpdateRegDisplay(const PREGDISPLAY pRD)
 
     RETURN;
 }
+#endif // FEATURE_HIJACK || FEATURE_ACTIVATION_INJECTION
 
+#ifdef FEATURE_HIJACK
 // The HijackFrame has to know the registers that are pushed by OnHijackObjectTripThread
 // and OnHijackScalarTripThread, so all three are implemented together.
 void HijackFrame::UpdateRegDisplay(const PREGDISPLAY pRD)
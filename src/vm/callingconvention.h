@@ -324,6 +324,10 @@ public:
 
         size_t size = th.GetSize();
 #ifdef _TARGET_AMD64_
+#ifdef FEATURE_UNIX_AMD64_STRUCT_PASSING
+        if (th.IsRegPassedStruct())
+            return FALSE;
+#endif
         return IsArgPassedByRef(size);
 #elif defined(_TARGET_ARM64_)
         // Composites greater than 16 bytes are passed by reference
@@ -363,6 +367,10 @@ public:
         LIMITED_METHOD_CONTRACT;
 
 #ifdef _TARGET_AMD64_
+#ifdef FEATURE_UNIX_AMD64_STRUCT_PASSING
+        if (IsRegPassedStructArg())
+            return FALSE;
+#endif
         return IsArgPassedByRef(m_argSize);
 #elif defined(_TARGET_ARM64_)
         if (m_argType == ELEMENT_TYPE_VALUETYPE)
@@ -379,6 +387,16 @@ public:
 
 #endif // ENREGISTERED_PARAMTYPE_MAXSIZE
 
+#ifdef FEATURE_UNIX_AMD64_STRUCT_PASSING
+    // Is the current argument a value type that is passed by value in two general purpose
+    // registers, or in two stack slots if fewer than two registers are left?
+    BOOL IsRegPassedStructArg()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return (m_argType == ELEMENT_TYPE_VALUETYPE) && !m_argTypeHandle.IsNull() && m_argTypeHandle.IsRegPassedStruct();
+    }
+#endif
+
     //------------------------------------------------------------
     // Return the offsets of the special arguments
     //------------------------------------------------------------
@@ -533,8 +551,13 @@ public:
             return;
         }
 
-        // UNIXTODO: Passing of structs, HFAs. For now, use the Windows convention.
+        // UNIXTODO: Passing of HFAs. Structs other than the ones passed in general purpose
+        // registers use the Windows convention.
         int cSlots = 1;
+#ifdef FEATURE_UNIX_AMD64_STRUCT_PASSING
+        if (IsRegPassedStructArg())
+            cSlots = 2;
+#endif
 
         if (!TransitionBlock::IsStackArgumentOffset(argOffset))
         {
@@ -879,7 +902,13 @@ int ArgIteratorTemplate<ARGITERATOR_BASE>::GetNextOffset()
 
     case ELEMENT_TYPE_VALUETYPE:
     {
-        // UNIXTODO: Passing of structs, HFAs. For now, use the Windows convention.
+#ifdef FEATURE_UNIX_AMD64_STRUCT_PASSING
+        // Structs of two INTEGER eightbytes take two consecutive general purpose registers, or
+        // two stack slots if they do not fit in the remaining registers.
+        if (thValueType.IsRegPassedStruct())
+            break;
+#endif
+        // UNIXTODO: Passing of other structs, HFAs. For now, use the Windows convention.
         argSize = sizeof(TADDR);
         break;
     }
@@ -1356,6 +1385,11 @@ void ArgIteratorTemplate<ARGITERATOR_BASE>::ForceSigWalk()
         // All stack arguments take just one stack slot on AMD64 because of arguments bigger 
         // than a stack slot are passed by reference. 
         stackElemSize = STACK_ELEM_SIZE;
+#ifdef FEATURE_UNIX_AMD64_STRUCT_PASSING
+        // Except for the structs passed by value in two slots on Unix.
+        if (IsRegPassedStructArg())
+            stackElemSize = StackElemSize(GetArgSize());
+#endif
 #else
         stackElemSize = StackElemSize(GetArgSize());
 #if defined(ENREGISTERED_PARAMTYPE_MAXSIZE)
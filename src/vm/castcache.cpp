@@ -0,0 +1,286 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+//
+// File: castcache.cpp
+//
+// See castcache.h for a description of the cache.
+//
+
+#include "common.h"
+#include "castcache.h"
+
+CastCache::Table *CastCache::s_pTable = NULL;
+CastCache::Table *CastCache::s_pRetiredTables = NULL;
+DWORD CastCache::s_maxSize = 0;
+
+//---------------------------------------------------------------------------------------
+//
+// Allocates the initial table, unless the cache is disabled by COMPlus_CastCacheMaxEntries=0.
+//
+void CastCache::Initialize()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    DWORD maxSize = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_CastCacheMaxEntries);
+    if (maxSize == 0)
+        return;
+
+    // Round down to a power of 2, but no smaller than the initial size.
+    DWORD size = INITIAL_SIZE;
+    while ((size << 1) != 0 && (size << 1) <= maxSize)
+        size <<= 1;
+    s_maxSize = size;
+
+    Table *pTable = AllocateTable(INITIAL_SIZE);
+    if (pTable == NULL)
+        COMPlusThrowOM();
+
+    s_pTable = pTable;
+}
+
+CastCache::Table *CastCache::AllocateTable(DWORD size)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        INJECT_FAULT(return NULL;);
+    }
+    CONTRACTL_END;
+
+    _ASSERTE((size & (size - 1)) == 0);
+
+    S_SIZE_T cbTable = S_SIZE_T(offsetof(Table, entries)) + S_SIZE_T(size) * S_SIZE_T(sizeof(Entry));
+    if (cbTable.IsOverflow())
+        return NULL;
+
+    Table *pTable = (Table *)new (nothrow) BYTE[cbTable.Value()];
+    if (pTable == NULL)
+        return NULL;
+
+    memset(pTable, 0, cbTable.Value());
+    pTable->mask = size - 1;
+    return pTable;
+}
+
+//---------------------------------------------------------------------------------------
+//
+// Looks up the result of casting an object of type pSourceMT to toTypeHnd.
+//
+// Return Value:
+//    TypeHandle::CanCast or TypeHandle::CannotCast if the result is cached, TypeHandle::MaybeCast
+//    if it isn't.
+//
+#include <optsmallperfcritical.h>
+TypeHandle::CastResult CastCache::TryGet(MethodTable *pSourceMT, TypeHandle toTypeHnd)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+        SO_TOLERANT;
+    }
+    CONTRACTL_END;
+
+    Table *pTable = VolatileLoad(&s_pTable);
+    if (pTable == NULL)
+        return TypeHandle::MaybeCast;
+
+    TADDR source = dac_cast<TADDR>(pSourceMT);
+    TADDR target = toTypeHnd.AsTAddr();
+    DWORD index = Hash(source, target);
+
+    for (DWORD i = 0; i < BUCKET_SIZE; i++)
+    {
+        Entry *pEntry = &pTable->entries[(index + i) & pTable->mask];
+
+        LONG version = VolatileLoad(&pEntry->version);
+        if (version & 1)
+            continue;
+
+        TADDR entrySource = VolatileLoad(&pEntry->source);
+        TADDR entryTargetAndResult = VolatileLoad(&pEntry->targetAndResult);
+
+        // The entry was rewritten while we were reading it.
+        if (VolatileLoad(&pEntry->version) != version)
+            continue;
+
+        if (entrySource == source && (entryTargetAndResult & ~(TADDR)1) == target)
+            return (entryTargetAndResult & 1) ? TypeHandle::CanCast : TypeHandle::CannotCast;
+    }
+
+    return TypeHandle::MaybeCast;
+}
+#include <optdefault.h>
+
+//---------------------------------------------------------------------------------------
+//
+// Records the result of casting an object of type pSourceMT to toTypeHnd.
+//
+// Notes:
+//    The entry goes into the first empty slot of its bucket, or replaces a slot chosen from the
+//    hash when the bucket is full.  If another thread is updating that slot, the result is not
+//    recorded; it will be recomputed and added again by the next slow cast.
+//
+void CastCache::Add(MethodTable *pSourceMT, TypeHandle toTypeHnd, BOOL fCanCast)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+        PRECONDITION(IsCacheable(pSourceMT, toTypeHnd));
+    }
+    CONTRACTL_END;
+
+    Table *pTable = VolatileLoad(&s_pTable);
+    if (pTable == NULL)
+        return;
+
+    TADDR source = dac_cast<TADDR>(pSourceMT);
+    TADDR target = toTypeHnd.AsTAddr();
+    _ASSERTE((target & 1) == 0);
+    DWORD index = Hash(source, target);
+
+    Entry *pEntry = NULL;
+    for (DWORD i = 0; i < BUCKET_SIZE; i++)
+    {
+        Entry *pCandidate = &pTable->entries[(index + i) & pTable->mask];
+        if (VolatileLoad(&pCandidate->source) == NULL)
+        {
+            pEntry = pCandidate;
+            break;
+        }
+    }
+
+    if (pEntry == NULL)
+    {
+        // Pick a victim from the bits of the hash that did not choose the bucket.
+        pEntry = &pTable->entries[(index + ((index >> 24) % BUCKET_SIZE)) & pTable->mask];
+
+        if (FastInterlockIncrement(&pTable->evictions) == (LONG)(pTable->mask + 1))
+            Grow(pTable);
+    }
+
+    LONG version = VolatileLoad(&pEntry->version);
+    if ((version & 1) || FastInterlockCompareExchange(&pEntry->version, version + 1, version) != version)
+        return;
+
+    VolatileStore(&pEntry->source, source);
+    VolatileStore(&pEntry->targetAndResult, target | (fCanCast ? 1 : 0));
+    VolatileStore(&pEntry->version, version + 2);
+}
+
+//---------------------------------------------------------------------------------------
+//
+// Replaces pTable with a table twice its size, once it has evicted as many entries as it holds.
+// The new table starts out empty; the results that matter are added back as they are used.
+//
+void CastCache::Grow(Table *pTable)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    DWORD size = pTable->mask + 1;
+    if (size >= s_maxSize)
+        return;
+
+    Table *pNewTable = AllocateTable(size * 2);
+    if (pNewTable == NULL)
+        return;
+
+    if (FastInterlockCompareExchangePointer(&s_pTable, pNewTable, pTable) != pTable)
+    {
+        // Another thread grew the cache.
+        delete [] (BYTE *)pNewTable;
+        return;
+    }
+
+    // Threads in cooperative mode may still be reading the old table.
+    Table *pRetired;
+    do
+    {
+        pRetired = VolatileLoad(&s_pRetiredTables);
+        pTable->pNextRetired = pRetired;
+    }
+    while (FastInterlockCompareExchangePointer(&s_pRetiredTables, pTable, pRetired) != pRetired);
+
+    STRESS_LOG1(LF_CLASSLOADER, LL_INFO100, "CastCache grown to %d entries\n", size * 2);
+}
+
+//---------------------------------------------------------------------------------------
+//
+// Clears every entry of the current table.
+//
+// Notes:
+//    Called when a LoaderAllocator is terminated.  No code can be casting to or from the types
+//    it owns at that point, but their memory may be reused by types loaded later.  The entries
+//    are cleared in place, following the same protocol as Add, so that concurrent lookups either
+//    see the old contents (which are about unrelated types) or a miss.
+//
+void CastCache::Flush()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    Table *pTable = VolatileLoad(&s_pTable);
+    if (pTable == NULL)
+        return;
+
+    for (DWORD i = 0; i <= pTable->mask; i++)
+    {
+        Entry *pEntry = &pTable->entries[i];
+        if (VolatileLoad(&pEntry->source) == NULL)
+            continue;
+
+        // Wait out a concurrent Add; it only takes a few stores.
+        LONG version;
+        for (;;)
+        {
+            version = VolatileLoad(&pEntry->version);
+            if (!(version & 1) && FastInterlockCompareExchange(&pEntry->version, version + 1, version) == version)
+                break;
+            YieldProcessor();
+        }
+
+        VolatileStore(&pEntry->source, (TADDR)NULL);
+        VolatileStore(&pEntry->targetAndResult, (TADDR)NULL);
+        VolatileStore(&pEntry->version, version + 2);
+    }
+}
+
+//---------------------------------------------------------------------------------------
+//
+// Frees the retired tables.  No thread is in cooperative mode, so none of them can be reading one.
+//
+void CastCache::ReclaimAll()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    Table *pTable = FastInterlockExchangePointer(&s_pRetiredTables, (Table *)NULL);
+    while (pTable != NULL)
+    {
+        Table *pNext = pTable->pNextRetired;
+        delete [] (BYTE *)pTable;
+        pTable = pNext;
+    }
+}
@@ -0,0 +1,102 @@
+//
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+//
+// File: castcache.h
+//
+// A process-wide cache of the results of casts from an object's MethodTable to a TypeHandle.
+//
+// The casting helpers first try a handful of cheap checks (exact match, parent walk, interface
+// map scan).  Anything beyond that - generic variance, arrays with covariant element types,
+// type equivalence - ends up in ObjIsInstanceOf, which erects a helper frame and walks the type
+// hierarchies, comparing signatures as it goes, on every cast.  The results of those casts depend
+// only on the two types, so we remember them here and consult the cache before taking the slow path.
+//
+// Lookups are lock-free and may run concurrently with updates.  Every entry carries a version
+// number which is odd while the entry is being written; readers retry (treat as a miss) when the
+// version is odd or changes while they read the entry.  Writers claim an entry by moving its
+// version from even to odd with an interlocked operation, and simply skip the update if another
+// writer got there first.
+//
+// The table starts small and is replaced with a larger one when entries are evicted frequently.
+// Retired tables may still be read by threads in cooperative mode, so they are freed during the
+// next GC suspension (see SyncClean::CleanUp).  The whole cache is flushed when a LoaderAllocator
+// is terminated, since the MethodTables and TypeHandles it holds may be freed and reused.
+//
+
+#ifndef _CASTCACHE_H_
+#define _CASTCACHE_H_
+
+class CastCache
+{
+public:
+    static void Initialize();
+
+    // Returns TypeHandle::CanCast or TypeHandle::CannotCast if the result of casting an object
+    // of type pSourceMT to toTypeHnd is known, TypeHandle::MaybeCast otherwise.
+    static TypeHandle::CastResult TryGet(MethodTable *pSourceMT, TypeHandle toTypeHnd);
+
+    // Records the result of casting an object of type pSourceMT to toTypeHnd.  The caller must have
+    // checked that the result does not depend on the object itself (see IsCacheable).
+    static void Add(MethodTable *pSourceMT, TypeHandle toTypeHnd, BOOL fCanCast);
+
+    // Casts of transparent proxies, and casts of COM objects and ICastable objects to interfaces
+    // are decided by the object, not just its type.
+    static BOOL IsCacheable(MethodTable *pSourceMT, TypeHandle toTypeHnd)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        if (pSourceMT->IsTransparentProxy())
+            return FALSE;
+
+        if (toTypeHnd.IsInterface() && (pSourceMT->IsComObjectType() || pSourceMT->IsICastable()))
+            return FALSE;
+
+        return TRUE;
+    }
+
+    // Forget all the cached results.
+    static void Flush();
+
+    // Free the tables that were replaced by larger ones.  Called while the EE is suspended.
+    static void ReclaimAll();
+
+private:
+    // The low bit of targetAndResult is set when the cast succeeds; TypeHandles are pointer aligned.
+    struct Entry
+    {
+        LONG    version;
+        TADDR   source;
+        TADDR   targetAndResult;
+    };
+
+    struct Table
+    {
+        Table  *pNextRetired;
+        DWORD   mask;               // number of entries - 1
+        LONG    evictions;          // entries overwritten since this table was created
+        Entry   entries[1];
+    };
+
+    // An entry can live in any of this many consecutive slots starting at its hash.
+    static const DWORD BUCKET_SIZE = 4;
+    static const DWORD INITIAL_SIZE = 256;
+
+    static DWORD Hash(TADDR source, TADDR target)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        // Fold in the high bits; MethodTables are allocated from a handful of loader heaps.
+        size_t hash = (source >> 3) ^ (target * 0x9E3779B9);
+        return (DWORD)(hash ^ (hash >> 16));
+    }
+
+    static Table *AllocateTable(DWORD size);
+    static void Grow(Table *pTable);
+
+    static Table *s_pTable;             // accessed with VolatileLoad/interlocked operations
+    static Table *s_pRetiredTables;
+    static DWORD s_maxSize;
+};
+
+#endif // _CASTCACHE_H_
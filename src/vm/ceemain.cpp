@@ -187,6 +187,8 @@
 #include "stackprobe.h"
 #include "posterror.h"
 #include "virtualcallstub.h"
+#include "castcache.h"
+#include "threadstatics.h"
 #include "strongnameinternal.h"
 #include "syncclean.hpp"
 #include "typeparse.h"
@@ -1193,6 +1195,8 @@ void EEStartupHelper(COINITIEE fFlags)
         // of the JIT helpers.
         InitJITHelpers1();
         InitJITHelpers2();
+        CastCache::Initialize();
+        ThreadStatics::InitializeCache();
 
         SyncBlockCache::Attach();
 
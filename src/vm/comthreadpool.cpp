@@ -297,7 +297,7 @@ void QCALLTYPE ThreadPoolNative::InitializeVMTp(CLR_BOOL* pEnableWorkerTracking)
 
     BEGIN_QCALL;
     ThreadpoolMgr::EnsureInitialized();
-    *pEnableWorkerTracking = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_EnableWorkerTracking) ? TRUE : FALSE;
+    *pEnableWorkerTracking = ThreadpoolMgr::IsWorkerTrackingEnabled() ? TRUE : FALSE;
     END_QCALL;
 }
 
@@ -784,6 +784,17 @@ void WINAPI BindIoCompletionCallbackStub(DWORD ErrorCode,
                                             LPOVERLAPPED lpOverlapped)
 {
     WRAPPER_NO_CONTRACT;
+
+#ifdef FEATURE_PAL
+    // The PAL has no overlapped I/O, so managed completions for a bound handle are all posted
+    // with their overlapped. The readiness packets the handle also produces (see
+    // CreateIoCompletionPort in pal.h) have no managed overlapped and are dropped.
+    if (lpOverlapped == PAL_IOCP_READINESS_OVERLAPPED)
+    {
+        return;
+    }
+#endif // FEATURE_PAL
+
     BindIoCompletionCallbackStubEx(ErrorCode, numBytesTransferred, lpOverlapped, TRUE);
 
 #ifndef FEATURE_PAL
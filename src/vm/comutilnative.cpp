@@ -35,6 +35,7 @@
 #include "typestring.h"
 #include "sha1.h"
 #include "finalizerthread.h"
+#include "threadsuspend.h"
 
 #ifdef FEATURE_COMINTEROP
     #include "comcallablewrapper.h"
@@ -1877,6 +1878,52 @@ void QCALLTYPE GCInterface::WaitForPendingFinalizers()
     END_QCALL;
 }
 
+/*===========================GetLastSuspensionInfo==============================
+**Action: Reports how long the threads took to reach a safe point the last time
+**        the runtime was suspended, and where the slowest one was running.
+**Returns: void
+**Arguments: pStats - receives the counts and the offender
+**           retOffenderMethod - receives the name of the method the offender was
+**                               running, if it was running managed code
+**Exceptions: None
+==============================================================================*/
+void QCALLTYPE GCInterface::GetLastSuspensionInfo(GCSuspensionStats *pStats, QCall::StringHandleOnStack retOffenderMethod)
+{
+    QCALL_CONTRACT;
+
+    BEGIN_QCALL;
+
+    ThreadSuspend::SuspensionStats stats;
+    ThreadSuspend::GetLastSuspensionStats(&stats);
+
+    pStats->threadCount = stats.dwRendezvousCount;
+    pStats->activationCount = stats.dwActivationCount;
+    pStats->retryCount = stats.dwRetryCount;
+    pStats->interruptibleCount = stats.dwStallCounts[ThreadSuspend::STALL_INTERRUPTIBLE];
+    pStats->hijackableCount = stats.dwStallCounts[ThreadSuspend::STALL_HIJACKABLE];
+    pStats->nativeCount = stats.dwStallCounts[ThreadSuspend::STALL_NATIVE];
+    pStats->unknownCount = stats.dwStallCounts[ThreadSuspend::STALL_UNKNOWN];
+    pStats->maxMicroseconds = stats.dwMaxMicroseconds;
+    pStats->offenderThreadId = stats.dwOffenderOSThreadId;
+    pStats->offenderReason = stats.dwOffenderReason;
+    pStats->offenderIP = stats.offenderIP;
+
+    // The method is looked up now rather than during the suspension, so the
+    // code may have gone away since; it is then simply not reported.
+    if (stats.offenderIP != NULL && stats.dwOffenderReason != ThreadSuspend::STALL_NATIVE)
+    {
+        MethodDesc *pMD = ExecutionManager::GetCodeMethodDesc(stats.offenderIP);
+        if (pMD != NULL)
+        {
+            SString name;
+            TypeString::AppendMethodInternal(name, pMD, TypeString::FormatNamespace | TypeString::FormatSignature);
+            retOffenderMethod.Set(name);
+        }
+    }
+
+    END_QCALL;
+}
+
 
 /*===============================GetMaxGeneration===============================
 **Action: Returns the largest GC generation
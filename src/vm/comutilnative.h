@@ -141,6 +141,24 @@ public:
 
 const UINT NEW_PRESSURE_COUNT = 4;
 
+// !!!!!!!!!!!!!!!!!!!!!!!
+// make sure you change the def in System\GC.cs
+// if you change this!
+struct GCSuspensionStats
+{
+    INT32 threadCount;
+    INT32 activationCount;
+    INT32 retryCount;
+    INT32 interruptibleCount;
+    INT32 hijackableCount;
+    INT32 nativeCount;
+    INT32 unknownCount;
+    INT32 maxMicroseconds;
+    INT32 offenderThreadId;
+    INT32 offenderReason;
+    PCODE offenderIP;
+};
+
 class GCInterface {
 private:
 
@@ -179,6 +197,9 @@ public:
     static
     void QCALLTYPE WaitForPendingFinalizers();
 
+    static
+    void QCALLTYPE GetLastSuspensionInfo(GCSuspensionStats *pStats, QCall::StringHandleOnStack retOffenderMethod);
+
     static FCDECL0(int,     GetMaxGeneration);
     static FCDECL1(void,    KeepAlive, Object *obj);
     static FCDECL1(void,    SuppressFinalize, Object *obj);
@@ -1577,6 +1577,7 @@ FCFuncStart(gGCInterfaceFuncs)
     QCFuncElement("_Collect", GCInterface::Collect)
     FCFuncElement("GetMaxGeneration", GCInterface::GetMaxGeneration)
     QCFuncElement("_WaitForPendingFinalizers", GCInterface::WaitForPendingFinalizers)
+    QCFuncElement("_GetLastSuspensionInfo", GCInterface::GetLastSuspensionInfo)
 
     FCFuncElement("_SuppressFinalize", GCInterface::SuppressFinalize)
     FCFuncElement("_ReRegisterForFinalize", GCInterface::ReRegisterForFinalize)
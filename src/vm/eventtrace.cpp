@@ -5341,15 +5341,14 @@ VOID ETW::EnumerationLog::SendThreadRundownEvent()
     } CONTRACTL_END;
 
 #ifndef DACCESS_COMPILE
-    Thread *pThread = NULL;
+    Thread *pThread;
 
-    // Take the thread store lock while we enumerate threads.
+    // Take the thread store lock while we enumerate threads.  The iterator
+    // skips unstarted and dead threads.
     ThreadStoreLockHolder tsl;
-    while ((pThread = ThreadStore::GetThreadList(pThread)) != NULL)
+    ThreadStore::ThreadIterator threads;
+    while ((pThread = threads.Next()) != NULL)
     {
-        if (pThread->IsUnstarted() || pThread->IsDead())
-            continue;
-
         // Send thread rundown provider events and thread created runtime provider
         // events (depending on which are enabled)
         ThreadLog::FireThreadDC(pThread);
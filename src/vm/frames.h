@@ -40,11 +40,15 @@
 //    |                           construct one of these to allow crawling back
 //    |                           to where the return should have gone.
 //    |
+#endif // FEATURE_HIJACK
+#if defined(FEATURE_HIJACK) || defined(FEATURE_ACTIVATION_INJECTION)
 //    +-ResumableFrame          - this abstract frame provides the context necessary to
 //    | |                         allow garbage collection during handling of
 //    | |                         a resumable exception (e.g. during edit-and-continue,
-//    | |                         or under GCStress4).
+//    | |                         or under GCStress4), or of an injected activation.
 //    | |
+#endif // FEATURE_HIJACK || FEATURE_ACTIVATION_INJECTION
+#ifdef FEATURE_HIJACK
 //    | +-RedirectedThreadFrame - this frame is used for redirecting threads during suspension
 //    |
 #endif // FEATURE_HIJACK
@@ -217,8 +221,10 @@ Reverse P/Invoke AppDomain selector stub:
 FRAME_ABSTRACT_TYPE_NAME(FrameBase)
 FRAME_ABSTRACT_TYPE_NAME(Frame)
 FRAME_ABSTRACT_TYPE_NAME(TransitionFrame)
-#ifdef FEATURE_HIJACK
+#if defined(FEATURE_HIJACK) || defined(FEATURE_ACTIVATION_INJECTION)
 FRAME_TYPE_NAME(ResumableFrame)
+#endif // FEATURE_HIJACK || FEATURE_ACTIVATION_INJECTION
+#ifdef FEATURE_HIJACK
 FRAME_TYPE_NAME(RedirectedThreadFrame)
 #endif // FEATURE_HIJACK
 FRAME_TYPE_NAME(FaultingExceptionFrame)
@@ -862,7 +868,7 @@ protected:
 // like the top of stack (with the important implication that
 // caller-save-regsiters will be potential roots).
 //-----------------------------------------------------------------------------
-#ifdef FEATURE_HIJACK
+#if defined(FEATURE_HIJACK) || defined(FEATURE_ACTIVATION_INJECTION)
 //-----------------------------------------------------------------------------
 
 class ResumableFrame : public Frame
@@ -912,6 +918,11 @@ protected:
     DEFINE_VTABLE_GETTER_AND_CTOR(ResumableFrame)
 };
 
+//------------------------------------------------------------------------
+#endif // FEATURE_HIJACK || FEATURE_ACTIVATION_INJECTION
+//------------------------------------------------------------------------
+
+#ifdef FEATURE_HIJACK
 
 //-----------------------------------------------------------------------------
 // RedirectedThreadFrame
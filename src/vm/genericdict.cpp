@@ -70,9 +70,36 @@ DictionaryLayout::Allocate(
     // This is the number of slots excluding the type parameters
     pD->m_numSlots = numSlots;
 
+    // Layouts created by NGEN are saved in the image together with dictionaries sized for their
+    // first bucket, so only the dictionaries of layouts created at runtime can grow
+    pD->m_fCanGrow = !IsCompilationProcess();
+
     RETURN pD;
 } // DictionaryLayout::Allocate
 
+//---------------------------------------------------------------------------------------
+//
+// Count the number of bytes used by a dictionary that holds every entry currently in the layout
+// 
+DWORD 
+DictionaryLayout::GetDictionarySize(
+    DWORD numGenericArgs)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        PRECONDITION(m_fCanGrow);
+    }
+    CONTRACTL_END
+
+    DWORD numSlots = GetFirstSlotIndex(numGenericArgs);
+    for (DictionaryLayout * pDictLayout = this; pDictLayout != NULL; pDictLayout = VolatileLoad(&pDictLayout->m_pNext))
+        numSlots += pDictLayout->m_numSlots;
+
+    return numSlots * sizeof(DictionaryEntry);
+} // DictionaryLayout::GetDictionarySize
+
 #endif //!DACCESS_COMPILE
 
 //---------------------------------------------------------------------------------------
@@ -91,7 +118,7 @@ DictionaryLayout::GetFirstDictionaryBucketSize(
 
     DWORD bytes = numGenericArgs * sizeof(TypeHandle);
     if (pDictLayout != NULL)
-        bytes += pDictLayout->m_numSlots * sizeof(void*);
+        bytes += (pDictLayout->GetFirstSlotIndex(numGenericArgs) - numGenericArgs + pDictLayout->m_numSlots) * sizeof(void*);
 
     return bytes;
 }
@@ -105,7 +132,9 @@ DictionaryLayout::GetFirstDictionaryBucketSize(
 // NOTE: We will currently never return more than one indirection. We don't
 // cascade dictionaries but we will record overflows in the dictionary layout
 // (and cascade that accordingly) so we can prepopulate the overflow hash in
-// reliability scenarios.
+// reliability scenarios. If the dictionaries of the layout can grow, overflows
+// get a slot in the dictionary as well. The lookup then checks the size of the
+// dictionary first, because the dictionary may not have grown to the slot yet.
 //
 // Optimize the case of a token being !i (for class dictionaries) or !!i (for method dictionaries)
 // 
@@ -128,16 +157,17 @@ DictionaryLayout::FindToken(
     CONTRACTL_END
 
     BOOL isFirstBucket = TRUE;
+    BOOL canGrow = pDictLayout->m_fCanGrow;
 
-    // First bucket also contains type parameters
-    _ASSERTE(FitsIn<WORD>(numGenericArgs));
-    WORD slot = static_cast<WORD>(numGenericArgs);
+    // First bucket also contains type parameters, and the size of the dictionary if it can grow
+    _ASSERTE(FitsIn<WORD>(pDictLayout->GetFirstSlotIndex(numGenericArgs)));
+    WORD slot = static_cast<WORD>(pDictLayout->GetFirstSlotIndex(numGenericArgs));
     for (;;)
     {
         for (DWORD iSlot = 0; iSlot < pDictLayout->m_numSlots; iSlot++)
         {
         RetryMatch:
-            BYTE * pCandidate = (BYTE *)pDictLayout->m_slots[iSlot].m_signature;
+            BYTE * pCandidate = (BYTE *)VolatileLoad(&pDictLayout->m_slots[iSlot].m_signature);
             if (pCandidate != NULL)
             {
                 DWORD cbSig;
@@ -158,27 +188,31 @@ DictionaryLayout::FindToken(
                     pResult->signature = pDictLayout->m_slots[iSlot].m_signature;
 
                     // We don't store entries outside the first bucket in the layout in the dictionary (they'll be cached in a hash
-                    // instead).
-                    if (!isFirstBucket)
+                    // instead), unless the dictionary can grow.
+                    if (!isFirstBucket && !canGrow)
                     {
                         return FALSE;
                     }
                     _ASSERTE(FitsIn<WORD>(nFirstOffset + 1));
                     pResult->indirections = static_cast<WORD>(nFirstOffset+1);
                     pResult->offsets[nFirstOffset] = slot * sizeof(DictionaryEntry);
+                    if (!isFirstBucket)
+                        pResult->sizeOffset = static_cast<WORD>(numGenericArgs * sizeof(DictionaryEntry));
                     return TRUE;
                 }
             }
             // If we hit an empty slot then there's no more so use it
             else
             {
+                BOOL isInDictionary = isFirstBucket || canGrow;
+
                 {
                     BaseDomain::LockHolder lh(pAllocator->GetDomain());
 
                     if (pDictLayout->m_slots[iSlot].m_signature != NULL)
                         goto RetryMatch;
 
-                    pSigBuilder->AppendData(isFirstBucket ? slot : 0);
+                    pSigBuilder->AppendData(isInDictionary ? slot : 0);
 
                     DWORD cbSig;
                     PVOID pSig = pSigBuilder->GetSignature(&cbSig);
@@ -186,19 +220,21 @@ DictionaryLayout::FindToken(
                     PVOID pPersisted = pAllocator->GetLowFrequencyHeap()->AllocMem(S_SIZE_T(cbSig));
                     memcpy(pPersisted, pSig, cbSig);
 
-                    *EnsureWritablePages(&(pDictLayout->m_slots[iSlot].m_signature)) = pPersisted;
+                    VolatileStore(EnsureWritablePages(&(pDictLayout->m_slots[iSlot].m_signature)), pPersisted);
                 }
 
                 pResult->signature = pDictLayout->m_slots[iSlot].m_signature;
 
-                // Again, we only store entries in the first layout bucket in the dictionary.
-                if (!isFirstBucket)
+                // Again, we only store entries outside the first layout bucket in the dictionary if it can grow.
+                if (!isInDictionary)
                 {
                     return FALSE;
                 }
                 _ASSERTE(FitsIn<WORD>(nFirstOffset + 1));
                 pResult->indirections = static_cast<WORD>(nFirstOffset+1);
                 pResult->offsets[nFirstOffset] = slot * sizeof(DictionaryEntry);
+                if (!isFirstBucket)
+                    pResult->sizeOffset = static_cast<WORD>(numGenericArgs * sizeof(DictionaryEntry));
                 return TRUE;
             }
             slot++;
@@ -206,9 +242,16 @@ DictionaryLayout::FindToken(
 
         // If we've reached the end of the chain we need to allocate another bucket. Make the pointer update carefully to avoid
         // orphaning a bucket in a race. We leak the loser in such a race (since the allocation comes from the loader heap) but both
-        // the race and the overflow should be very rare.
+        // the race and the overflow should be very rare. Buckets of growing layouts double the size of the layout so that each
+        // dictionary is copied a logarithmic number of times.
         if (pDictLayout->m_pNext == NULL)
-            FastInterlockCompareExchangePointer(EnsureWritablePages(&(pDictLayout->m_pNext)), Allocate(4, pAllocator, NULL), 0);
+        {
+            WORD numNewSlots = 4;
+            if (canGrow)
+                numNewSlots = max(numNewSlots, static_cast<WORD>(slot - numGenericArgs));
+
+            FastInterlockCompareExchangePointer(EnsureWritablePages(&(pDictLayout->m_pNext)), Allocate(numNewSlots, pAllocator, NULL), 0);
+        }
 
         pDictLayout = pDictLayout->m_pNext;
         isFirstBucket = FALSE;
@@ -593,6 +636,8 @@ Dictionary::PopulateEntry(
     ULONG kind; // DictionaryEntryKind
     IfFailThrow(ptr.GetData(&kind));
 
+    ULONG dictionaryIndex = 0;
+
     if (pMT != NULL)
     {
         // We need to normalize the class passed in (if any) for reliability purposes. That's because preparation of a code region that
@@ -602,7 +647,6 @@ Dictionary::PopulateEntry(
         // prepare for every possible derived type of the type containing the method). So instead we have to locate the exactly
         // instantiated (non-shared) super-type of the class passed in.
 
-        ULONG dictionaryIndex = 0;
         IfFailThrow(ptr.GetData(&dictionaryIndex));
 
         pDictionary = pMT->GetDictionary();
@@ -924,6 +968,29 @@ Dictionary::PopulateEntry(
 
         if ((slotIndex != 0) && !IsCompilationProcess())
         {
+            DictionaryLayout * pDictLayout = (pMT != NULL) ? pMT->GetClass()->GetDictionaryLayout() : pMD->GetDictionaryLayout();
+
+            // The slot may be past the end of a dictionary that has not grown with its layout yet
+            if ((pDictLayout != NULL) && pDictLayout->CanGrow())
+            {
+                if (pMT != NULL)
+                {
+                    pDictionary = GetDictionaryForSlot(&pMT->GetPerInstInfo()[dictionaryIndex], 
+                                                       pMT->GetNumGenericArgs(), 
+                                                       pDictLayout, 
+                                                       pMT->GetLoaderAllocator(), 
+                                                       slotIndex);
+                }
+                else
+                {
+                    pDictionary = GetDictionaryForSlot((Dictionary **)&pMD->AsInstantiatedMethodDesc()->m_pPerInstInfo, 
+                                                       pMD->GetNumGenericMethodArgs(), 
+                                                       pDictLayout, 
+                                                       pMD->GetLoaderAllocator(), 
+                                                       slotIndex);
+                }
+            }
+
             *EnsureWritablePages(pDictionary->GetSlotAddr(0, slotIndex)) = result;
             *ppSlot = pDictionary->GetSlotAddr(0, slotIndex);
         }
@@ -932,6 +999,69 @@ Dictionary::PopulateEntry(
     return result;
 } // Dictionary::PopulateEntry
 
+//---------------------------------------------------------------------------------------
+// 
+void 
+Dictionary::InitializeSize(
+    DWORD              numGenericArgs, 
+    DictionaryLayout * pDictLayout)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if ((pDictLayout != NULL) && pDictLayout->CanGrow())
+    {
+        m_pEntries[numGenericArgs] = (DictionaryEntry)(SIZE_T)DictionaryLayout::GetFirstDictionaryBucketSize(numGenericArgs, pDictLayout);
+    }
+} // Dictionary::InitializeSize
+
+//---------------------------------------------------------------------------------------
+// 
+// The old dictionary stays valid (it lives on a loader heap), so code that still holds it
+// only misses the entries stored in the copy and goes through the helper for them.
+// 
+//static
+Dictionary * 
+Dictionary::GetDictionaryForSlot(
+    Dictionary **      ppDictionary, 
+    DWORD              numGenericArgs, 
+    DictionaryLayout * pDictLayout, 
+    LoaderAllocator *  pAllocator, 
+    DWORD              slotIndex)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_NOTRIGGER;
+        INJECT_FAULT(COMPlusThrowOM(););
+        PRECONDITION(CheckPointer(ppDictionary));
+        PRECONDITION(CheckPointer(pDictLayout));
+        PRECONDITION(pDictLayout->CanGrow());
+    }
+    CONTRACTL_END
+
+    for (;;)
+    {
+        Dictionary * pDictionary = VolatileLoad(ppDictionary);
+
+        SIZE_T cbOld = (SIZE_T)pDictionary->m_pEntries[numGenericArgs];
+        if (slotIndex * sizeof(DictionaryEntry) < cbOld)
+            return pDictionary;
+
+        // Grow to the whole layout rather than to the slot, so that the entries added next fit as well
+        DWORD cbNew = pDictLayout->GetDictionarySize(numGenericArgs);
+        _ASSERTE(slotIndex * sizeof(DictionaryEntry) < cbNew);
+
+        Dictionary * pNew = (Dictionary *)(void *)pAllocator->GetLowFrequencyHeap()->AllocMem(S_SIZE_T(cbNew));
+        memcpy(pNew, pDictionary, cbOld);
+        pNew->m_pEntries[numGenericArgs] = (DictionaryEntry)(SIZE_T)cbNew;
+
+        // If we lose a race with another thread growing the same dictionary we leak the copy (it comes from
+        // the loader heap) and check the winner
+        if (FastInterlockCompareExchangePointer(EnsureWritablePages(ppDictionary), pNew, pDictionary) == pDictionary)
+            return pNew;
+    }
+} // Dictionary::GetDictionaryForSlot
+
 //---------------------------------------------------------------------------------------
 // 
 void 
@@ -947,9 +1077,12 @@ Dictionary::PrepopulateDictionary(
 
     if (pDictLayout != NULL)
     {
+        // The first bucket is always part of the dictionary, past its size if it has one
+        DWORD firstSlotIndex = pDictLayout->GetFirstSlotIndex(numGenericArgs);
+
         for (DWORD i = 0; i < pDictLayout->GetNumUsedSlots(); i++)
         {
-            if (IsSlotEmpty(numGenericArgs,i))
+            if (IsSlotEmpty(firstSlotIndex,i))
             {
                 DictionaryEntry * pSlot;
                 DictionaryEntry entry;
@@ -960,8 +1093,8 @@ Dictionary::PrepopulateDictionary(
                     nonExpansive, 
                     &pSlot);
                 
-                _ASSERT((entry == NULL) || (entry == GetSlot(numGenericArgs,i)) || IsCompilationProcess());
-                _ASSERT((pSlot == NULL) || (pSlot == GetSlotAddr(numGenericArgs,i)));
+                _ASSERT((entry == NULL) || (entry == GetSlot(firstSlotIndex,i)) || IsCompilationProcess());
+                _ASSERT((pSlot == NULL) || (pSlot == GetSlotAddr(firstSlotIndex,i)));
             }
         }
     }
@@ -94,12 +94,17 @@ class DictionaryLayout
     friend class NativeImageDumper;
 #endif
 private:
-    // Next bucket of slots (only used to track entries that won't fit in the dictionary)
+    // Next bucket of slots (only used to track entries that won't fit in the first bucket of the dictionary)
     DictionaryLayout* m_pNext;
     
     // Number of non-type-argument slots in this bucket
     WORD m_numSlots;          
 
+    // Whether the dictionaries of this layout can grow past the first bucket (first bucket only). Such
+    // dictionaries keep their size in bytes in the slot that follows the type arguments. Layouts saved
+    // in native images are used by dictionaries sized for the first bucket, so they never grow.
+    BOOL m_fCanGrow;
+
     // m_numSlots of these
     DictionaryEntryLayout m_slots[1];   
      
@@ -131,6 +136,20 @@ public:
 
     DictionaryLayout* GetNextLayout() { LIMITED_METHOD_CONTRACT; return m_pNext; }
 
+    BOOL CanGrow() { LIMITED_METHOD_CONTRACT; return m_fCanGrow; }
+
+    // Index of the dictionary slot of the first entry of the layout
+    DWORD GetFirstSlotIndex(DWORD numGenericArgs)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return numGenericArgs + (m_fCanGrow ? 1 : 0);
+    }
+
+#ifndef DACCESS_COMPILE
+    // Bytes used by a dictionary that holds all the entries currently in the layout (first bucket only)
+    DWORD GetDictionarySize(DWORD numGenericArgs);
+#endif // !DACCESS_COMPILE
+
 #ifdef FEATURE_PREJIT
     DWORD GetObjectSize();
 
@@ -261,6 +280,19 @@ class Dictionary
                                MethodTable * pMT,
                                BOOL nonExpansive);
 
+    // Record the size of a newly allocated dictionary if its layout can grow
+    void InitializeSize(DWORD numGenericArgs, DictionaryLayout * pDictLayout);
+
+  private:
+
+    // Return the dictionary in *ppDictionary, first replacing it by a larger copy if it has no room
+    // for slotIndex. The copy holds every entry of the layout and comes from pAllocator.
+    static Dictionary * GetDictionaryForSlot(Dictionary ** ppDictionary,
+                                             DWORD numGenericArgs,
+                                             DictionaryLayout * pDictLayout,
+                                             LoaderAllocator * pAllocator,
+                                             DWORD slotIndex);
+
 #endif // #ifndef DACCESS_COMPILE
 
   public:
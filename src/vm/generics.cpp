@@ -536,6 +536,9 @@ ClassLoader::CreateTypeHandleForNonCanonicalGenericInstantiation(
         pInstDest[iArg] = inst[iArg];
     }
 
+    // The layout may grow later, so record how much of it the dictionary holds
+    pDict->InitializeSize(ntypars, pOldMT->GetClass()->GetDictionaryLayout());
+
     // Copy interface map across
     InterfaceInfo_t * pInterfaceMap = (InterfaceInfo_t *)(pMemory + cbMT + cbOptional + (fHasDynamicInterfaceMap ? sizeof(DWORD_PTR) : 0));
 
@@ -488,6 +488,7 @@ InstantiatedMethodDesc::NewInstantiatedMethodDesc(MethodTable *pExactMT,
             pInstOrPerInstInfo = (TypeHandle *) (void*) amt.Track(pAllocator->GetHighFrequencyHeap()->AllocMem(S_SIZE_T(infoSize)));
             for (DWORD i = 0; i < methodInst.GetNumArgs(); i++)
                 pInstOrPerInstInfo[i] = methodInst[i];
+            ((Dictionary *)pInstOrPerInstInfo)->InitializeSize(methodInst.GetNumArgs(), pDL);
         }
 
         BOOL forComInterop = FALSE;
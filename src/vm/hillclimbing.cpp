@@ -376,7 +376,7 @@ GVAL_IMPL(int, HillClimbingLogFirstIndex);
 GVAL_IMPL(int, HillClimbingLogSize);
 
 
-void HillClimbing::LogTransition(int threadCount, double throughput, HillClimbingStateTransition transition)
+static void AppendHillClimbingLogEntry(int threadCount, int historyCount, double historyMean, HillClimbingStateTransition transition)
 {
     LIMITED_METHOD_CONTRACT;
 
@@ -395,10 +395,24 @@ void HillClimbing::LogTransition(int threadCount, double throughput, HillClimbin
     entry->Transition = transition;
     entry->NewControlSetting = threadCount;
 
-    entry->LastHistoryCount = (int)(min(m_totalSamples, m_samplesToMeasure) / m_wavePeriod) * m_wavePeriod;
-    entry->LastHistoryMean = (float) throughput;
+    entry->LastHistoryCount = historyCount;
+    entry->LastHistoryMean = (float) historyMean;
 
     HillClimbingLogSize++;
+#endif //DACCESS_COMPILE
+}
+
+
+void HillClimbing::LogTransition(int threadCount, double throughput, HillClimbingStateTransition transition)
+{
+    LIMITED_METHOD_CONTRACT;
+
+#ifndef DACCESS_COMPILE
+    AppendHillClimbingLogEntry(
+        threadCount, 
+        (int)(min(m_totalSamples, m_samplesToMeasure) / m_wavePeriod) * m_wavePeriod, 
+        throughput, 
+        transition);
 
     FireEtwThreadPoolWorkerThreadAdjustmentAdjustment(
         throughput, 
@@ -438,3 +452,109 @@ Complex HillClimbing::GetWaveComponent(double* samples, int sampleCount, double
     return Complex(q1 - q2 * cosine, q2 * sine) / (double)sampleCount;
 }
 
+
+//=========================================================================
+// LatencyController
+//=========================================================================
+
+void LatencyController::Initialize()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    m_latencyTarget = max((DWORD)1, CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_LatencyTarget));
+    m_oversubscriptionLimit = max(100, (int)CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_OversubscriptionLimit));
+    m_lastChangeTime = GetTickCount();
+}
+
+//
+// currentThreadCount is the current target number of working threads, numBlocked the number of
+// workers in a blocking wait while running a work item, and queueDelay how long the oldest pending
+// work has waited (zero if nothing is pending).
+//
+int LatencyController::Update(int currentThreadCount, int numBlocked, DWORD queueDelay)
+{
+    LIMITED_METHOD_CONTRACT;
+
+#ifdef DACCESS_COMPILE
+    return 1;
+#else
+
+    int numProcessors = (int)ThreadpoolMgr::NumberOfProcessors;
+
+    //
+    // Blocked workers do not count against the oversubscription limit, so a blocking workload can
+    // grow the pool as far as MaxLimitTotalWorkerThreads.
+    //
+    int maxRunnable = max(1, numProcessors * m_oversubscriptionLimit / 100);
+    int maxThreadCount = maxRunnable + numBlocked;
+
+    int newThreadCount = currentThreadCount;
+    HillClimbingStateTransition transition = Undefined;
+
+    DWORD currentTicks = GetTickCount();
+
+    if (queueDelay >= m_latencyTarget)
+    {
+        //
+        // Work is starving. Replace the blocked workers all at once, or add a single thread if
+        // none are blocked, but give the last change a latency target to take effect first.
+        //
+        if (currentThreadCount < maxThreadCount && currentTicks - m_lastChangeTime >= m_latencyTarget)
+        {
+            newThreadCount = currentThreadCount + min(max(1, numBlocked), numProcessors);
+            newThreadCount = min(newThreadCount, maxThreadCount);
+            transition = (numBlocked > 0) ? BlockedWorkers : QueueLatency;
+        }
+    }
+    else if (currentThreadCount > maxThreadCount && ThreadpoolMgr::cpuUtilization > CpuUtilizationHigh)
+    {
+        //
+        // Nothing is waiting and more threads are runnable than the processors can serve, so
+        // back off one thread at a time.
+        //
+        newThreadCount = max(maxThreadCount, currentThreadCount - 1);
+        transition = Oversubscribed;
+    }
+
+    newThreadCount = min(ThreadpoolMgr::MaxLimitTotalWorkerThreads, newThreadCount);
+    newThreadCount = max(ThreadpoolMgr::MinLimitTotalWorkerThreads, newThreadCount);
+
+    if (newThreadCount != currentThreadCount)
+        ChangeThreadCount(newThreadCount, numBlocked, queueDelay, transition);
+
+    return newThreadCount;
+
+#endif //DACCESS_COMPILE
+}
+
+
+void LatencyController::ForceChange(int newThreadCount, HillClimbingStateTransition transition)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    ChangeThreadCount(newThreadCount, 0, 0, transition);
+}
+
+
+void LatencyController::ChangeThreadCount(int newThreadCount, int numBlocked, DWORD queueDelay, HillClimbingStateTransition transition)
+{
+    LIMITED_METHOD_CONTRACT;
+
+#ifndef DACCESS_COMPILE
+    m_lastChangeTime = GetTickCount();
+
+    AppendHillClimbingLogEntry(newThreadCount, numBlocked, (double)queueDelay, transition);
+
+    FireEtwThreadPoolWorkerThreadAdjustmentAdjustment(
+        0.0, 
+        newThreadCount,
+        transition,
+        GetClrInstanceId());
+#endif //DACCESS_COMPILE
+}
@@ -30,6 +30,9 @@ enum HillClimbingStateTransition
     Stabilizing,
     Starvation, //used by ThreadpoolMgr
     ThreadTimedOut, //used by ThreadpoolMgr
+    QueueLatency, //used by LatencyController
+    BlockedWorkers, //used by LatencyController
+    Oversubscribed, //used by LatencyController
     Undefined,
 };
 
@@ -79,6 +82,36 @@ public:
     void ForceChange(int newThreadCount, HillClimbingStateTransition transition);
 };
 
+//
+// An alternative to HillClimbing, selected with ThreadPool_UseLatencyController. Instead of
+// searching for the thread count with the best throughput, it adds threads as soon as queued
+// work has gone unserviced for longer than a target latency. Workers that are running work
+// items without using a processor are counted as blocked and are replaced, while the workers
+// that remain runnable are capped at a multiple of the processor count. Decisions go to the
+// same log as HillClimbing's, with the number of blocked workers as the history count and the
+// queue delay in milliseconds as the history mean.
+//
+class LatencyController
+{
+private:
+    DWORD m_latencyTarget;          // milliseconds queued work may go unserviced before we add a thread
+    int m_oversubscriptionLimit;    // percentage of the processors that runnable workers may occupy
+    DWORD m_lastChangeTime;
+
+    void ChangeThreadCount(int newThreadCount, int numBlocked, DWORD queueDelay, HillClimbingStateTransition transition);
+
+public:
+    void Initialize();
+    int Update(int currentThreadCount, int numBlocked, DWORD queueDelay);
+    void ForceChange(int newThreadCount, HillClimbingStateTransition transition);
+
+    DWORD GetLatencyTarget()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return m_latencyTarget;
+    }
+};
+
 #define HillClimbingLogCapacity 200
 
 struct HillClimbingLogEntry
@@ -55,6 +55,7 @@
 #include "security.h"
 #include "safemath.h"
 #include "threadstatics.h"
+#include "castcache.h"
 
 #ifdef FEATURE_PREJIT
 #include "compile.h"
@@ -1955,6 +1956,12 @@ HCIMPL2(void*, JIT_GetSharedNonGCThreadStaticBase, SIZE_T moduleDomainID, DWORD
 {
     FCALL_CONTRACT;
 
+    // Look in the thread's cache of statics bases first
+    const DWORD dwCacheFlags = ThreadStatics::CACHE_NONGC;
+    void * pCachedBase = ThreadStatics::GetCachedNonGCStaticsBase(moduleDomainID, dwClassDomainID, dwCacheFlags);
+    if (pCachedBase != NULL)
+        return pCachedBase;
+
     // Get the ModuleIndex
     ModuleIndex index = 
         (Module::IsEncodedModuleIndex(moduleDomainID)) ?
@@ -1967,7 +1974,10 @@ HCIMPL2(void*, JIT_GetSharedNonGCThreadStaticBase, SIZE_T moduleDomainID, DWORD
     // If the TLM has been allocated and the class has been marked as initialized,
     // get the pointer to the non-GC statics base and return
     if (pThreadLocalModule != NULL && pThreadLocalModule->IsPrecomputedClassInitialized(dwClassDomainID))
+    {
+        ThreadStatics::CacheStaticsBase(moduleDomainID, dwClassDomainID, dwCacheFlags, pThreadLocalModule->GetPrecomputedNonGCStaticsBasePointer());
         return (void*)pThreadLocalModule->GetPrecomputedNonGCStaticsBasePointer();
+    }
 
     // If the TLM was not allocated or if the class was not marked as initialized
     // then we have to go through the slow path
@@ -1999,6 +2009,12 @@ HCIMPL2(void*, JIT_GetSharedGCThreadStaticBase, SIZE_T moduleDomainID, DWORD dwC
 {
     FCALL_CONTRACT;
 
+    // Look in the thread's cache of statics bases first
+    const DWORD dwCacheFlags = ThreadStatics::CACHE_GC;
+    void * pCachedBase = ThreadStatics::GetCachedGCStaticsBase(moduleDomainID, dwClassDomainID, dwCacheFlags);
+    if (pCachedBase != NULL)
+        return pCachedBase;
+
     // Get the ModuleIndex
     ModuleIndex index = 
         (Module::IsEncodedModuleIndex(moduleDomainID)) ?
@@ -2011,7 +2027,10 @@ HCIMPL2(void*, JIT_GetSharedGCThreadStaticBase, SIZE_T moduleDomainID, DWORD dwC
     // If the TLM has been allocated and the class has been marked as initialized,
     // get the pointer to the GC statics base and return
     if (pThreadLocalModule != NULL && pThreadLocalModule->IsPrecomputedClassInitialized(dwClassDomainID))
+    {
+        ThreadStatics::CacheStaticsBase(moduleDomainID, dwClassDomainID, dwCacheFlags, (TADDR)pThreadLocalModule->GetPrecomputedGCStaticsBaseHandle());
         return (void*)pThreadLocalModule->GetPrecomputedGCStaticsBasePointer();
+    }
 
     // If the TLM was not allocated or if the class was not marked as initialized
     // then we have to go through the slow path
@@ -2039,6 +2058,12 @@ HCIMPL2(void*, JIT_GetSharedNonGCThreadStaticBaseDynamicClass, SIZE_T moduleDoma
 {
     FCALL_CONTRACT;
 
+    // Look in the thread's cache of statics bases first
+    const DWORD dwCacheFlags = ThreadStatics::CACHE_DYNAMIC;
+    void * pCachedBase = ThreadStatics::GetCachedNonGCStaticsBase(moduleDomainID, dwDynamicClassDomainID, dwCacheFlags);
+    if (pCachedBase != NULL)
+        return pCachedBase;
+
     // Get the ModuleIndex
     ModuleIndex index = 
         (Module::IsEncodedModuleIndex(moduleDomainID)) ?
@@ -2054,7 +2079,10 @@ HCIMPL2(void*, JIT_GetSharedNonGCThreadStaticBaseDynamicClass, SIZE_T moduleDoma
     { 
         ThreadLocalModule::PTR_DynamicClassInfo pLocalInfo = pThreadLocalModule->GetDynamicClassInfoIfInitialized(dwDynamicClassDomainID);
         if (pLocalInfo != NULL)
+        {
+            ThreadStatics::CacheStaticsBase(moduleDomainID, dwDynamicClassDomainID, dwCacheFlags, dac_cast<TADDR>(pLocalInfo->m_pDynamicEntry->GetNonGCStaticsBasePointer()));
             return (void*)pLocalInfo->m_pDynamicEntry->GetNonGCStaticsBasePointer();
+        }
     }
 
     // If the TLM was not allocated or if the class was not marked as initialized
@@ -2090,6 +2118,12 @@ HCIMPL2(void*, JIT_GetSharedGCThreadStaticBaseDynamicClass, SIZE_T moduleDomainI
 {
     FCALL_CONTRACT;
 
+    // Look in the thread's cache of statics bases first
+    const DWORD dwCacheFlags = ThreadStatics::CACHE_GC | ThreadStatics::CACHE_DYNAMIC;
+    void * pCachedBase = ThreadStatics::GetCachedGCStaticsBase(moduleDomainID, dwDynamicClassDomainID, dwCacheFlags);
+    if (pCachedBase != NULL)
+        return pCachedBase;
+
     // Get the ModuleIndex
     ModuleIndex index = 
         (Module::IsEncodedModuleIndex(moduleDomainID)) ?
@@ -2105,7 +2139,10 @@ HCIMPL2(void*, JIT_GetSharedGCThreadStaticBaseDynamicClass, SIZE_T moduleDomainI
     { 
         ThreadLocalModule::PTR_DynamicClassInfo pLocalInfo = pThreadLocalModule->GetDynamicClassInfoIfInitialized(dwDynamicClassDomainID);
         if (pLocalInfo != NULL)
+        {
+            ThreadStatics::CacheStaticsBase(moduleDomainID, dwDynamicClassDomainID, dwCacheFlags, (TADDR)pLocalInfo->m_pDynamicEntry->m_pGCStatics);
             return (void*)pLocalInfo->m_pDynamicEntry->GetGCStaticsBasePointer();
+        }
     }
 
     // If the TLM was not allocated or if the class was not marked as initialized
@@ -2143,6 +2180,12 @@ HCIMPL1(void*, JIT_GetGenericsNonGCThreadStaticBase, MethodTable *pMT)
         PRECONDITION(pMT->HasGenericsStaticsInfo());
     } CONTRACTL_END;
 
+    // Look in the thread's cache of statics bases first
+    const DWORD dwCacheFlags = ThreadStatics::CACHE_DYNAMIC;
+    void * pCachedBase = ThreadStatics::GetCachedNonGCStaticsBase(dac_cast<TADDR>(pMT), 0, dwCacheFlags);
+    if (pCachedBase != NULL)
+        return pCachedBase;
+
     // This fast path will typically always be taken once the slow framed path below
     // has executed once.  Sometimes the slow path will be executed more than once,
     // e.g. if static fields are accessed during the call to CheckRunClassInitThrowing()
@@ -2164,7 +2207,10 @@ HCIMPL1(void*, JIT_GetGenericsNonGCThreadStaticBase, MethodTable *pMT)
     { 
         ThreadLocalModule::PTR_DynamicClassInfo pLocalInfo = pThreadLocalModule->GetDynamicClassInfoIfInitialized(dwDynamicClassDomainID);
         if (pLocalInfo != NULL)
+        {
+            ThreadStatics::CacheStaticsBase(dac_cast<TADDR>(pMT), 0, dwCacheFlags, dac_cast<TADDR>(pLocalInfo->m_pDynamicEntry->GetNonGCStaticsBasePointer()));
             return (void*)pLocalInfo->m_pDynamicEntry->GetNonGCStaticsBasePointer();
+        }
     }
     
     // If the TLM was not allocated or if the class was not marked as initialized
@@ -2188,6 +2234,12 @@ HCIMPL1(void*, JIT_GetGenericsGCThreadStaticBase, MethodTable *pMT)
         PRECONDITION(pMT->HasGenericsStaticsInfo());
     } CONTRACTL_END;
 
+    // Look in the thread's cache of statics bases first
+    const DWORD dwCacheFlags = ThreadStatics::CACHE_GC | ThreadStatics::CACHE_DYNAMIC;
+    void * pCachedBase = ThreadStatics::GetCachedGCStaticsBase(dac_cast<TADDR>(pMT), 0, dwCacheFlags);
+    if (pCachedBase != NULL)
+        return pCachedBase;
+
     // This fast path will typically always be taken once the slow framed path below
     // has executed once.  Sometimes the slow path will be executed more than once,
     // e.g. if static fields are accessed during the call to CheckRunClassInitThrowing()
@@ -2209,7 +2261,10 @@ HCIMPL1(void*, JIT_GetGenericsGCThreadStaticBase, MethodTable *pMT)
     { 
         ThreadLocalModule::PTR_DynamicClassInfo pLocalInfo = pThreadLocalModule->GetDynamicClassInfoIfInitialized(dwDynamicClassDomainID);
         if (pLocalInfo != NULL)
+        {
+            ThreadStatics::CacheStaticsBase(dac_cast<TADDR>(pMT), 0, dwCacheFlags, (TADDR)pLocalInfo->m_pDynamicEntry->m_pGCStatics);
             return (void*)pLocalInfo->m_pDynamicEntry->GetGCStaticsBasePointer();
+        }
     }
     
     // If the TLM was not allocated or if the class was not marked as initialized
@@ -2366,6 +2421,11 @@ TypeHandle::CastResult STDCALL ObjIsInstanceOfNoGC(Object *pObject, TypeHandle t
         return TypeHandle::MaybeCast;
     }
 
+    // From here on the result only depends on the two types; see if we already know it.
+    TypeHandle::CastResult cachedResult = CastCache::TryGet(pMT, toTypeHnd);
+    if (cachedResult != TypeHandle::MaybeCast)
+        return cachedResult;
+
     if (pMT->IsArray())
     {
         if (toTypeHnd.IsArray())
@@ -2472,6 +2532,12 @@ BOOL ObjIsInstanceOf(Object *pObject, TypeHandle toTypeHnd)
     }
 #endif // FEATURE_ICASTABLE
 
+    // Remember the result, unless it was decided by the object rather than its type.
+    if (CastCache::IsCacheable(obj->GetMethodTable(), toTypeHnd))
+    {
+        CastCache::Add(obj->GetMethodTable(), toTypeHnd, fCast);
+    }
+
     GCPROTECT_END();
 
     return(fCast);
@@ -2804,6 +2870,10 @@ NOINLINE HCIMPL2(Object *, JITutil_ChkCastAny, CORINFO_CLASS_HANDLE type, Object
 
     TypeHandle clsHnd(type);
 
+    // Avoid erecting the frame if the cast is known to succeed.
+    if (CastCache::TryGet(obj->GetMethodTable(), clsHnd) == TypeHandle::CanCast)
+        return obj;
+
     HELPER_METHOD_FRAME_BEGIN_RET_1(oref);
     if (!ObjIsInstanceOf(OBJECTREFToObject(oref), clsHnd))
         COMPlusThrowInvalidCastException(&oref, clsHnd);
@@ -2825,6 +2895,16 @@ NOINLINE HCIMPL2(Object *, JITutil_IsInstanceOfAny, CORINFO_CLASS_HANDLE type, O
 
     TypeHandle clsHnd(type);
 
+    // Avoid erecting the frame if the result is known.
+    switch (CastCache::TryGet(obj->GetMethodTable(), clsHnd)) {
+    case TypeHandle::CanCast:
+        return obj;
+    case TypeHandle::CannotCast:
+        return NULL;
+    default:
+        break;
+    }
+
     HELPER_METHOD_FRAME_BEGIN_RET_1(oref);
     if (!ObjIsInstanceOf(OBJECTREFToObject(oref), clsHnd))
         oref = NULL;
@@ -3707,6 +3787,7 @@ JIT_GenericHandleWorker(
     } CONTRACTL_END;
  
     MethodTable * pDeclaringMT = NULL;
+    ULONG dictionaryIndex = 0;
 
     if (pMT != NULL)
     {
@@ -3722,7 +3803,6 @@ JIT_GenericHandleWorker(
         // prepare for every possible derived type of the type containing the method). So instead we have to locate the exactly
         // instantiated (non-shared) super-type of the class passed in.
 
-        ULONG dictionaryIndex = 0;
         IfFailThrow(ptr.GetData(&dictionaryIndex));
 
         pDeclaringMT = pMT;
@@ -3752,6 +3832,15 @@ JIT_GenericHandleWorker(
     DictionaryEntry * pSlot;
     CORINFO_GENERIC_HANDLE result = (CORINFO_GENERIC_HANDLE)Dictionary::PopulateEntry(pMD, pDeclaringMT, signature, FALSE, &pSlot);
 
+    if ((pSlot != NULL) && (pDeclaringMT != pMT))
+    {
+        // pMT inherits the dictionary of pDeclaringMT, which may have been replaced by a larger copy
+        // since pMT was loaded. Pick up the copy so that the lookups through pMT find the entry inline.
+        Dictionary * pDictionary = pDeclaringMT->GetDictionary();
+        if (pMT->GetPerInstInfo()[dictionaryIndex] != pDictionary)
+            VolatileStore(EnsureWritablePages(&pMT->GetPerInstInfo()[dictionaryIndex]), pDictionary);
+    }
+
     if (pSlot == NULL)
     {
         // If we've overflowed the dictionary write the result to the cache.
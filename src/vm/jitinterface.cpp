@@ -1471,6 +1471,34 @@ static CorInfoHelpFunc getGenericStaticsHelper(FieldDesc * pField)
     return (CorInfoHelpFunc)helper;
 }
 
+#ifndef CROSSGEN_COMPILE
+/*********************************************************************/
+// Domain neutral code reaches statics through the shared statics helpers because every
+// appdomain has its own copy of them. When the process runs a single appdomain there is only
+// one copy, so once the class has been initialized the JIT can treat it the way it treats the
+// class in domain specific code.
+static BOOL IsClassInitedInSingleAppDomain(MethodTable * pMT)
+{
+    STANDARD_VM_CONTRACT;
+
+    if (!IsSingleAppDomain() || pMT->IsSharedByGenericInstantiations() || pMT->Collectible())
+        return FALSE;
+
+    if (pMT->IsClassPreInited())
+        return TRUE;
+
+    Module * pModule = pMT->GetModuleForStatics();
+    if (Module::IsEncodedModuleIndex(pModule->GetModuleID()) &&
+        GetAppDomain()->GetDomainLocalBlock()->TryGetDomainFile(pModule->GetModuleIndex()) == NULL)
+    {
+        // The module has not been loaded into the appdomain yet
+        return FALSE;
+    }
+
+    return pMT->IsClassInited();
+}
+#endif // CROSSGEN_COMPILE
+
 CorInfoHelpFunc CEEInfo::getSharedStaticsHelper(FieldDesc * pField, MethodTable * pFieldMT)
 {
     STANDARD_VM_CONTRACT;
@@ -1714,6 +1742,20 @@ void CEEInfo::getFieldInfo (CORINFO_RESOLVED_TOKEN * pResolvedToken,
                 fieldAccessor = intrinsicAccessor;
             }
             else
+#ifndef CROSSGEN_COMPILE
+            if (// Reads of initialized readonly statics from domain neutral code can use the address
+                // directly when there is a single appdomain. The JIT folds them like it does in
+                // domain specific code.
+                m_pMethodBeingCompiled->IsDomainNeutral() &&
+                !m_pMethodBeingCompiled->IsZapped() && !IsCompilingForNGen() &&
+                (flags & CORINFO_ACCESS_GET) && IsFdInitOnly(pField->GetAttributes()) &&
+                !pField->IsThreadStatic() &&
+                IsClassInitedInSingleAppDomain(pFieldMT))
+            {
+                fieldAccessor = CORINFO_FIELD_STATIC_ADDRESS;
+            }
+            else
+#endif // CROSSGEN_COMPILE
             if (// Domain neutral access.
                 m_pMethodBeingCompiled->IsDomainNeutral() || m_pMethodBeingCompiled->IsZapped() || IsCompilingForNGen() ||
                 // Static fields are not pinned in collectible types. We will always access 
@@ -2562,6 +2604,48 @@ unsigned CEEInfo::getClassGClayout (CORINFO_CLASS_HANDLE clsHnd, BYTE* gcPtrs)
 
     return result;
 }
+/*********************************************************************/
+bool CEEInfo::getSystemVAmd64PassStructInRegisterDescriptor(
+    CORINFO_CLASS_HANDLE clsHnd,
+    SYSTEMV_AMD64_CORINFO_STRUCT_REG_PASSING_DESCRIPTOR* structPassInRegDescPtr)
+{
+    CONTRACTL {
+        SO_TOLERANT;
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_PREEMPTIVE;
+    } CONTRACTL_END;
+
+    JIT_TO_EE_TRANSITION_LEAF();
+
+    memset(structPassInRegDescPtr, 0, sizeof(*structPassInRegDescPtr));
+
+#ifdef FEATURE_UNIX_AMD64_STRUCT_PASSING
+    TypeHandle th(clsHnd);
+
+    // The eightbytes of the structs passed in registers are all classified INTEGER; see
+    // MethodTableBuilder::CheckForSystemVStructPassing.
+    if (th.IsRegPassedStruct())
+    {
+        unsigned size = th.GetSize();
+        _ASSERTE(size > sizeof(void*) && size <= CLR_SYSTEMV_MAX_STRUCT_BYTES_TO_PASS_IN_REGISTERS);
+
+        structPassInRegDescPtr->passedInRegisters = true;
+        structPassInRegDescPtr->eightByteCount = CLR_SYSTEMV_MAX_EIGHTBYTES_COUNT_TO_PASS_IN_REGISTERS;
+        structPassInRegDescPtr->eightByteClassifications[0] = SystemVClassificationTypeInteger;
+        structPassInRegDescPtr->eightByteSizes[0] = sizeof(void*);
+        structPassInRegDescPtr->eightByteOffsets[0] = 0;
+        structPassInRegDescPtr->eightByteClassifications[1] = SystemVClassificationTypeInteger;
+        structPassInRegDescPtr->eightByteSizes[1] = (unsigned __int8)(size - sizeof(void*));
+        structPassInRegDescPtr->eightByteOffsets[1] = sizeof(void*);
+    }
+#endif // FEATURE_UNIX_AMD64_STRUCT_PASSING
+
+    EE_TO_JIT_TRANSITION_LEAF();
+
+    return true;
+}
+
 /*********************************************************************/
 unsigned CEEInfo::getClassNumInstanceFields (CORINFO_CLASS_HANDLE clsHnd)
 {
@@ -3235,6 +3319,7 @@ void CEEInfo::ComputeRuntimeLookupForSharedGenericToken(DictionaryEntryKind entr
 
     // Unless we decide otherwise, just do the lookup via a helper function
     pResult->indirections = CORINFO_USEHELPER;
+    pResult->sizeOffset = CORINFO_NO_SIZE_CHECK;
 
     MethodDesc *pContextMD = GetMethodFromContext(pResolvedToken->tokenContext);
     MethodTable *pContextMT = pContextMD->GetMethodTable();
@@ -4180,6 +4265,16 @@ CorInfoInitClassResult CEEInfo::initClass(
             result = CORINFO_INITCLASS_NOT_REQUIRED;
             goto exit;
         }
+
+#ifndef CROSSGEN_COMPILE
+        if (!methodBeingCompiled->IsZapped() && !IsCompilingForNGen() &&
+            IsClassInitedInSingleAppDomain(pTypeToInitMT))
+        {
+            // There is only one copy of the class and it has been initialized already.
+            result = CORINFO_INITCLASS_INITIALIZED;
+            goto exit;
+        }
+#endif // CROSSGEN_COMPILE
     }
     else
     {
@@ -495,6 +495,7 @@ public:
     BOOL checkMethodModifier(CORINFO_METHOD_HANDLE hMethod, LPCSTR modifier, BOOL fOptional);
 
     unsigned getClassGClayout (CORINFO_CLASS_HANDLE cls, BYTE* gcPtrs); /* really GCType* gcPtrs */
+    bool getSystemVAmd64PassStructInRegisterDescriptor(CORINFO_CLASS_HANDLE cls, SYSTEMV_AMD64_CORINFO_STRUCT_REG_PASSING_DESCRIPTOR* structPassInRegDescPtr);
     unsigned getClassNumInstanceFields(CORINFO_CLASS_HANDLE cls);
 
     // Check Visibility rules.
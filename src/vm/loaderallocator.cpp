@@ -7,6 +7,7 @@
 #include "common.h"
 #include "stringliteralmap.h"
 #include "virtualcallstub.h"
+#include "castcache.h"
 
 //*****************************************************************************
 // Used by LoaderAllocator::Init for easier readability.
@@ -1135,6 +1136,9 @@ void LoaderAllocator::Terminate()
 
     LOG((LF_CLASSLOADER, LL_INFO100, "Begin LoaderAllocator::Terminate for loader allocator %p\n", reinterpret_cast<void *>(static_cast<PTR_LoaderAllocator>(this))));
 
+    // The cast cache may refer to types allocated on our heaps, which are about to be freed.
+    CastCache::Flush();
+
     if (m_fGCPressure)
     {
         GCX_PREEMP();
@@ -1949,6 +1949,22 @@ public:
     CorElementType GetNativeHFAType();
 #endif // FEATURE_HFA
 
+#ifdef FEATURE_UNIX_AMD64_STRUCT_PASSING
+    // Value types of two eightbytes that the System V AMD64 ABI classifies as INTEGER are passed
+    // in two general purpose registers (or two stack slots) instead of by reference.
+    inline bool IsRegPassedStruct()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return !!GetFlag(enum_flag_IsRegStructPassed);
+    }
+
+    inline void SetRegPassedStruct()
+    {
+        LIMITED_METHOD_CONTRACT;
+        SetFlag(enum_flag_IsRegStructPassed);
+    }
+#endif // FEATURE_UNIX_AMD64_STRUCT_PASSING
+
 #ifdef FEATURE_64BIT_ALIGNMENT
     // Returns true iff the native view of this type requires 64-bit aligment.
     bool NativeRequiresAlign8();
@@ -3776,6 +3792,12 @@ private:
         enum_flag_HasPreciseInitCctors      = 0x00000400,   // Do we need to run class constructors at allocation time? (Not perf important, could be moved to EEClass
 
         enum_flag_IsHFA                     = 0x00000800,   // This type is an HFA (Homogenous Floating-point Aggregate)
+#ifdef FEATURE_UNIX_AMD64_STRUCT_PASSING
+        enum_flag_IsRegStructPassed         = 0x00000800,   // This type is passed in registers (System V AMD64); shares the bit with IsHFA
+#endif
+#if defined(FEATURE_HFA) && defined(FEATURE_UNIX_AMD64_STRUCT_PASSING)
+#error enum_flag_IsHFA and enum_flag_IsRegStructPassed share a bit, so the two features cannot be enabled together
+#endif
 
         // In a perfect world we would fill these flags using other flags that we already have
         // which have a constant value for something which has a component size.
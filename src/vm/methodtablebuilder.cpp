@@ -1910,6 +1910,9 @@ MethodTableBuilder::BuildMethodTableThrowing(
 
 #ifdef FEATURE_HFA
         CheckForHFA(pByValueClassCache);
+#endif
+#ifdef FEATURE_UNIX_AMD64_STRUCT_PASSING
+        CheckForSystemVStructPassing(pByValueClassCache);
 #endif
     }
 
@@ -8625,6 +8628,97 @@ void MethodTableBuilder::CheckForNativeHFA()
 }
 #endif // FEATURE_HFA
 
+#ifdef FEATURE_UNIX_AMD64_STRUCT_PASSING
+//---------------------------------------------------------------------------------------
+//
+// Returns true if the instance fields of the value type pMT, placed at offset dwBaseOffset, are all
+// naturally aligned integers, pointers or object references, looking through nested value types.
+//
+static bool HasOnlyAlignedIntegerFields(MethodTable * pMT, DWORD dwBaseOffset)
+{
+    STANDARD_VM_CONTRACT;
+
+    if (pMT->GetClass()->HasExplicitFieldOffsetLayout())
+        return false;
+
+    ApproxFieldDescIterator fieldIterator(pMT, ApproxFieldDescIterator::INSTANCE_FIELDS);
+    for (FieldDesc *pFD = fieldIterator.Next(); pFD != NULL; pFD = fieldIterator.Next())
+    {
+        CorElementType fieldType = pFD->GetFieldType();
+        DWORD dwOffset = dwBaseOffset + pFD->GetOffset_NoLogging();
+
+        if (fieldType == ELEMENT_TYPE_VALUETYPE)
+        {
+            if (!HasOnlyAlignedIntegerFields(pFD->GetApproxFieldTypeHandleThrowing().GetMethodTable(), dwOffset))
+                return false;
+        }
+        else if (fieldType == ELEMENT_TYPE_R4 || fieldType == ELEMENT_TYPE_R8)
+        {
+            return false;
+        }
+        else if (dwOffset % CorTypeInfo::Size(fieldType) != 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------
+//
+// Marks value types that the System V AMD64 ABI passes in two general purpose registers:
+// 9 to 16 bytes of naturally aligned integer fields. The size of the second eightbyte has
+// to be 1, 2, 4 or 8 bytes so that it can be moved with a single load or store.
+//
+// Structs with floating point fields (classified SSE) and odd sizes keep being passed by
+// reference, which is what the JIT and the stubs implement for them.
+//
+VOID
+MethodTableBuilder::CheckForSystemVStructPassing(MethodTable ** pByValueClassCache)
+{
+    STANDARD_VM_CONTRACT;
+
+    // This method should be called for valuetypes only
+    _ASSERTE(IsValueClass());
+
+    if (HasExplicitFieldOffsetLayout())
+        return;
+
+    DWORD totalSize = bmtFP->NumInstanceFieldBytes;
+    if (totalSize <= sizeof(void*) || totalSize > 2 * sizeof(void*))
+        return;
+
+    DWORD secondEightByteSize = totalSize - sizeof(void*);
+    if ((secondEightByteSize & (secondEightByteSize - 1)) != 0)
+        return;
+
+    FieldDesc *pFieldDescList = GetHalfBakedClass()->GetFieldDescList();
+    for (UINT i = 0; i < bmtEnumFields->dwNumInstanceFields; i++)
+    {
+        FieldDesc *pFD = &pFieldDescList[i];
+        CorElementType fieldType = pFD->GetFieldType();
+        DWORD dwOffset = pFD->GetOffset_NoLogging();
+
+        if (fieldType == ELEMENT_TYPE_VALUETYPE)
+        {
+            if (!HasOnlyAlignedIntegerFields(pByValueClassCache[i], dwOffset))
+                return;
+        }
+        else if (fieldType == ELEMENT_TYPE_R4 || fieldType == ELEMENT_TYPE_R8)
+        {
+            return;
+        }
+        else if (dwOffset % CorTypeInfo::Size(fieldType) != 0)
+        {
+            return;
+        }
+    }
+
+    GetHalfBakedMethodTable()->SetRegPassedStruct();
+}
+#endif // FEATURE_UNIX_AMD64_STRUCT_PASSING
+
 //---------------------------------------------------------------------------------------
 //
 // make sure that no object fields are overlapped incorrectly and define the
@@ -10971,6 +11065,9 @@ MethodTableBuilder::SetupMethodTable2(
         {
             pInstDest[j] = inst[j];
         }
+
+        // Dictionaries that can grow also record their size after the type parameters
+        pMT->GetDictionary()->InitializeSize(bmtGenerics->GetNumGenericArgs(), GetHalfBakedClass()->GetDictionaryLayout());
     }
 
     CorElementType normalizedType = ELEMENT_TYPE_CLASS;
@@ -37,6 +37,8 @@ const int      MULTICOREJITLIFE  = 60 * 1000;       // 60 seconds
 
 const int      MULTICOREJITBLOCKLIMIT = 10 * 1000;  // 10 seconds
 
+const int      MULTICOREJITHELPERWAIT = 100;        // 100 ms, helper threads recheck for abort at least this often
+
                                                     //  8-bit module index  
 
                                                     // Method JIT information: 8-bit module 4-bit flag 20-bit method index
@@ -52,6 +54,8 @@ const unsigned MODULE_MASK       = 0xFF;            //  8-bit dependent module i
 
 const int      MAX_WALKBACK      = 128;
 
+const unsigned MAX_PLAYER_THREADS = 8;              // Maximum number of threads compiling a profile, including the player thread
+
 enum
 {
     MULTICOREJIT_PROFILE_VERSION   = 101,
@@ -275,13 +279,49 @@ private:
     unsigned                           m_headerModuleCount;
     unsigned                           m_moduleCount;
     PlayerModuleInfo                 * m_pModules;
+
+    // Parallel playback: the player thread loads modules in dependency order and publishes each group of
+    // methods between dependencies; helper threads compile the group from the front (earliest recorded
+    // call first) while the player thread walks it from the back. Slots are claimed with interlocked
+    // operations, so no lock is held while compiling.
+    unsigned                           m_nHelperCount;
+    volatile LONG                      m_nActiveHelpers;        // Helper threads started and not yet finished
+    volatile bool                      m_fPlaybackDone;
+    CLREvent                           m_groupEvent;            // Set while a group is published
+    const unsigned * volatile          m_pGroup;                // Published group, NULL if none
+    volatile LONG                      m_nGroupGeneration;
+    volatile LONG                      m_nGroupSize;
+    volatile LONG                      m_nGroupNext;            // Next slot for helper threads
+    volatile LONG                      m_nGroupUsers;           // Helper threads working on the published group
+    volatile LONG                      m_groupClaimed[MAX_WALKBACK * MAX_PLAYER_THREADS];
+    MulticoreJitPlayerStat             m_helperStats[MAX_PLAYER_THREADS];   // Written by one helper thread each, merged into m_stats at the end
     
-    void JITMethod(Module * pModule, unsigned methodIndex);
+    void JITMethod(Module * pModule, unsigned methodIndex, MulticoreJitPlayerStat & stats);
+
+    void JITGroupMethod(unsigned jitInfo, MulticoreJitPlayerStat & stats);
+
+    bool ClaimGroupSlot(LONG slot);
+
+    void PublishGroup(const unsigned * pGroup, int size);
+
+    void RetireGroup();
+
+    void StartHelperThreads();
+
+    void StopHelperThreads();
+
+    void WaitForNextGroup(LONG generation);
+
+    void HelperCompileGroups(MulticoreJitPlayerStat & stats);
+
+    HRESULT HelperThreadProc(Thread * pThread, unsigned index);
+
+    static DWORD WINAPI StaticHelperThreadProc(void *args);
 
     HRESULT HandleModuleRecord(const ModuleRecord * pModule);
     HRESULT HandleMethodRecord(unsigned * buffer, int count);
 
-    bool CompileMethodDesc(Module * pModule, MethodDesc * pMD);
+    bool CompileMethodDesc(Module * pModule, MethodDesc * pMD, MulticoreJitPlayerStat & stats);
 
     HRESULT PlayProfile();
 
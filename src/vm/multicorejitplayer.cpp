@@ -393,6 +393,20 @@ MulticoreJitProfilePlayer::MulticoreJitProfilePlayer(AppDomain * pDomain, ICLRPr
     
     m_busyWith           = EmptyToken;
 
+    m_nHelperCount       = 0;
+    m_nActiveHelpers     = 0;
+    m_fPlaybackDone      = false;
+    m_pGroup             = NULL;
+    m_nGroupGeneration   = 0;
+    m_nGroupSize         = 0;
+    m_nGroupNext         = 0;
+    m_nGroupUsers        = 0;
+
+    for (unsigned i = 0; i < MAX_PLAYER_THREADS; i ++)
+    {
+        m_helperStats[i].Clear();
+    }
+
     m_nStartTime         = GetTickCount();
 }
 
@@ -411,6 +425,11 @@ MulticoreJitProfilePlayer::~MulticoreJitProfilePlayer()
     {
         delete [] m_pFileBuffer;
     }
+
+    // Helper threads have all finished by now, see StopHelperThreads
+    _ASSERTE(m_nActiveHelpers == 0);
+
+    m_groupEvent.CloseEvent();
 }
 
 
@@ -534,7 +553,7 @@ HRESULT MulticoreJitProfilePlayer::HandleModuleRecord(const ModuleRecord * pMod)
 
 // Call JIT to compile a method
 
-bool MulticoreJitProfilePlayer::CompileMethodDesc(Module * pModule, MethodDesc * pMD)
+bool MulticoreJitProfilePlayer::CompileMethodDesc(Module * pModule, MethodDesc * pMD, MulticoreJitPlayerStat & stats)
 {
     STANDARD_VM_CONTRACT;
     
@@ -544,12 +563,12 @@ bool MulticoreJitProfilePlayer::CompileMethodDesc(Module * pModule, MethodDesc *
         
     if (status == COR_ILMETHOD_DECODER::SUCCESS)
     {
-        if (m_stats.m_nTryCompiling == 0)
+        if (stats.m_nTryCompiling == 0)
         {
             MulticoreJitTrace(("First call to MakeJitWorker"));
         }
 
-        m_stats.m_nTryCompiling ++;
+        stats.m_nTryCompiling ++;
 
 #if defined(FEATURE_CORECLR) && defined(FEATURE_HOSTED_BINDER)
         // Reset the flag to allow managed code to be called in multicore JIT background thread from this routine
@@ -566,8 +585,42 @@ bool MulticoreJitProfilePlayer::CompileMethodDesc(Module * pModule, MethodDesc *
 }
 
 
+inline bool MethodJifInfo(unsigned inst)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    return ((inst & MODULE_DEPENDENCY) == 0);
+}
+
+
+// JIT one method of a group, on the player thread or a helper thread; counts go to the calling thread's stats
+void MulticoreJitProfilePlayer::JITGroupMethod(unsigned jitInfo, MulticoreJitPlayerStat & stats)
+{
+    STANDARD_VM_CONTRACT;
+
+    _ASSERTE(MethodJifInfo(jitInfo));
+
+    PlayerModuleInfo & mod = m_pModules[jitInfo >> 24];
+
+#if defined(FEATURE_CORECLR) && defined(FEATURE_HOSTED_BINDER)
+    _ASSERTE(mod.IsModuleLoaded());
+#else
+    _ASSERTE(mod.IsModuleLoaded() && ! mod.IsLowerLevel());
+#endif
+
+    if (mod.m_enableJit)
+    {
+        JITMethod(mod.m_pModule, jitInfo, stats);
+    }
+    else
+    {
+        stats.m_nFilteredMethods ++;
+    }
+}
+
+
 // Conditional JIT of a method
-void MulticoreJitProfilePlayer::JITMethod(Module * pModule, unsigned methodIndex)
+void MulticoreJitProfilePlayer::JITMethod(Module * pModule, unsigned methodIndex, MulticoreJitPlayerStat & stats)
 {
     STANDARD_VM_CONTRACT;
     
@@ -606,7 +659,7 @@ void MulticoreJitProfilePlayer::JITMethod(Module * pModule, unsigned methodIndex
 
         if (pMethod->GetNativeCode() != NULL) // last check before
         {
-            m_stats.m_nHasNativeCode ++;
+            stats.m_nHasNativeCode ++;
 
             return;
         }
@@ -614,7 +667,7 @@ void MulticoreJitProfilePlayer::JITMethod(Module * pModule, unsigned methodIndex
         {                    
             m_busyWith = methodIndex;
 
-            bool rslt = CompileMethodDesc(pModule, pMethod);
+            bool rslt = CompileMethodDesc(pModule, pMethod, stats);
 
             m_busyWith = EmptyToken;
 
@@ -627,7 +680,7 @@ void MulticoreJitProfilePlayer::JITMethod(Module * pModule, unsigned methodIndex
     
 BadMethod:
 
-    m_stats.m_nFilteredMethods ++;
+    stats.m_nFilteredMethods ++;
         
     MulticoreJitTrace(("Filtered out methods: pModule:[%s] token:[%x]", pModule->GetSimpleName(), token));
 
@@ -996,14 +1049,6 @@ DomainAssembly * MulticoreJitProfilePlayer::LoadAssembly(SString & assemblyName)
 #endif
 
 
-inline bool MethodJifInfo(unsigned inst)
-{
-    LIMITED_METHOD_CONTRACT;
-
-    return ((inst & MODULE_DEPENDENCY) == 0);
-}
-
-
 // Process a block of methodDef, call JIT if not blocked
 HRESULT MulticoreJitProfilePlayer::HandleMethodRecord(unsigned * buffer, int count)
 {
@@ -1069,12 +1114,16 @@ HRESULT MulticoreJitProfilePlayer::HandleMethodRecord(unsigned * buffer, int cou
                     {
                         int run = 1; // size of the group
 
+                        // Each helper thread takes a share of the group from the front
+                        int maxRun = MAX_WALKBACK * (int) (m_nHelperCount + 1);
+
                         while (((pos + run) < count) && MethodJifInfo(buffer[pos + run]))
                         {
                             run ++;
 
-                            // If walk-back run is too long, lots of methods in the front will be missed by background thread
-                            if (run > MAX_WALKBACK)
+                            // If walk-back run is too long, lots of methods in the front will be missed by background thread.
+                            // This also keeps the group within m_groupClaimed.
+                            if (run >= maxRun)
                             {
                                 break;
                             }
@@ -1085,28 +1134,27 @@ HRESULT MulticoreJitProfilePlayer::HandleMethodRecord(unsigned * buffer, int cou
                             MulticoreJitTrace(("Jit backwards %d methods",  run));
                         }
 
-                        // Walk backwards within the same group, may be from different modules
-                        for (int p = pos + run - 1; p >= pos; p --)
-                        {
-                            unsigned inst = buffer[p];
+                        PublishGroup(buffer + pos, run);
 
-                            _ASSERTE(MethodJifInfo(inst));
-
-                            PlayerModuleInfo & mod = m_pModules[inst >> 24];
+                        // Walk backwards within the same group, may be from different modules. Helper threads claim
+                        // slots in increasing order, so once a slot is taken everything before it is taken as well.
+                        for (int p = run - 1; (p >= 0) && ClaimGroupSlot(p); p --)
+                        {
+                            JITGroupMethod(buffer[pos + p], m_stats);
+                        }
 
-#if defined(FEATURE_CORECLR) && defined(FEATURE_HOSTED_BINDER)
-                            _ASSERTE(mod.IsModuleLoaded());
-#else
-                            _ASSERTE(mod.IsModuleLoaded() && ! mod.IsLowerLevel());
-#endif
+                        RetireGroup();
 
-                            if (mod.m_enableJit)
-                            {
-                                JITMethod(mod.m_pModule, inst);
-                            }
-                            else
+                        // A helper thread that threw has left its share of the group unclaimed, and the walk above
+                        // may have stopped before reaching it. No helper is in the group any more, so take it here.
+                        if (m_nHelperCount > 0)
+                        {
+                            for (int p = 0; p < run; p ++)
                             {
-                                m_stats.m_nFilteredMethods ++;
+                                if (ClaimGroupSlot(p))
+                                {
+                                    JITGroupMethod(buffer[pos + p], m_stats);
+                                }
                             }
                         }
 
@@ -1382,6 +1430,8 @@ HRESULT MulticoreJitProfilePlayer::JITThreadProc(Thread * pThread)
             // Go into preemptive mode
             GCX_PREEMP();
 
+            StartHelperThreads();
+
             m_stats.m_hr = PlayProfile();
         }
         END_DOMAIN_TRANSITION;
@@ -1395,6 +1445,9 @@ HRESULT MulticoreJitProfilePlayer::JITThreadProc(Thread * pThread)
     }
     EX_END_CATCH(SwallowAllExceptions);
 
+    // Helper threads reference this player, wait for them even if playback failed
+    StopHelperThreads();
+
     return (DWORD) m_stats.m_hr;
 }
 
@@ -1456,6 +1509,360 @@ DWORD WINAPI MulticoreJitProfilePlayer::StaticJITThreadProc(void *args)
 }
 
 
+
+///////////////////////////////////////////////////////////////////////////////////
+//
+//                  Parallel playback
+//
+///////////////////////////////////////////////////////////////////////////////////
+
+// Parameter passed to a helper thread; deleted by the helper thread
+struct MulticoreJitHelperParam
+{
+    MulticoreJitProfilePlayer * pPlayer;
+    Thread                    * pThread;
+    unsigned                    index;      // Slot in m_helperStats
+};
+
+
+// Claim a slot of the published group; each slot is compiled by exactly one thread
+bool MulticoreJitProfilePlayer::ClaimGroupSlot(LONG slot)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    _ASSERTE((slot >= 0) && (slot < (LONG) (MAX_WALKBACK * MAX_PLAYER_THREADS)));
+
+    return InterlockedCompareExchange(& m_groupClaimed[slot], 1, 0) == 0;
+}
+
+
+// Make a group of methods available to helper threads, called on the player thread only
+void MulticoreJitProfilePlayer::PublishGroup(const unsigned * pGroup, int size)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    _ASSERTE((m_pGroup == NULL) && (m_nGroupUsers == 0));
+
+    for (int i = 0; i < size; i ++)
+    {
+        m_groupClaimed[i] = 0;
+    }
+
+    m_nGroupSize = size;
+    m_nGroupNext = 0;
+
+    if (m_nHelperCount > 0)
+    {
+        m_nGroupGeneration ++;
+
+        // Interlocked operation makes the slots visible before the group itself
+        InterlockedExchangeT(& m_pGroup, pGroup);
+
+        m_groupEvent.Set();
+    }
+}
+
+
+// Withdraw the published group and wait for helper threads to leave it, so its slots can be reused
+void MulticoreJitProfilePlayer::RetireGroup()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    if (m_nHelperCount > 0)
+    {
+        m_groupEvent.Reset();
+
+        InterlockedExchangeT(& m_pGroup, (const unsigned *) NULL);
+
+        // A helper thread registers in m_nGroupUsers before reading m_pGroup, so after this no helper
+        // can still be working on the group
+        while (m_nGroupUsers != 0)
+        {
+            ClrSleepEx(DelayUnit, FALSE);
+        }
+    }
+}
+
+
+// Start (MultiCoreJitThreads - 1) helper threads, called on the player thread
+void MulticoreJitProfilePlayer::StartHelperThreads()
+{
+    STANDARD_VM_CONTRACT;
+
+    unsigned threads = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_MultiCoreJitThreads);
+
+    if (threads == 0)
+    {
+        threads = GetCurrentProcessCpuCount();
+    }
+
+    threads = min(threads, MAX_PLAYER_THREADS);
+
+    if (threads <= 1)
+    {
+        return;
+    }
+
+    m_groupEvent.CreateManualEvent(FALSE);
+
+    unsigned stackSize = 64 * sizeof(SIZE_T) * 1024; // Same as the player thread
+
+#ifdef _DEBUG
+    stackSize *= 2;
+#endif
+
+    for (unsigned i = 1; i < threads; i ++)
+    {
+        NewHolder<MulticoreJitHelperParam> param(new (nothrow) MulticoreJitHelperParam);
+
+        if (param == NULL)
+        {
+            break;
+        }
+
+        Thread * pThread = SetupUnstartedThread();
+
+        param->pPlayer = this;
+        param->pThread = pThread;
+        param->index   = m_nHelperCount;
+
+        InterlockedIncrement(& m_nActiveHelpers);
+
+        if (! pThread->CreateNewThread(stackSize, StaticHelperThreadProc, param))
+        {
+            InterlockedDecrement(& m_nActiveHelpers);
+
+            pThread->DecExternalCount(FALSE);
+
+            break;
+        }
+
+        if (pThread->StartThread() == 0)
+        {
+            // The thread never runs, so it will neither free the parameter nor signal its exit
+            InterlockedDecrement(& m_nActiveHelpers);
+
+            break;
+        }
+
+        // Owned by the helper thread from now on
+        param.SuppressRelease();
+
+        m_nHelperCount ++;
+    }
+
+    MulticoreJitTrace(("StartHelperThreads: %d helper threads", m_nHelperCount));
+
+    _FireEtwMulticoreJit(W("HELPERTHREADS"), W(""), m_nHelperCount, threads, 0);
+}
+
+
+// Tell helper threads playback is over and wait for them to exit, called on the player thread
+void MulticoreJitProfilePlayer::StopHelperThreads()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    m_fPlaybackDone = true;
+
+    if (m_groupEvent.IsValid())
+    {
+        m_groupEvent.Set();
+    }
+
+    while (m_nActiveHelpers != 0)
+    {
+        ClrSleepEx(DelayUnit, FALSE);
+    }
+
+    // Helper threads only update their own counters, merge them now that they are all gone
+    for (unsigned i = 0; i < m_nHelperCount; i ++)
+    {
+        const MulticoreJitPlayerStat & stats = m_helperStats[i];
+
+        m_stats.m_nHasNativeCode   += stats.m_nHasNativeCode;
+        m_stats.m_nTryCompiling    += stats.m_nTryCompiling;
+        m_stats.m_nFilteredMethods += stats.m_nFilteredMethods;
+    }
+}
+
+
+// Block the calling helper thread until the player thread publishes a group after 'generation'. Whoever
+// finds the group used up resets the event; the player thread may have published the next group (or
+// ended playback) in between, so check again after the reset and put the signal back if it did.
+void MulticoreJitProfilePlayer::WaitForNextGroup(LONG generation)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    m_groupEvent.Reset();
+
+    if ((m_nGroupGeneration != generation) || m_fPlaybackDone)
+    {
+        m_groupEvent.Set();
+    }
+}
+
+
+// Helper thread loop: compile slots of each published group from the front until playback is over
+void MulticoreJitProfilePlayer::HelperCompileGroups(MulticoreJitPlayerStat & stats)
+{
+    STANDARD_VM_CONTRACT;
+
+    LONG lastGeneration = 0;
+
+    while (! m_fPlaybackDone && ! ShouldAbort(true))
+    {
+        m_groupEvent.Wait(MULTICOREJITHELPERWAIT, FALSE);
+
+        InterlockedIncrement(& m_nGroupUsers);
+
+        const unsigned * pGroup = m_pGroup;
+        LONG generation = m_nGroupGeneration;
+
+        if ((pGroup == NULL) || (generation == lastGeneration))
+        {
+            InterlockedDecrement(& m_nGroupUsers);
+
+            // Nothing left in the current group, sleep until the player thread publishes the next one
+            if (pGroup != NULL)
+            {
+                WaitForNextGroup(generation);
+            }
+
+            continue;
+        }
+
+        lastGeneration = generation;
+
+        EX_TRY
+        {
+            LONG slot;
+
+            while (! ShouldAbort(true) && ((slot = InterlockedIncrement(& m_nGroupNext) - 1) < m_nGroupSize))
+            {
+                if (ClaimGroupSlot(slot))
+                {
+                    JITGroupMethod(pGroup[slot], stats);
+                }
+            }
+        }
+        EX_CATCH
+        {
+            // Leave the rest of the group to the player thread, which compiles the unclaimed slots after retiring it
+        }
+        EX_END_CATCH(SwallowAllExceptions);
+
+        InterlockedDecrement(& m_nGroupUsers);
+    }
+}
+
+
+HRESULT MulticoreJitProfilePlayer::HelperThreadProc(Thread * pThread, unsigned index)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+        INJECT_FAULT(COMPlusThrowOM(););
+    }
+    CONTRACTL_END;
+
+    HRESULT hr = S_OK;
+
+    EX_TRY
+    {
+        ENTER_DOMAIN_ID(m_DomainID);
+        {
+            // Go into preemptive mode
+            GCX_PREEMP();
+
+            // 1 marks background thread
+            FireEtwThreadCreated((ULONGLONG) pThread, (ULONGLONG) GetAppDomain(), 1, pThread->GetThreadId(), pThread->GetOSThreadId(), GetClrInstanceId());
+
+            HelperCompileGroups(m_helperStats[index]);
+
+            FireEtwThreadTerminated((ULONGLONG) pThread, (ULONGLONG) GetAppDomain(), GetClrInstanceId());
+        }
+        END_DOMAIN_TRANSITION;
+    }
+    EX_CATCH
+    {
+        hr = COR_E_EXCEPTION;
+    }
+    EX_END_CATCH(SwallowAllExceptions);
+
+    return hr;
+}
+
+
+DWORD WINAPI MulticoreJitProfilePlayer::StaticHelperThreadProc(void *args)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_ANY;
+        ENTRY_POINT;
+        INJECT_FAULT(COMPlusThrowOM(););
+    }
+    CONTRACTL_END;
+
+    HRESULT hr = S_OK;
+
+    BEGIN_ENTRYPOINT_NOTHROW;
+
+    MulticoreJitTrace(("StaticHelperThreadProc starting"));
+
+    MulticoreJitHelperParam * pParam = (MulticoreJitHelperParam *) args;
+
+    MulticoreJitProfilePlayer * pPlayer = pParam->pPlayer;
+    Thread                    * pThread = pParam->pThread;
+    unsigned                    index   = pParam->index;
+
+    delete pParam;
+
+    if (pThread->HasStarted())
+    {
+        // Disable calling managed code in background thread
+        ThreadStateNCStackHolder holder(TRUE, Thread::TSNC_CallingManagedCodeDisabled);
+
+        // Run as background thread, so ThreadStore::WaitForOtherThreads will not wait for it
+        pThread->SetBackground(TRUE);
+
+        hr = pPlayer->HelperThreadProc(pThread, index);
+    }
+
+    DestroyThread(pThread);
+
+    MulticoreJitTrace(("StaticHelperThreadProc ending(%x)", hr));
+
+    // Last access to the player, which the player thread deletes once all helpers are gone
+    InterlockedDecrement(& pPlayer->m_nActiveHelpers);
+
+    END_ENTRYPOINT_NOTHROW;
+
+    return (DWORD) hr;
+}
+
+
 HRESULT MulticoreJitProfilePlayer::ProcessProfile(const wchar_t * pFileName)
 {
     STANDARD_VM_CONTRACT;
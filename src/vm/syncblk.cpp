@@ -41,6 +41,10 @@
 #define MAXSYNCBLOCK (PAGE_SIZE-sizeof(void*))/sizeof(SyncBlock)
 #define SYNC_TABLE_INITIAL_SIZE 250
 
+// Number of sync blocks CleanupSyncBlocks returns to the free list per
+// acquisition of the cache lock.
+#define SYNC_BLOCK_CLEANUP_BATCH 64
+
 //#define DUMP_SB
 
 class  SyncBlockArray
@@ -596,12 +600,18 @@ void SyncBlockCache::CleanupSyncBlocks()
     {
         SyncBlockCache *pThis;
         SyncBlock* psb;
+        SLink* pBatchFirst;
+        SLink* pBatchLast;
+        DWORD batchCount;
 #ifdef FEATURE_COMINTEROP
         RCW* pRCW;
 #endif
     } param;
     param.pThis = this;
     param.psb = NULL;
+    param.pBatchFirst = NULL;
+    param.pBatchLast = NULL;
+    param.batchCount = 0;
 #ifdef FEATURE_COMINTEROP
     param.pRCW = NULL;
 #endif
@@ -633,10 +643,28 @@ void SyncBlockCache::CleanupSyncBlocks()
             }
 #endif // FEATURE_COMINTEROP
 
-            // Delete the sync block.
-            pParam->pThis->DeleteSyncBlock(pParam->psb);
+            // Destruct the sync block, its memory goes back to the free list
+            // with the rest of the batch so that we take the cache lock once
+            // per batch rather than once per sync block.
+            pParam->pThis->DestructSyncBlock(pParam->psb);
+
+            pParam->psb->m_Link.m_pNext = pParam->pBatchFirst;
+            if (pParam->pBatchFirst == NULL)
+            {
+                pParam->pBatchLast = &pParam->psb->m_Link;
+            }
+            pParam->pBatchFirst = &pParam->psb->m_Link;
+            pParam->batchCount++;
             pParam->psb = NULL;
 
+            if (pParam->batchCount >= SYNC_BLOCK_CLEANUP_BATCH)
+            {
+                pParam->pThis->DeleteSyncBlockMemoryBatch(pParam->pBatchFirst, pParam->pBatchLast, pParam->batchCount);
+                pParam->pBatchFirst = NULL;
+                pParam->pBatchLast = NULL;
+                pParam->batchCount = 0;
+            }
+
             // pulse GC mode to allow GC to perform its work
             if (FinalizerThread::GetFinalizerThread()->CatchAtSafePointOpportunistic())
             {
@@ -662,6 +690,9 @@ void SyncBlockCache::CleanupSyncBlocks()
 
         if (param.psb)
             DeleteSyncBlock(param.psb);
+
+        if (param.pBatchFirst)
+            DeleteSyncBlockMemoryBatch(param.pBatchFirst, param.pBatchLast, param.batchCount);
     } EE_END_FINALLY;
 }
 
@@ -1257,6 +1288,32 @@ void SyncBlockCache::DeleteSyncBlock(SyncBlock *psb)
     }
     CONTRACTL_END;
 
+    DestructSyncBlock(psb);
+
+    //synchronizer with the consumers,
+    // <TODO>@todo we don't really need a lock here, we can come up
+    // with some simple algo to avoid taking a lock </TODO>
+    {
+        SyncBlockCache::LockHolder lh(this);
+
+        DeleteSyncBlockMemory(psb);
+    }
+}
+
+// destructs a used sync block and releases its interop and EnC data, but does
+// not return its memory to the free pool
+void SyncBlockCache::DestructSyncBlock(SyncBlock *psb)
+{
+    CONTRACTL
+    {
+        INSTANCE_CHECK;
+        THROWS;
+        GC_TRIGGERS;
+        MODE_ANY;
+        INJECT_FAULT(COMPlusThrowOM());
+    }
+    CONTRACTL_END;
+
     // clean up comdata
     if (psb->m_pInteropInfo)
     {
@@ -1288,15 +1345,6 @@ void SyncBlockCache::DeleteSyncBlock(SyncBlock *psb)
     // Destruct the SyncBlock, but don't reclaim its memory.  (Overridden
     // operator delete).
     delete psb;
-
-    //synchronizer with the consumers,
-    // <TODO>@todo we don't really need a lock here, we can come up
-    // with some simple algo to avoid taking a lock </TODO>
-    {
-        SyncBlockCache::LockHolder lh(this);
-
-        DeleteSyncBlockMemory(psb);
-    }
 }
 
 
@@ -1322,6 +1370,32 @@ void    SyncBlockCache::DeleteSyncBlockMemory(SyncBlock *psb)
 
 }
 
+// returns a batch of destructed sync blocks to the free pool under a single
+// acquisition of the cache lock
+void    SyncBlockCache::DeleteSyncBlockMemoryBatch(SLink *pFirst, SLink *pLast, DWORD count)
+{
+    CONTRACTL
+    {
+        INSTANCE_CHECK;
+        NOTHROW;
+        GC_NOTRIGGER;
+        FORBID_FAULT;
+    }
+    CONTRACTL_END
+
+    _ASSERTE(pFirst != NULL && pLast != NULL && count != 0);
+
+    SyncBlockCache::LockHolder lh(this);
+
+    COUNTER_ONLY(GetPerfCounters().m_GC.cSinkBlocks -= count);
+
+    m_ActiveCount -= count;
+    m_FreeCount += count;
+
+    pLast->m_pNext = m_FreeBlockList;
+    m_FreeBlockList = pFirst;
+}
+
 // free a used sync block
 void SyncBlockCache::GCDeleteSyncBlock(SyncBlock *psb)
 {
@@ -1459,7 +1533,7 @@ void SyncBlockCache::GCWeakPtrScan(HANDLESCANPROC scanProc, LPARAM lp1, LPARAM l
                     {
                         (*scanProc) (keyv, NULL, lp1, lp2);
                         SyncBlock   *pSB = syncTableShadow[nb].m_SyncBlock;
-                        if (*keyv != 0 && (!pSB || !pSB->IsIDisposable()))
+                        if (*keyv != 0 && (!pSB || !pSB->IsDeflatable()))
                         {
                             if (syncTableShadow[nb].m_Object != SyncTableEntry::GetSyncTableEntry()[nb].m_Object)
                                 DebugBreak ();
@@ -1564,7 +1638,7 @@ BOOL SyncBlockCache::GCWeakPtrScanElement (int nb, HANDLESCANPROC scanProc, LPAR
 
         (*scanProc) (keyv, NULL, lp1, lp2);
         SyncBlock   *pSB = SyncTableEntry::GetSyncTableEntry()[nb].m_SyncBlock;
-        if ((*keyv == 0 ) || (pSB && pSB->IsIDisposable()))
+        if ((*keyv == 0 ) || (pSB && pSB->IsDeflatable()))
         {
 #ifdef VERIFY_HEAP
             if (g_pConfig->GetHeapVerifyLevel () & EEConfig::HEAPVERIFY_SYNCBLK)
@@ -1580,6 +1654,12 @@ BOOL SyncBlockCache::GCWeakPtrScanElement (int nb, HANDLESCANPROC scanProc, LPAR
                 //clean the object syncblock header
                 ((Object*)(*keyv))->GetHeader()->GCResetIndex();
             }
+            else if (pSB && !pSB->NeedsCleanup())
+            {
+                // Nothing but the monitor to release, recycle the block right
+                // away rather than waiting for the finalizer thread.
+                GCDeleteSyncBlock(pSB);
+            }
             else if (pSB)
             {
 
@@ -2818,10 +2898,10 @@ void AwareLock::AllocLockSemEvent()
     }
     CONTRACTL_END;
 
-    // Before we switch from cooperative, ensure that this syncblock won't disappear
-    // under us.  For something as expensive as an event, do it permanently rather
-    // than transiently.
-    SetPrecious();
+    // The caller keeps this syncblock from disappearing under us while it waits by
+    // bumping the transient precious count. The event does not pin the syncblock
+    // permanently: it is closed when the GC deflates an idle syncblock.
+    _ASSERTE(m_TransientPrecious > 0);
 
     GCX_PREEMP();
 
@@ -2879,6 +2959,7 @@ void AwareLock::Enter()
 
     // We get here if we successfully acquired the mutex.
     m_HoldingThread = pCurThread;
+    SetHoldingOSThreadId(pCurThread);
     m_Recursion = 1;
     pCurThread->IncLockCount();
 
@@ -2987,6 +3068,7 @@ retry:
 
     // We get here if we successfully acquired the mutex.
     m_HoldingThread = pCurThread;
+    SetHoldingOSThreadId(pCurThread);
     m_Recursion = 1;
     pCurThread->IncLockCount();
 
@@ -3084,6 +3166,7 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
 
     // We cannot allow the AwareLock to be cleaned up underneath us by the GC.
     IncrementTransientPrecious();
+    MarkContended();
 
     GCPROTECT_BEGIN(obj);
     {
@@ -3095,6 +3178,9 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
 
         pCurThread->EnablePreemptiveGC();
 
+        ULONGLONG waitStart = CLRGetTickCount64();
+        BOOL setStarving = FALSE;
+
         for (;;)
         {
             // We might be interrupted during the wait (Thread.Interrupt), so we need an
@@ -3161,6 +3247,11 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
 
                     // And signal the next waiter, else they'll wait forever.
                     m_SemEvent.Set();
+
+                    if (setStarving)
+                    {
+                        FastInterlockDecrement(&m_StarvingWaiters);
+                    }
                 }
             } EE_END_FINALLY;
 
@@ -3205,6 +3296,20 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
             {
                 break;
             }
+
+            // We were woken up but a spinning thread took the lock first. If this keeps
+            // happening, stop the spinners from barging in so that the lock gets handed
+            // off to the waiters.
+            if (!setStarving && CLRGetTickCount64() - waitStart >= AWARELOCK_STARVATION_THRESHOLD_MS)
+            {
+                FastInterlockIncrement(&m_StarvingWaiters);
+                setStarving = TRUE;
+            }
+        }
+
+        if (setStarving)
+        {
+            FastInterlockDecrement(&m_StarvingWaiters);
         }
 
         pCurThread->DisablePreemptiveGC();
@@ -3218,6 +3323,7 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
     }
 
     m_HoldingThread = pCurThread;
+    SetHoldingOSThreadId(pCurThread);
     m_Recursion = 1;
     pCurThread->IncLockCount();
 
@@ -3286,6 +3392,156 @@ inline void LogContention()
 #endif
 
 
+BOOL AwareLock::SpinTryEnter(Thread *pCurThread)
+{
+    CONTRACTL
+    {
+        INSTANCE_CHECK;
+        THROWS;
+        GC_TRIGGERS;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    LONG state = m_MonitorHeld.LoadWithoutBarrier();
+
+    if (state & 1)
+    {
+        // Recursive lock attempts go through the regular path.
+        if (m_HoldingThread == pCurThread)
+        {
+            return TryEnter();
+        }
+        return FALSE;
+    }
+
+    // The owner let go, so whoever takes the lock next starts a new hold.
+    if (m_ObservedOwner != NULL)
+    {
+        m_ObservedOwner = NULL;
+    }
+
+    // The lock is free. Take it even if there are waiters: handing it off to a
+    // waiter costs a context switch, during which nobody makes progress. The
+    // waiters are not lost since our release signals the event again, and
+    // waiters that keep losing the race count themselves in m_StarvingWaiters
+    // to stop us.
+    if (state != 0 && m_StarvingWaiters != 0)
+    {
+        return FALSE;
+    }
+
+    if (FastInterlockCompareExchange((LONG*)&m_MonitorHeld, (state | 1), state) != state)
+    {
+        return FALSE;
+    }
+
+    m_HoldingThread = pCurThread;
+    SetHoldingOSThreadId(pCurThread);
+    m_Recursion = 1;
+    pCurThread->IncLockCount();
+
+#if defined(_DEBUG) && defined(TRACK_SYNC)
+    {
+        // The best place to grab this is from the ECall frame
+        Frame   *pFrame = pCurThread->GetFrame();
+        int      caller = (pFrame && pFrame != FRAME_TOP ? (int) pFrame->GetReturnAddress() : -1);
+        pCurThread->m_pTrackSync->EnterSync(caller, this);
+    }
+#endif
+
+    return TRUE;
+}
+
+BOOL AwareLock::IsOwnerBlocked()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    Thread *pOwner = m_HoldingThread;
+
+    // The lock is being released or has just been acquired.
+    if (pOwner == NULL)
+    {
+        return FALSE;
+    }
+
+    // The lock is orphaned, nobody is going to release it.
+    if (pOwner == (Thread*) -1)
+    {
+        return TRUE;
+    }
+
+    // The owner's Thread may be deleted under us, so rather than asking it what
+    // it is doing, go by how long it has held the lock. The first contending
+    // thread to see a new owner stamps the time; these are racy writes that
+    // only steer the spinning heuristic.
+    DWORD now = GetTickCount();
+    if (m_ObservedOwner != pOwner)
+    {
+        m_ObservedOwnerTime = now;
+        m_ObservedOwner = pOwner;
+        return FALSE;
+    }
+
+    return now - m_ObservedOwnerTime >= AWARELOCK_OWNER_BLOCKED_MS;
+}
+
+DWORD AwareLock::GetHoldingOSThreadId()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    Thread *pOwner = m_HoldingThread;
+    DWORD osThreadId = m_HoldingOSThreadId;
+
+    if (pOwner == NULL || pOwner == (Thread*) -1 || m_HoldingOSThreadIdOwner != pOwner)
+    {
+        return 0;
+    }
+
+    return osThreadId;
+}
+
+void AwareLock::RecordContention(BOOL spinSucceeded, ULONGLONG waitMicroseconds, DWORD ownerOSThreadId)
+{
+    CONTRACTL
+    {
+        INSTANCE_CHECK;
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(OwnedByCurrentThread());
+
+    // Moving average of the spin outcomes, each new sample weighs 1/8.
+    LONG sample = spinSucceeded ? AWARELOCK_SPIN_SUCCESS_RATE_ONE : 0;
+    m_SpinSuccessAccumulator += sample - GetSpinSuccessRate();
+
+    m_ContentionCount++;
+    if (spinSucceeded)
+    {
+        m_SpinSuccessCount++;
+    }
+    m_TotalWaitMicroseconds += waitMicroseconds;
+
+    FireEtwContentionStats(this,
+                           ownerOSThreadId,
+                           waitMicroseconds,
+                           spinSucceeded ? 1 : 0,
+                           (USHORT)((GetSpinSuccessRate() * 100) / AWARELOCK_SPIN_SUCCESS_RATE_ONE),
+                           m_ContentionCount,
+                           m_SpinSuccessCount,
+                           m_TotalWaitMicroseconds,
+                           GetClrInstanceId());
+}
+
+void AwareLock::MarkContended()
+{
+    WRAPPER_NO_CONTRACT;
+
+    m_ContentionGCCount = GCHeap::GetGCHeap()->GetGcCount();
+}
 
 bool AwareLock::Contention(INT32 timeOut)
 {
@@ -3303,6 +3559,9 @@ bool AwareLock::Contention(INT32 timeOut)
     if (timeOut != (INT32)INFINITE)
         startTime = GetTickCount();
 
+    LARGE_INTEGER qpcStart;
+    BOOL canUseHighRes = QueryPerformanceCounter(&qpcStart);
+
     COUNTER_ONLY(GetPerfCounters().m_LocksAndThreads.cContention++);
 
 #ifndef FEATURE_CORECLR
@@ -3315,9 +3574,27 @@ bool AwareLock::Contention(INT32 timeOut)
     OBJECTREF    obj = GetOwningObject();
     bool    bEntered = false;
     bool   bKeepGoing = true;
+    BOOL   bSpinSucceeded = FALSE;
+
+    // Remember who we are contending with so that the owner shows up in the
+    // contention statistics.
+    DWORD ownerOSThreadId = GetHoldingOSThreadId();
+
+    // Scale the spin budget by how often spinning has paid off for this lock, so
+    // that locks held for long periods do not burn CPU in every contending thread.
+    // The rate only changes while the lock is held, a dirty read is fine here.
+    LONG spinSuccessRate = GetSpinSuccessRate();
+    DWORD dwMaximumDuration = g_SpinConstants.dwInitialDuration;
+    if (g_SpinConstants.dwMaximumDuration > g_SpinConstants.dwInitialDuration)
+    {
+        dwMaximumDuration += (DWORD)(((ULONGLONG)(g_SpinConstants.dwMaximumDuration - g_SpinConstants.dwInitialDuration) * spinSuccessRate)
+                                     / AWARELOCK_SPIN_SUCCESS_RATE_ONE);
+    }
+    DWORD dwRepetitions = max((DWORD)1, (DWORD)(((ULONGLONG)g_SpinConstants.dwRepetitions * spinSuccessRate) / AWARELOCK_SPIN_SUCCESS_RATE_ONE));
 
     // We cannot allow the AwareLock to be cleaned up underneath us by the GC.
     IncrementTransientPrecious();
+    MarkContended();
 
     GCPROTECT_BEGIN(obj);
     {
@@ -3326,15 +3603,16 @@ bool AwareLock::Contention(INT32 timeOut)
         // Try spinning and yielding before eventually blocking.
         // The limit of 10 is largely arbitrary - feel free to tune if you have evidence
         // you're making things better  
-        for (DWORD iter = 0; iter < g_SpinConstants.dwRepetitions && bKeepGoing; iter++)
+        for (DWORD iter = 0; iter < dwRepetitions && bKeepGoing; iter++)
         {
             DWORD i = g_SpinConstants.dwInitialDuration;
 
             do
             {
-                if (TryEnter())
+                if (SpinTryEnter(pCurThread))
                 {
                     bEntered = true;
+                    bSpinSucceeded = TRUE;
                     goto entered;
                 }
 
@@ -3349,6 +3627,14 @@ bool AwareLock::Contention(INT32 timeOut)
                     bKeepGoing = false;
                     break;
                 }
+
+                // There is no point in spinning while the owner is blocked, and spinning
+                // while a waiter is starving only delays the hand-off to that waiter.
+                if (m_StarvingWaiters != 0 || IsOwnerBlocked())
+                {
+                    bKeepGoing = false;
+                    break;
+                }
                 
                 // Spin for i iterations, and make sure to never go more than 20000 iterations between
                 // checking if we should SwitchToThread
@@ -3370,19 +3656,12 @@ bool AwareLock::Contention(INT32 timeOut)
                         YieldProcessor();           // indicate to the processor that we are spining
                     }
 
-                    // TryEnter will not take the lock if it has waiters.  This means we should not spin
-                    // for long periods without giving the waiters a chance to run, since we won't
-                    // make progress until they run and they may be waiting for our CPU.  So once
-                    // we're spinning >20000 iterations, check every 20000 iterations if there are
-                    // waiters and if so call SwitchToThread.
+                    // A woken waiter needs to run to take the lock, and it may be waiting for
+                    // our CPU.  So once we're spinning >20000 iterations, check every 20000
+                    // iterations if there are waiters and if so call SwitchToThread.
                     //
                     // Since this only affects the spinning heuristic, calling HasWaiters now
-                    // and getting a dirty read is fine.  Note that it is important that TryEnter 
-                    // not take the lock because we could easily starve waiting threads.  
-                    // They make only one attempt before going back to sleep, and spinners on 
-                    // other CPUs would likely get the lock.  We could fix this by allowing a 
-                    // woken thread to become a spinner again, at which point there are no 
-                    // starvation concerns and TryEnter can take the lock.
+                    // and getting a dirty read is fine.
                     if (remainingDelay > 0 && HasWaiters())
                     {
                         __SwitchToThread(0, CALLER_LIMITS_SPINNING);
@@ -3392,7 +3671,7 @@ bool AwareLock::Contention(INT32 timeOut)
                 // exponential backoff: wait a factor longer in the next iteration
                 i *= g_SpinConstants.dwBackoffFactor;
             }
-            while (i < g_SpinConstants.dwMaximumDuration);
+            while (i < dwMaximumDuration);
 
             {
                 GCX_COOP();
@@ -3413,6 +3692,14 @@ entered: ;
         Enter();
         bEntered = TRUE;
     }
+    if (bEntered)
+    {
+        ULONGLONG waitMicroseconds = 0;
+        if (canUseHighRes)
+            waitMicroseconds = CLRGetElapsedMicroseconds(qpcStart);
+
+        RecordContention(bSpinSucceeded, waitMicroseconds, ownerOSThreadId);
+    }
 #ifndef FEATURE_CORECLR
     FireEtwContentionStop(ETW::ContentionLog::ContentionStructs::ManagedContention, GetClrInstanceId());
 #endif // !FEATURE_CORECLR
@@ -3604,6 +3891,41 @@ void SyncBlock::PulseAll()
         pWaitEventLink->m_EventWait->Set();
 }
 
+BOOL SyncBlock::IsDeflatable()
+{
+    WRAPPER_NO_CONTRACT;
+
+    if (!IsIDisposable())
+    {
+        return FALSE;
+    }
+
+    // A lock that was contended since the previous GC is likely to be contended
+    // again, keep it inflated rather than recreating it (and its event) shortly.
+    return (GCHeap::GetGCHeap()->GetGcCount() - m_Monitor.m_ContentionGCCount) > 1;
+}
+
+BOOL SyncBlock::NeedsCleanup()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (m_pInteropInfo != NULL || m_Link.m_pNext != NULL)
+    {
+        return TRUE;
+    }
+
+#ifdef EnC_SUPPORTED
+    if (m_pEnCInfo != NULL)
+    {
+        return TRUE;
+    }
+#endif // EnC_SUPPORTED
+
+    // Closing an event that takes part in deadlock detection may switch to
+    // preemptive mode.
+    return m_Monitor.m_SemEvent.IsInDeadlockDetection();
+}
+
 bool SyncBlock::SetInteropInfo(InteropSyncBlockInfo* pInteropInfo)
 {
     WRAPPER_NO_CONTRACT;
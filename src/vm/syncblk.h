@@ -149,6 +149,24 @@ typedef DPTR(EnCSyncBlockInfo) PTR_EnCSyncBlockInfo;
 // Spin for about 1000 cycles before waiting longer.
 #define     BIT_SBLK_SPIN_COUNT         1000
 
+// AwareLock keeps a moving average of how often spinning acquires the lock, in
+// fixed point with AWARELOCK_SPIN_SUCCESS_RATE_ONE meaning "always".  The spin
+// budget of a contended acquire is scaled by this rate.  The average is kept
+// shifted left by AWARELOCK_SPIN_SUCCESS_RATE_SHIFT, so that each sample weighs
+// 1/8 without the rounding of the division getting it stuck short of 0 or ONE.
+#define     AWARELOCK_SPIN_SUCCESS_RATE_ONE     1024
+#define     AWARELOCK_SPIN_SUCCESS_RATE_SHIFT   3
+
+// A lock that one owner has held for this long, as seen by the threads
+// contending for it, is not in a short critical section: its owner is most
+// likely blocked, and spinning for it is wasted.
+#define     AWARELOCK_OWNER_BLOCKED_MS          2
+
+// A waiter that has been woken up and lost the lock to spinning threads for this
+// long asks the spinners to stop barging in, so that the lock is handed off to
+// the waiters.
+#define     AWARELOCK_STARVATION_THRESHOLD_MS   100
+
 // The GC is highly dependent on SIZE_OF_OBJHEADER being exactly the sizeof(ObjHeader)
 // We define this macro so that the preprocessor can calculate padding structures.
 #ifdef _WIN64
@@ -200,6 +218,35 @@ public:
 
     CLREvent        m_SemEvent;
 
+    // Adaptive spinning state. The fields that follow are only written by the
+    // thread holding the lock, except for m_StarvingWaiters and the observed
+    // owner, which are hints. They are kept after the fields above since the
+    // assembly helpers depend on the offsets of m_MonitorHeld, m_Recursion and
+    // m_HoldingThread.
+    LONG            m_SpinSuccessAccumulator;   // spin success rate << AWARELOCK_SPIN_SUCCESS_RATE_SHIFT
+    Volatile<LONG>  m_StarvingWaiters;
+
+    // The owner as first seen by a contending thread, and when. Spinners read
+    // these instead of the owner's Thread, which may be gone by the time they
+    // look at it.
+    Thread*         m_ObservedOwner;
+    DWORD           m_ObservedOwnerTime;
+
+    // The owner's OS thread id, for the contention statistics. The assembly
+    // helpers only set m_HoldingThread, so the id is only valid while
+    // m_HoldingOSThreadIdOwner matches it.
+    DWORD           m_HoldingOSThreadId;
+    Thread*         m_HoldingOSThreadIdOwner;
+
+    // Contention statistics, reported by the ContentionStats event.
+    DWORD           m_ContentionCount;
+    DWORD           m_SpinSuccessCount;
+    ULONGLONG       m_TotalWaitMicroseconds;
+
+    // GC count at the last contention on this lock. The GC only deflates the
+    // syncblock of a lock that has not been contended since the previous GC.
+    unsigned        m_ContentionGCCount;
+
     // Only SyncBlocks can create AwareLocks.  Hence this private constructor.
     AwareLock(DWORD indx)
         : m_MonitorHeld(0),
@@ -209,7 +256,17 @@ public:
           m_HoldingThread(NULL),
 #endif // DACCESS_COMPILE          
           m_TransientPrecious(0),
-          m_dwSyncIndex(indx)
+          m_dwSyncIndex(indx),
+          m_SpinSuccessAccumulator(AWARELOCK_SPIN_SUCCESS_RATE_ONE << AWARELOCK_SPIN_SUCCESS_RATE_SHIFT),
+          m_StarvingWaiters(0),
+          m_ObservedOwner(NULL),
+          m_ObservedOwnerTime(0),
+          m_HoldingOSThreadId(0),
+          m_HoldingOSThreadIdOwner(NULL),
+          m_ContentionCount(0),
+          m_SpinSuccessCount(0),
+          m_TotalWaitMicroseconds(0),
+          m_ContentionGCCount(0)
     {
         LIMITED_METHOD_CONTRACT;
     }
@@ -238,6 +295,30 @@ public:
     }
 #endif // defined(ENABLE_CONTRACTS_IMPL)
 
+    // Attempt made by a spinning thread to acquire the lock. Unlike TryEnter it
+    // barges in ahead of the waiters, unless any of them is starving.
+    BOOL    SpinTryEnter(Thread *pCurThread);
+
+    // Is the thread holding the lock unlikely to release it soon?
+    BOOL    IsOwnerBlocked();
+
+    inline void SetHoldingOSThreadId(Thread *pCurThread);
+    DWORD   GetHoldingOSThreadId();
+
+    LONG    GetSpinSuccessRate()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return m_SpinSuccessAccumulator >> AWARELOCK_SPIN_SUCCESS_RATE_SHIFT;
+    }
+
+    // Update the spin success rate and the contention statistics once a
+    // contended acquire has completed. Must be called with the lock held.
+    void    RecordContention(BOOL spinSucceeded, ULONGLONG waitMicroseconds, DWORD ownerOSThreadId);
+
+    // Note that the lock is contended, which keeps its syncblock inflated
+    // through the next GC.
+    void    MarkContended();
+
 public:
     enum EnterHelperResult {
         EnterHelperResult_Entered,
@@ -641,6 +722,15 @@ class SyncBlock
                 m_Monitor.m_TransientPrecious == 0);
     }
 
+    // True if the GC should deflate this syncblock of a live object back into
+    // the object header: it is disposable and its monitor has been idle since
+    // the previous GC, so it is unlikely to be inflated again right away.
+    BOOL IsDeflatable();
+
+    // True if releasing the syncblock of a dead object involves work that
+    // cannot be done during a GC, and so must be left to the finalizer thread.
+    BOOL NeedsCleanup();
+
     // Gets the InteropInfo block, creates a new one if none is present.
     InteropSyncBlockInfo* GetInteropInfo()
     {
@@ -1005,6 +1095,12 @@ class SyncBlockCache
     // returns the sync block memory to the free pool but does not destruct sync block (must own cache lock already)
     void    DeleteSyncBlockMemory(SyncBlock *sb);
 
+    // destructs a sync block and releases the data attached to it, but does not free its memory
+    void    DestructSyncBlock(SyncBlock *sb);
+
+    // returns a batch of destructed sync blocks, linked through m_Link, to the free pool
+    void    DeleteSyncBlockMemoryBatch(SLink *pFirst, SLink *pLast, DWORD count);
+
     // return sync block to cache or delete, called from GC
     void    GCDeleteSyncBlock(SyncBlock *sb);
 
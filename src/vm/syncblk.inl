@@ -9,6 +9,14 @@
 
 #ifndef DACCESS_COMPILE
 
+inline void AwareLock::SetHoldingOSThreadId(Thread *pCurThread)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    m_HoldingOSThreadId = pCurThread->GetOSThreadId();
+    m_HoldingOSThreadIdOwner = pCurThread;
+}
+
 FORCEINLINE AwareLock::EnterHelperResult AwareLock::EnterHelper(Thread* pCurThread)
 {
     CONTRACTL {
@@ -27,6 +35,7 @@ FORCEINLINE AwareLock::EnterHelperResult AwareLock::EnterHelper(Thread* pCurThre
             if (InterlockedCompareExchangeAcquire((LONG*)&m_MonitorHeld, 1, 0) == 0)
             {
                 m_HoldingThread = pCurThread;
+                SetHoldingOSThreadId(pCurThread);
                 m_Recursion = 1;
                 pCurThread->IncLockCount();
                 return AwareLock::EnterHelperResult_Entered;
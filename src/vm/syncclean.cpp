@@ -8,6 +8,7 @@
 
 #include "syncclean.hpp"
 #include "virtualcallstub.h"
+#include "castcache.h"
 #include "threadsuspend.h"
 
 VolatilePtr<Bucket> SyncClean::m_HashMap = NULL;
@@ -101,4 +102,5 @@ void SyncClean::CleanUp ()
 
     // Give others we want to reclaim during the GC sync point a chance to do it
     VirtualCallStubManager::ReclaimAll();
+    CastCache::ReclaimAll();
 }
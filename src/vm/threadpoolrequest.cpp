@@ -366,6 +366,8 @@ void UnManagedPerAppDomainTPCount::SetAppDomainRequestsActive()
         LONG prevCount = FastInterlockCompareExchange(&m_outstandingThreadRequestCount, count+1, count);
         if (prevCount == count)
         {
+            ThreadpoolMgr::RecordThreadRequest();
+
             if (!CLRThreadpoolHosted())
             {
                 ThreadpoolMgr::MaybeAddWorkingWorker();
@@ -422,17 +424,30 @@ void UnManagedPerAppDomainTPCount::QueueUnmanagedWorkRequest(LPTHREAD_START_ROUT
     _ASSERTE(pWorkRequest != NULL);
     PREFIX_ASSUME(pWorkRequest != NULL);
 
-    m_lock.Init(LOCK_TYPE_DEFAULT);
-    
+    if (ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_Context, ThreadPoolEnqueue) && 
+        !ThreadpoolMgr::AreEtwQueueEventsSpeciallyHandled(function))
+        FireEtwThreadPoolEnqueue(pWorkRequest, GetClrInstanceId());
+
+    //Count the request before it becomes visible, so that a worker that
+    //dequeues it never sees the count go below zero.
+    FastInterlockIncrement(&m_NumRequests);
+
+    //A worker thread queues to its own queue without taking any lock; it
+    //will pop the request itself unless another worker steals it first.
+    //Everybody else, and a worker whose queue could not grow, goes through
+    //the global queue.
+    if (ThreadpoolMgr::PushLocalWorkRequest(pWorkRequest))
     {
+        pWorkRequest.SuppressRelease();
+    }
+    else
+    {
+        m_lock.Init(LOCK_TYPE_DEFAULT);
+
         SpinLock::Holder slh(&m_lock);
 
-        if (ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_Context, ThreadPoolEnqueue) && 
-            !ThreadpoolMgr::AreEtwQueueEventsSpeciallyHandled(function))
-            FireEtwThreadPoolEnqueue(pWorkRequest, GetClrInstanceId());
         ThreadpoolMgr::EnqueueWorkRequest(pWorkRequest);
         pWorkRequest.SuppressRelease();
-        m_NumRequests++;
     }
 
     SetAppDomainRequestsActive();
@@ -451,19 +466,54 @@ PVOID UnManagedPerAppDomainTPCount::DeQueueUnManagedWorkRequest(bool* lastOne)
 
     *lastOne = true;
 
-    WorkRequest * pWorkRequest = ThreadpoolMgr::DequeueWorkRequest();
+    //Our own requests first, newest first, then the global queue, then the
+    //oldest requests of the other workers.
+    WorkRequest * pWorkRequest = ThreadpoolMgr::PopLocalWorkRequest();
 
-    if (pWorkRequest) 
+    if (pWorkRequest == NULL)
     {
-        m_NumRequests--;
+        m_lock.Init(LOCK_TYPE_DEFAULT);
+
+        SpinLock::Holder slh(&m_lock);
+
+        pWorkRequest = ThreadpoolMgr::DequeueWorkRequest();
+    }
+
+    if (pWorkRequest == NULL)
+        pWorkRequest = ThreadpoolMgr::StealWorkRequest();
 
-        if(m_NumRequests > 0) 
+    if (pWorkRequest) 
+    {
+        if (FastInterlockDecrement(&m_NumRequests) > 0) 
             *lastOne = false;
     }
 
     return (PVOID) pWorkRequest;
 }
 
+//---------------------------------------------------------------------------
+//Moves a request that is already counted, such as one left in the local
+//queue of an exiting worker, to the global queue.
+//
+void UnManagedPerAppDomainTPCount::RequeueUnmanagedWorkRequest(WorkRequest* pWorkRequest)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+#ifndef DACCESS_COMPILE
+    m_lock.Init(LOCK_TYPE_DEFAULT);
+
+    SpinLock::Holder slh(&m_lock);
+
+    ThreadpoolMgr::EnqueueWorkRequest(pWorkRequest);
+#endif //DACCESS_COMPILE
+}
+
 //---------------------------------------------------------------------------
 //DispatchWorkItem manages dispatching of unmanaged work requests. It keeps
 //processing unmanaged requests for the "Quanta". Essentially this function is 
@@ -475,7 +525,7 @@ void UnManagedPerAppDomainTPCount::DispatchWorkItem(bool* foundWork, bool* wasNo
     *foundWork = false;
     *wasNotRecalled = true;
 
-    bool enableWorkerTracking = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_EnableWorkerTracking) ? true : false;
+    bool enableWorkerTracking = ThreadpoolMgr::IsWorkerTrackingEnabled();
 
     DWORD startTime;
     DWORD endTime;
@@ -497,11 +547,7 @@ void UnManagedPerAppDomainTPCount::DispatchWorkItem(bool* foundWork, bool* wasNo
 
     while (*wasNotRecalled) 
     {
-        m_lock.Init(LOCK_TYPE_DEFAULT);
-        {
-            SpinLock::Holder slh(&m_lock);
-            pWorkRequest = (WorkRequest*) DeQueueUnManagedWorkRequest(&lastOne);
-        }
+        pWorkRequest = (WorkRequest*) DeQueueUnManagedWorkRequest(&lastOne);
 
         if (NULL == pWorkRequest)
             break;
@@ -606,6 +652,8 @@ void ManagedPerAppDomainTPCount::SetAppDomainRequestsActive()
             LONG prev = FastInterlockCompareExchange(&m_numRequestsPending, count+1, count);
             if (prev == count)
             {
+                ThreadpoolMgr::RecordThreadRequest();
+
                 if (!CLRThreadpoolHosted())
                 {
                     ThreadpoolMgr::MaybeAddWorkingWorker();
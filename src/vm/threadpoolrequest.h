@@ -24,6 +24,8 @@
 #define TP_QUANTUM 2
 #define UNUSED_THREADPOOL_INDEX (DWORD)-1
 
+struct WorkRequest;
+
 //--------------------------------------------------------------------------
 //IPerAppDomainTPCount is an interface for implementing per-appdomain thread 
 //pool state. It's implementation should include logic to maintain work-counts,
@@ -238,6 +240,7 @@ public:
 
     void QueueUnmanagedWorkRequest(LPTHREAD_START_ROUTINE  function, PVOID context);
     PVOID DeQueueUnManagedWorkRequest(bool* lastOne);
+    void RequeueUnmanagedWorkRequest(WorkRequest* pWorkRequest);
 
     void DispatchWorkItem(bool* foundWork, bool* wasNotRecalled);
 
@@ -273,7 +276,7 @@ public:
     }
 
 private:
-    ULONG m_NumRequests;
+    Volatile<LONG> m_NumRequests;
     Volatile<LONG> m_outstandingThreadRequestCount;
     SpinLock m_lock;
 };
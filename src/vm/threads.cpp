@@ -37,6 +37,7 @@
 #include "comutilnative.h"
 #include "finalizerthread.h"
 #include "threadsuspend.h"
+#include "threadstatics.h"
 
 #ifdef FEATURE_FUSION
 #include "fusion.h"
@@ -342,6 +343,10 @@ BOOL SetThread(Thread* t)
 {
 	LIMITED_METHOD_CONTRACT
 
+    // The cached thread static bases belong to the previous Thread
+    if (gCurrentThreadInfo.m_pThread != t)
+        ThreadStatics::FlushCache();
+
     gCurrentThreadInfo.m_pThread = t;
     return TRUE;
 }
@@ -350,6 +355,11 @@ BOOL SetAppDomain(AppDomain* ad)
 {
 	LIMITED_METHOD_CONTRACT
 
+    // Thread statics are per AppDomain, and the module IDs of domain neutral
+    // modules that key the cache are the same in every AppDomain
+    if (gCurrentThreadInfo.m_pAppDomain != ad)
+        ThreadStatics::FlushCache();
+
     gCurrentThreadInfo.m_pAppDomain = ad;
     return TRUE;
 }
@@ -1933,6 +1943,9 @@ Thread::Thread()
 #endif
 
     m_dwForbidSuspendThread = 0;
+    m_dwSuspendStallReason = 0;
+    m_ThreadStoreIndex = 0;
+    m_suspendStallIP = NULL;
 
     // Initialize lock state
     m_pHead = &m_embeddedEntry;
@@ -4109,6 +4122,7 @@ DWORD Thread::DoAppropriateWait(int countHandles, HANDLE *handles, BOOL waitAll,
         DWORD millis;
         WaitMode mode;
         DWORD dwRet;
+        bool reportBlocked;
     } param;
     param.pThis = this;
     param.countHandles = countHandles;
@@ -4118,10 +4132,18 @@ DWORD Thread::DoAppropriateWait(int countHandles, HANDLE *handles, BOOL waitAll,
     param.mode = mode;
     param.dwRet = (DWORD) -1;
 
+    // Let the thread pool's latency controller know that this worker is not running.
+    param.reportBlocked = ThreadpoolMgr::IsBlockedWorkerTrackingEnabled() && (m_State & TS_TPWorkerThread) != 0;
+    if (param.reportBlocked)
+        ThreadpoolMgr::ReportThreadBlocked(true);
+
     EE_TRY_FOR_FINALLY(Param *, pParam, &param) {
         pParam->dwRet = pParam->pThis->DoAppropriateWaitWorker(pParam->countHandles, pParam->handles, pParam->waitAll, pParam->millis, pParam->mode);
     }
     EE_FINALLY {
+        if (param.reportBlocked)
+            ThreadpoolMgr::ReportThreadBlocked(false);
+
         if (syncState) {
             if (!GOT_EXCEPTION() &&
                 param.dwRet >= WAIT_OBJECT_0 && param.dwRet < (DWORD)(WAIT_OBJECT_0 + countHandles)) {
@@ -4157,6 +4179,7 @@ DWORD Thread::DoAppropriateWait(AppropriateWaitFunc func, void *args,
         DWORD millis;
         WaitMode mode;
         DWORD dwRet;
+        bool reportBlocked;
     } param;
     param.pThis = this;
     param.func = func;
@@ -4165,10 +4188,18 @@ DWORD Thread::DoAppropriateWait(AppropriateWaitFunc func, void *args,
     param.mode = mode;
     param.dwRet = (DWORD) -1;
 
+    // Let the thread pool's latency controller know that this worker is not running.
+    param.reportBlocked = ThreadpoolMgr::IsBlockedWorkerTrackingEnabled() && (m_State & TS_TPWorkerThread) != 0;
+    if (param.reportBlocked)
+        ThreadpoolMgr::ReportThreadBlocked(true);
+
     EE_TRY_FOR_FINALLY(Param *, pParam, &param) {
         pParam->dwRet = pParam->pThis->DoAppropriateWaitWorker(pParam->func, pParam->args, pParam->millis, pParam->mode);
     }
     EE_FINALLY {
+        if (param.reportBlocked)
+            ThreadpoolMgr::ReportThreadBlocked(false);
+
         if (syncState) {
             if (!GOT_EXCEPTION() && WAIT_OBJECT_0 == param.dwRet) {
                 // This thread has been removed from syncblk waiting list by the signalling thread
@@ -6189,7 +6220,9 @@ ThreadStore::ThreadStore()
              m_PendingThreadCount(0),
              m_DeadThreadCount(0),
              m_GuidCreated(FALSE),
-             m_HoldingThread(0)
+             m_HoldingThread(0),
+             m_pThreadArray(NULL),
+             m_ThreadArrayHoles(0)
 {
     CONTRACTL {
         THROWS;
@@ -6217,6 +6250,8 @@ void ThreadStore::InitThreadStore()
     ThreadSuspend::g_pGCSuspendEvent = new CLREvent();
     ThreadSuspend::g_pGCSuspendEvent->CreateManualEvent(FALSE);
 
+    ThreadSuspend::Initialize();
+
 #ifdef _DEBUG
     Thread::MaxThreadRecord = EEConfig::GetConfigDWORD_DontUse_(CLRConfig::INTERNAL_MaxThreadRecord,Thread::MaxThreadRecord);
     Thread::MaxStackDepth = EEConfig::GetConfigDWORD_DontUse_(CLRConfig::INTERNAL_MaxStackDepth,Thread::MaxStackDepth);
@@ -6276,7 +6311,7 @@ void ThreadStore::UnlockThreadStore()
 void ThreadStore::AddThread(Thread *newThread, BOOL bRequiresTSL)
 {
     CONTRACTL {
-        NOTHROW;
+        THROWS;
         if (GetThread()) {GC_TRIGGERS;} else {DISABLED(GC_NOTRIGGER);}
     }
     CONTRACTL_END;
@@ -6289,8 +6324,23 @@ void ThreadStore::AddThread(Thread *newThread, BOOL bRequiresTSL)
         TSLockHolder.Acquire();
     }
 
+    // Make room in the thread array first, the only step that can fail.
+    ThreadArray *pArray = s_pThreadStore->m_pThreadArray;
+    if (pArray == NULL ||
+        pArray->m_count == pArray->m_capacity ||
+        s_pThreadStore->m_ThreadArrayHoles > pArray->m_count / 2)
+    {
+        s_pThreadStore->ReallocateThreadArray();
+        pArray = s_pThreadStore->m_pThreadArray;
+    }
+
     s_pThreadStore->m_ThreadList.InsertTail(newThread);
 
+    DWORD index = pArray->m_count;
+    newThread->m_ThreadStoreIndex = index;
+    pArray->m_threads[index] = newThread;
+    pArray->m_count = index + 1;
+
     s_pThreadStore->m_ThreadCount++;
     if (s_pThreadStore->m_MaxThreadCount < s_pThreadStore->m_ThreadCount)
         s_pThreadStore->m_MaxThreadCount = s_pThreadStore->m_ThreadCount;
@@ -6356,6 +6406,11 @@ BOOL ThreadStore::RemoveThread(Thread *target)
 
     if (found)
     {
+        ThreadArray *pArray = s_pThreadStore->m_pThreadArray;
+        _ASSERTE(pArray->m_threads[target->m_ThreadStoreIndex] == target);
+        pArray->m_threads[target->m_ThreadStoreIndex] = NULL;
+        s_pThreadStore->m_ThreadArrayHoles++;
+
         target->ResetThreadStateNC(Thread::TSNC_ExistInThreadStore);
 
         s_pThreadStore->m_ThreadCount--;
@@ -6450,6 +6505,90 @@ void ThreadStore::TransferStartedThread(Thread *thread, BOOL bRequiresTSL)
     CheckForEEShutdown();
 }
 
+// Replaces the thread array with a larger one without holes.  The ThreadStore
+// lock must be held.
+void ThreadStore::ReallocateThreadArray()
+{
+    CONTRACTL {
+        THROWS;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    const DWORD MinThreadArrayCapacity = 16;
+
+    ThreadArray *pOldArray = m_pThreadArray;
+    DWORD capacity = max(MinThreadArrayCapacity, ((DWORD)m_ThreadCount + 1) * 2);
+
+    S_SIZE_T cbArray = S_SIZE_T(offsetof(ThreadArray, m_threads)) + S_SIZE_T(capacity) * S_SIZE_T(sizeof(Thread *));
+    if (cbArray.IsOverflow())
+        ThrowOutOfMemory();
+
+    ThreadArray *pNewArray = (ThreadArray *)new BYTE[cbArray.Value()];
+    pNewArray->m_capacity = capacity;
+
+    DWORD count = 0;
+    if (pOldArray != NULL)
+    {
+        for (DWORD i = 0; i < pOldArray->m_count; i++)
+        {
+            Thread *pThread = pOldArray->m_threads[i];
+            if (pThread != NULL)
+            {
+                pThread->m_ThreadStoreIndex = count;
+                pNewArray->m_threads[count++] = pThread;
+            }
+        }
+    }
+    _ASSERTE(count == (DWORD)m_ThreadCount);
+    pNewArray->m_count = count;
+
+    m_pThreadArray = pNewArray;
+    m_ThreadArrayHoles = 0;
+
+    // Nobody can be walking the old array since we hold the lock.
+    delete [] (BYTE *)pOldArray;
+}
+
+ThreadStore::ThreadIterator::ThreadIterator(ULONG mask, ULONG bits)
+    : m_index(0),
+      m_mask(mask),
+      m_bits(bits)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        SO_TOLERANT;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE((s_pThreadStore->m_Crst.GetEnterCount() > 0) || IsAtProcessExit());
+
+    m_pArray = s_pThreadStore->m_pThreadArray;
+}
+
+Thread *ThreadStore::ThreadIterator::Next()
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        SO_TOLERANT;
+    }
+    CONTRACTL_END;
+
+    if (m_pArray == NULL)
+        return NULL;
+
+    DWORD count = m_pArray->m_count;
+    while (m_index < count)
+    {
+        Thread *pThread = m_pArray->m_threads[m_index++];
+        if (pThread != NULL && (pThread->m_State & m_mask) == m_bits)
+            return pThread;
+    }
+    return NULL;
+}
+
 #endif // #ifndef DACCESS_COMPILE
 
 
@@ -6468,8 +6607,23 @@ Thread *ThreadStore::GetAllThreadList(Thread *cursor, ULONG mask, ULONG bits)
 
 #ifndef DACCESS_COMPILE
     _ASSERTE((s_pThreadStore->m_Crst.GetEnterCount() > 0) || IsAtProcessExit());
-#endif
 
+    // The array holds the same threads in the same order as the list, and is
+    // cheaper to walk.  The debugger reads the list out of process.
+    ThreadArray *pArray = s_pThreadStore->m_pThreadArray;
+    if (pArray == NULL)
+        return NULL;
+
+    for (DWORD index = (cursor != NULL) ? cursor->m_ThreadStoreIndex + 1 : 0;
+         index < pArray->m_count;
+         index++)
+    {
+        Thread *pThread = pArray->m_threads[index];
+        if (pThread != NULL && (pThread->m_State & mask) == bits)
+            return pThread;
+    }
+    return NULL;
+#else // !DACCESS_COMPILE
     while (TRUE)
     {
         cursor = (cursor
@@ -6483,6 +6637,7 @@ Thread *ThreadStore::GetAllThreadList(Thread *cursor, ULONG mask, ULONG bits)
             return cursor;
     }
     return NULL;
+#endif // !DACCESS_COMPILE
 }
 
 // Iterate over the threads that have been started
@@ -10678,6 +10833,10 @@ void Thread::DeleteThreadStaticData()
     }
     m_pThreadLocalBlock = NULL;
     m_TLBTableSize = 0;
+
+    // Other threads may be freeing our data, so the cache of the current thread
+    // is not the only one that may point into it
+    ThreadStatics::InvalidateCaches();
 }
 
 //+----------------------------------------------------------------------------
@@ -10717,6 +10876,9 @@ void Thread::DeleteThreadStaticData(AppDomain *pDomain)
         pTLB->FreeTable();
 
         delete pTLB;
+
+        // This runs on the thread unloading the AppDomain, for every thread
+        ThreadStatics::InvalidateCaches();
     }
 }
 
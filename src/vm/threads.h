@@ -3635,6 +3635,10 @@ public:
     // can't figure out how to expand the ThreadList template type without
     // making m_Link public.
     SLink       m_Link;
+
+    // Position of the thread in the ThreadStore's thread array. It only changes
+    // while the ThreadStore lock is held.
+    DWORD       m_ThreadStoreIndex;
     
     // For N/Direct calls with the "setLastError" bit, this field stores
     // the errorcode from that call.
@@ -3707,6 +3711,29 @@ private:
 #endif // HAVE_GCCOVER && USE_REDIRECT_FOR_GCSTRESS
 #endif // FEATURE_HIJACK
 
+#if defined(FEATURE_ACTIVATION_INJECTION) && !defined(DACCESS_COMPILE)
+private:
+    // Interrupts the thread with an activation so that, if it is running managed
+    // code at a GC safe point, it rendezvous with the pending suspension right
+    // away instead of at its next poll. Returns FALSE if the thread could not
+    // be interrupted.
+    BOOL InjectGcSuspension();
+#endif // FEATURE_ACTIVATION_INJECTION && !DACCESS_COMPILE
+
+public:
+    // Records where the thread was executing when the runtime suspension last
+    // found it in cooperative mode, as one of ThreadSuspend::STALL_REASON.
+    void NoteSuspendStall(DWORD dwReason, PCODE ip)
+    {
+        LIMITED_METHOD_CONTRACT;
+        m_dwSuspendStallReason = dwReason;
+        m_suspendStallIP = ip;
+    }
+
+private:
+    DWORD m_dwSuspendStallReason;
+    PCODE m_suspendStallIP;
+
 public:
 
 #ifndef DACCESS_COMPILE
@@ -5667,6 +5694,8 @@ class ThreadStore
     friend Thread* __stdcall DacGetThread(ULONG32 osThreadID);
 #endif
 
+    struct ThreadArray;
+
 public:
 
     ThreadStore();
@@ -5692,6 +5721,26 @@ public:
     static Thread *GetAllThreadList(Thread *Prev, ULONG mask, ULONG bits);
     static Thread *GetThreadList(Thread *Prev);
 
+#ifndef DACCESS_COMPILE
+    // Enumerates the threads in the store by walking the thread array, which is
+    // cheaper than chasing m_Link through every Thread. Like GetThreadList, it
+    // relies on the ThreadStore lock being held, by the caller or, during a GC, by
+    // the thread that suspended the runtime.
+    class ThreadIterator
+    {
+    public:
+        ThreadIterator(ULONG mask = (Thread::TS_Unstarted | Thread::TS_Dead), ULONG bits = 0);
+
+        Thread *Next();
+
+    private:
+        ThreadArray *m_pArray;
+        DWORD        m_index;
+        ULONG        m_mask;
+        ULONG        m_bits;
+    };
+#endif // !DACCESS_COMPILE
+
     // Every EE process can lazily create a GUID that uniquely identifies it (for
     // purposes of remoting).
     const GUID    &GetUniqueEEId();
@@ -5736,6 +5785,24 @@ private:
     // List of all the threads known to the ThreadStore (started & unstarted).
     ThreadList  m_ThreadList;
 
+    // The threads of m_ThreadList in the same order, so that enumerating them does
+    // not chase a pointer through every Thread. A removed thread leaves a NULL hole
+    // that is squeezed out when the array is reallocated. The array is read and
+    // written under the ThreadStore lock, like the list.
+    struct ThreadArray
+    {
+        DWORD           m_capacity;
+        DWORD           m_count;
+        Thread         *m_threads[1];
+    };
+
+    ThreadArray    *m_pThreadArray;
+    DWORD           m_ThreadArrayHoles;
+
+#ifndef DACCESS_COMPILE
+    void ReallocateThreadArray();
+#endif // !DACCESS_COMPILE
+
     // m_ThreadCount is the count of all threads in m_ThreadList.  This includes
     // background threads / unstarted threads / whatever.
     //
@@ -7674,6 +7741,21 @@ class Compiler;
 // different flavors of build. Eg. in chk build the offset of m_pThread is 0x4 while in ret build it becomes 0x8 as 0x4 is  
 // occupied by m_pAddDomain. Packing all thread local variables in a struct and making struct instance to be thread local
 // ensures that the offsets of the variables are stable in all build flavors.
+
+// Number of entries in the per-thread cache of thread static bases, a power of two.
+// Every thread pays for the whole cache in its TLS block, so it is kept to the few
+// classes a hot loop is likely to use.
+#define THREAD_STATIC_CACHE_SIZE 8
+
+// An entry of the per-thread cache of thread static bases, see code:ThreadStatics::GetCachedNonGCStaticsBase.
+struct ThreadStaticCacheEntry
+{
+    TADDR   m_key;      // Module ID of the class, or its MethodTable for generics. 0 if the entry is empty.
+    DWORD   m_classID;  // Class ID, or dynamic class ID
+    DWORD   m_flags;    // ThreadStatics::CacheFlags
+    TADDR   m_base;     // Non-GC statics base, or handle of the GC statics
+};
+
 struct ThreadLocalInfo
 {
     Thread* m_pThread;
@@ -7682,7 +7764,18 @@ struct ThreadLocalInfo
 #ifdef FEATURE_MERGE_JIT_AND_ENGINE
     Compiler* m_pCompiler;
 #endif
+    // Must stay last so that they do not move the fields above
+    DWORD m_ThreadStaticCacheGeneration;    // ThreadStatics::s_cacheGeneration the entries are valid for
+    ThreadStaticCacheEntry m_ThreadStaticCache[THREAD_STATIC_CACHE_SIZE];
 };
+
+#ifndef DACCESS_COMPILE
+#ifndef __llvm__
+EXTERN_C __declspec(thread) ThreadLocalInfo gCurrentThreadInfo;
+#else // !__llvm__
+EXTERN_C __thread ThreadLocalInfo gCurrentThreadInfo;
+#endif // !__llvm__
+#endif // !DACCESS_COMPILE
 #endif // FEATURE_IMPLICIT_TLS
 
 class ThreadStateHolder
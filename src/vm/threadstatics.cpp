@@ -686,6 +686,34 @@ PTR_ThreadLocalModule ThreadStatics::AllocateTLM(Module * pModule)
     return pThreadLocalModule;
 }
 
+BOOL ThreadStatics::s_fCacheEnabled = FALSE;
+
+// Starts at 1 so that the zero initialized cache of a new thread is stale
+Volatile<DWORD> ThreadStatics::s_cacheGeneration = 1;
+
+void ThreadStatics::InitializeCache() //static
+{
+    STANDARD_VM_CONTRACT;
+
+    s_fCacheEnabled = (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadStaticCache) != 0);
+}
+
+void ThreadStatics::FlushCache() //static
+{
+    LIMITED_METHOD_CONTRACT;
+
+#ifdef FEATURE_IMPLICIT_TLS
+    memset(gCurrentThreadInfo.m_ThreadStaticCache, 0, sizeof(gCurrentThreadInfo.m_ThreadStaticCache));
+#endif
+}
+
+void ThreadStatics::InvalidateCaches() //static
+{
+    LIMITED_METHOD_CONTRACT;
+
+    FastInterlockIncrement((LONG *)&s_cacheGeneration);
+}
+
 #endif
 
 PTR_ThreadLocalBlock ThreadStatics::GetTLBIfExists(PTR_Thread pThread, ADIndex index) //static
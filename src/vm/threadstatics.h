@@ -680,6 +680,126 @@ class ThreadStatics
         // Get the TLM from the ThreadLocalBlock's table
         return pThreadLocalBlock->GetTLMIfExists(pMT);
     }
+
+    // The thread static bases of the classes a thread used last are cached in its native
+    // TLS block, so that the JIT helpers can find them with a couple of loads instead of
+    // walking the Thread, ThreadLocalBlock and ThreadLocalModule. A class is cached once its
+    // statics have been allocated and initialized on the thread. The non-GC statics do not
+    // move, so their base is cached. The GC statics live in an array on the GC heap, so the
+    // handle of the array is cached instead. The cache of a thread is flushed when the
+    // thread switches AppDomain. Freeing the thread static data of any thread bumps
+    // s_cacheGeneration instead, which every lookup checks, since it is usually done by
+    // another thread, like the one unloading an AppDomain.
+    //
+    // This shortens the lookups done by the helpers, the JIT still calls them rather than
+    // reading the statics base from TLS inline.
+    //
+    // An entry is keyed by the module ID of the class, or by its MethodTable for generics,
+    // by its class ID, and by CacheFlags.
+
+    enum CacheFlags
+    {
+        CACHE_NONGC     = 0,
+        CACHE_GC        = 1,
+        CACHE_DYNAMIC   = 2,    // The class ID is a dynamic class ID
+    };
+
+#ifdef FEATURE_IMPLICIT_TLS
+    FORCEINLINE static ThreadStaticCacheEntry * GetCacheEntry(TADDR key, DWORD dwClassID, DWORD dwFlags)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        DWORD index = ((DWORD)(key >> 4) ^ (dwClassID << 2) ^ dwFlags) & (THREAD_STATIC_CACHE_SIZE - 1);
+        return &gCurrentThreadInfo.m_ThreadStaticCache[index];
+    }
+
+    FORCEINLINE static PTR_BYTE GetCachedNonGCStaticsBase(TADDR key, DWORD dwClassID, DWORD dwFlags)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        if (gCurrentThreadInfo.m_ThreadStaticCacheGeneration != s_cacheGeneration)
+            return NULL;
+
+        ThreadStaticCacheEntry * pEntry = GetCacheEntry(key, dwClassID, dwFlags);
+        if (pEntry->m_key != key || pEntry->m_classID != dwClassID || pEntry->m_flags != dwFlags)
+            return NULL;
+
+        return dac_cast<PTR_BYTE>(pEntry->m_base);
+    }
+
+    FORCEINLINE static PTR_BYTE GetCachedGCStaticsBase(TADDR key, DWORD dwClassID, DWORD dwFlags)
+    {
+        CONTRACTL
+        {
+            NOTHROW;
+            GC_NOTRIGGER;
+            MODE_COOPERATIVE;
+            SO_TOLERANT;
+        }
+        CONTRACTL_END;
+
+        if (gCurrentThreadInfo.m_ThreadStaticCacheGeneration != s_cacheGeneration)
+            return NULL;
+
+        ThreadStaticCacheEntry * pEntry = GetCacheEntry(key, dwClassID, dwFlags);
+        if (pEntry->m_key != key || pEntry->m_classID != dwClassID || pEntry->m_flags != dwFlags)
+            return NULL;
+
+        return dac_cast<PTR_BYTE>((PTR_OBJECTREF)((PTRARRAYREF)ObjectFromHandle((OBJECTHANDLE)pEntry->m_base))->GetDataPtr());
+    }
+
+    FORCEINLINE static void CacheStaticsBase(TADDR key, DWORD dwClassID, DWORD dwFlags, TADDR base)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        if (!s_fCacheEnabled || base == 0)
+            return;
+
+        // The entries from before the last invalidation may point to freed data
+        DWORD generation = s_cacheGeneration;
+        if (gCurrentThreadInfo.m_ThreadStaticCacheGeneration != generation)
+        {
+            FlushCache();
+            gCurrentThreadInfo.m_ThreadStaticCacheGeneration = generation;
+        }
+
+        ThreadStaticCacheEntry * pEntry = GetCacheEntry(key, dwClassID, dwFlags);
+        pEntry->m_key = key;
+        pEntry->m_classID = dwClassID;
+        pEntry->m_flags = dwFlags;
+        pEntry->m_base = base;
+    }
+#else // FEATURE_IMPLICIT_TLS
+    FORCEINLINE static PTR_BYTE GetCachedNonGCStaticsBase(TADDR key, DWORD dwClassID, DWORD dwFlags)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return NULL;
+    }
+
+    FORCEINLINE static PTR_BYTE GetCachedGCStaticsBase(TADDR key, DWORD dwClassID, DWORD dwFlags)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return NULL;
+    }
+
+    FORCEINLINE static void CacheStaticsBase(TADDR key, DWORD dwClassID, DWORD dwFlags, TADDR base)
+    {
+        LIMITED_METHOD_CONTRACT;
+    }
+#endif // FEATURE_IMPLICIT_TLS
+
+    // Empties the cache of the current thread
+    static void FlushCache();
+
+    // Empties the caches of all the threads
+    static void InvalidateCaches();
+
+    // Reads COMPlus_ThreadStaticCache
+    static void InitializeCache();
+
+  private:
+    static BOOL s_fCacheEnabled;
+    static Volatile<DWORD> s_cacheGeneration;
 #endif
 
 };
@@ -36,6 +36,14 @@ Thread* ThreadSuspend::m_pThreadAttemptingSuspendForGC;
 CLREventBase * ThreadSuspend::s_hAbortEvt = NULL;
 CLREventBase * ThreadSuspend::s_hAbortEvtCache = NULL;
 
+#ifdef FEATURE_ACTIVATION_INJECTION
+BOOL ThreadSuspend::s_fActivationInjectionEnabled = FALSE;
+#endif // FEATURE_ACTIVATION_INJECTION
+
+ThreadSuspend::SuspensionStats ThreadSuspend::s_lastSuspensionStats;
+ThreadSuspend::SuspensionStats ThreadSuspend::s_publishedSuspensionStats;
+Volatile<LONG> ThreadSuspend::s_publishedSuspensionStatsVersion = 0;
+
 
 // If you add any thread redirection function, make sure the debugger can 1) recognize the redirection 
 // function, and 2) retrieve the original CONTEXT.  See code:Debugger.InitializeHijackFunctionAddress and
@@ -68,6 +76,10 @@ extern "C" void             RedirectedHandledJITCaseForGCStress_Stub(void);
 // our chances of snagging it at a safe spot).
 #define PING_JIT_TIMEOUT        10
 
+// When threads have been interrupted with activations, the ones that were not at a
+// GC safe point are interrupted again this often until they reach one.
+#define PING_ACTIVATION_TIMEOUT 1
+
 // When we find a thread in a spot that's not safe to abort -- how long to wait before
 // we try again.
 #define ABORT_POLL_TIMEOUT      10
@@ -4822,6 +4834,182 @@ void __stdcall PauseAPC(__in ULONG_PTR dwParam)
 // which leaves cooperative mode and waits for the GC to complete.
 //           
 // See code:Thread#SuspendingTheRuntime for more 
+#ifdef FEATURE_ACTIVATION_INJECTION
+
+// Runs on a thread interrupted by Thread::InjectGcSuspension, on the context of
+// the managed code it was executing. If that code is at a GC safe point, the
+// thread rendezvous with the pending suspension here; otherwise it resumes and
+// is interrupted again on the next retry of SuspendRuntime.
+static void PALAPI HandleGCSuspensionForInterruptedThread(CONTEXT *interruptedContext)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_TRIGGERS;
+    }
+    CONTRACTL_END;
+
+    Thread *pThread = GetThread();
+
+    if (pThread == NULL || !pThread->PreemptiveGCDisabled() || !pThread->CatchAtSafePoint())
+        return;
+
+    Thread::WorkingOnThreadContextHolder workingOnThreadContext(pThread);
+    if (!workingOnThreadContext.Acquired())
+        return;
+
+    EECodeInfo codeInfo(GetIP(interruptedContext));
+    if (!codeInfo.IsValid())
+        return;
+
+    // Only fully interruptible code outside of the prolog and epilogs is GC safe.
+    // There is no return address hijacking on this platform, so a thread in any
+    // other code is left to run to its next poll or activation.
+    if (!codeInfo.GetCodeManager()->IsGcSafe(&codeInfo, codeInfo.GetRelOffset()))
+    {
+        pThread->NoteSuspendStall(ThreadSuspend::STALL_HIJACKABLE, GetIP(interruptedContext));
+        return;
+    }
+
+    pThread->NoteSuspendStall(ThreadSuspend::STALL_INTERRUPTIBLE, GetIP(interruptedContext));
+
+    // The frame makes the interrupted context the top of the managed stack, so
+    // that the GC reports the registers of the interrupted method.
+    FrameWithCookie<ResumableFrame> frame(interruptedContext);
+    frame.Push(pThread);
+
+    pThread->PulseGCMode();
+
+    frame.Pop(pThread);
+}
+
+// Decides whether an activation can be handled at the interrupted instruction.
+static BOOL PALAPI CheckActivationSafePoint(SIZE_T ip)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        SO_TOLERANT;
+    }
+    CONTRACTL_END;
+
+    Thread *pThread = GetThread();
+
+    // A thread in preemptive mode is not running managed code. It may also hold
+    // the writer lock of the code ranges, so looking the address up could
+    // deadlock.
+    if (pThread == NULL || !pThread->PreemptiveGCDisabled())
+        return FALSE;
+
+    if (!ExecutionManager::IsManagedCode((PCODE)ip))
+    {
+        pThread->NoteSuspendStall(ThreadSuspend::STALL_NATIVE, (PCODE)ip);
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+BOOL Thread::InjectGcSuspension()
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    if (!ThreadSuspend::s_fActivationInjectionEnabled)
+        return FALSE;
+
+    HANDLE hThread = GetThreadHandle();
+    if (hThread == INVALID_HANDLE_VALUE || hThread == SWITCHOUT_HANDLE_VALUE)
+        return FALSE;
+
+    return ::PAL_InjectActivation(hThread);
+}
+
+#endif // FEATURE_ACTIVATION_INJECTION
+
+void ThreadSuspend::Initialize()
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+#ifdef FEATURE_ACTIVATION_INJECTION
+    if (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadSuspendInjection) != 0)
+    {
+        ::PAL_SetActivationFunction(HandleGCSuspensionForInterruptedThread, CheckActivationSafePoint);
+        s_fActivationInjectionEnabled = TRUE;
+    }
+#endif // FEATURE_ACTIVATION_INJECTION
+}
+
+// Accounts a thread that SuspendRuntime waited for to the last suspension's
+// statistics, once it is found at a safe point dwMicroseconds after the
+// suspension started.
+void ThreadSuspend::NoteThreadAtSafePoint(Thread *pThread, DWORD dwMicroseconds)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    DWORD dwReason = pThread->m_dwSuspendStallReason;
+    if (dwReason >= STALL_COUNT)
+        dwReason = STALL_UNKNOWN;
+
+    s_lastSuspensionStats.dwStallCounts[dwReason]++;
+
+    if (dwMicroseconds >= s_lastSuspensionStats.dwMaxMicroseconds)
+    {
+        s_lastSuspensionStats.dwMaxMicroseconds = dwMicroseconds;
+        s_lastSuspensionStats.dwOffenderOSThreadId = pThread->GetOSThreadId();
+        s_lastSuspensionStats.dwOffenderReason = dwReason;
+        s_lastSuspensionStats.offenderIP = pThread->m_suspendStallIP;
+    }
+}
+
+// Called by SuspendEE, with the ThreadStore lock held, so there is only ever
+// one writer.
+void ThreadSuspend::PublishSuspensionStats()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    _ASSERTE(ThreadStore::HoldingThreadStore());
+
+    s_publishedSuspensionStatsVersion = s_publishedSuspensionStatsVersion + 1;
+    MemoryBarrier();
+    s_publishedSuspensionStats = s_lastSuspensionStats;
+    MemoryBarrier();
+    s_publishedSuspensionStatsVersion = s_publishedSuspensionStatsVersion + 1;
+}
+
+// Reads the statistics SuspendEE published last. This does not take the
+// ThreadStore lock, which would make the caller wait out a whole GC; instead
+// it copies them again if a suspension published new ones meanwhile.
+void ThreadSuspend::GetLastSuspensionStats(SuspensionStats *pStats)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    for (;;)
+    {
+        LONG version = s_publishedSuspensionStatsVersion;
+        if ((version & 1) == 0)
+        {
+            MemoryBarrier();
+            *pStats = s_publishedSuspensionStats;
+            MemoryBarrier();
+            if (s_publishedSuspensionStatsVersion == version)
+                return;
+        }
+        __SwitchToThread(0, CALLER_LIMITS_SPINNING);
+    }
+}
+
 HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
 {
     CONTRACTL {
@@ -4846,6 +5034,13 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
     // The number of threads we found in COOP mode.
     LONG     countThreads = 0;
 
+    // The number of activations injected into threads in COOP mode.
+    DWORD    countActivations = 0;
+
+    // Used to measure how long each thread takes to reach a safe point.
+    LARGE_INTEGER qpcStart;
+    BOOL     fTimeToSafePoint = QueryPerformanceCounter(&qpcStart);
+
     DWORD    res;
 
     // Caller is expected to be holding the ThreadStore lock.  Also, caller must
@@ -4855,6 +5050,8 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
 
     STRESS_LOG1(LF_SYNC, LL_INFO1000, "Thread::SuspendRuntime(reason=0x%x)\n", reason);
 
+    ZeroMemory(&s_lastSuspensionStats, sizeof(s_lastSuspensionStats));
+
 #if !defined(FEATURE_CORECLR) // simple hosting
     // Alert the host that a GC is starting, in case the host is scheduling threads
     // for non-runtime tasks during GC.
@@ -4965,6 +5162,9 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
         // to Cooperative mode without special treatment when a GC is happening.
         if (thread->m_fPreemptiveGCDisabled)
         {
+            // Forget where the thread stalled the previous suspension.
+            thread->NoteSuspendStall(STALL_UNKNOWN, NULL);
+
             // Check a little more carefully.  Threads might sneak out without telling
             // us, because of inlined PInvoke which doesn't go through RareEnablePreemptiveGC.
 
@@ -4987,6 +5187,16 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
             {
                 FastInterlockOr((ULONG *) &thread->m_State, Thread::TS_GCSuspendPending);
                 countThreads++;
+
+#ifdef FEATURE_ACTIVATION_INJECTION
+                // Interrupt the thread rather than wait for it to poll. The threads
+                // are all interrupted before any of them is waited for, so they
+                // reach their safe points in parallel.
+                if (thread->InjectGcSuspension())
+                {
+                    countActivations++;
+                }
+#endif // FEATURE_ACTIVATION_INJECTION
             }
 #else // DISABLE_THREADSUSPEND
 
@@ -5148,6 +5358,8 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
 
 #endif
 
+    s_lastSuspensionStats.dwRendezvousCount = (DWORD)countThreads;
+
     //
     // Now we keep retrying until we find that no threads are in cooperative mode.  This should be merged into 
     // the first loop.
@@ -5156,6 +5368,12 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
     {
         _ASSERTE (thread == NULL);
         STRESS_LOG1(LF_SYNC, LL_INFO1000, "    A total of %d threads need to rendezvous\n", countThreads);
+
+        // Threads found at a safe point in this pass are charged the time elapsed so far.
+        DWORD elapsedMicroseconds = 0;
+        if (fTimeToSafePoint)
+            elapsedMicroseconds = (DWORD)CLRGetElapsedMicroseconds(qpcStart);
+
         while ((thread = ThreadStore::GetThreadList(thread)) != NULL)
         {
             if (thread == pCurThread)
@@ -5197,6 +5415,7 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
                     STRESS_LOG1(LF_SYNC, LL_INFO1000, "    Thread %x went preemptive it is at a GC safe point\n", thread);
                     countThreads--;
                     thread->ResetThreadState(Thread::TS_GCSuspendPending);
+                    NoteThreadAtSafePoint(thread, elapsedMicroseconds);
 
                     // To ensure 0 CPU utilization for FAS (see implementation of PauseAPC)
                     // we queue the APC to all interruptable threads. 
@@ -5238,6 +5457,8 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
             }
 #endif // PROFILING_SUPPORTED
 
+            s_lastSuspensionStats.dwActivationCount = countActivations;
+
             STRESS_LOG0(LF_SYNC, LL_ALWAYS, "Thread::SuspendRuntime() - Timing out.\n");
             return (ERROR_TIMEOUT);
         }
@@ -5263,7 +5484,7 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
         // For now, we simply wait.
         //
 
-        res = g_pGCSuspendEvent->Wait(PING_JIT_TIMEOUT, FALSE);
+        res = g_pGCSuspendEvent->Wait((countActivations != 0) ? PING_ACTIVATION_TIMEOUT : PING_JIT_TIMEOUT, FALSE);
 
 
 #ifdef TIME_SUSPEND
@@ -5279,6 +5500,7 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
         if (res == WAIT_TIMEOUT || res == WAIT_IO_COMPLETION)
         {
             STRESS_LOG1(LF_SYNC, LL_INFO1000, "    Timed out waiting for rendezvous event %d threads remaining\n", countThreads);
+            s_lastSuspensionStats.dwRetryCount++;
 #ifdef _DEBUG
             DWORD dbgEndTimeout = GetTickCount();
 
@@ -5397,6 +5619,26 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
                 if (str == Thread::STR_Success)
                     thread->ResumeThread();
             }
+#elif defined(FEATURE_ACTIVATION_INJECTION)
+            // Interrupt the threads that are still in cooperative mode again; the ones
+            // that were not at a GC safe point last time may have reached one.
+            _ASSERTE (thread == NULL);
+            while ((thread = ThreadStore::GetThreadList(thread)) != NULL)
+            {
+                if (thread == pCurThread)
+                    continue;
+
+                if ((thread->m_State & Thread::TS_GCSuspendPending) == 0)
+                    continue;
+
+                if (!thread->m_fPreemptiveGCDisabled)
+                    continue;
+
+                if (thread->InjectGcSuspension())
+                {
+                    countActivations++;
+                }
+            }
 #endif // DISABLE_THREADSUSPEND
         }
         else
@@ -5412,6 +5654,8 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
         }
     }
 
+    s_lastSuspensionStats.dwActivationCount = countActivations;
+
 #ifdef PROFILING_SUPPORTED
     // If a profiler is keeping track of GC events, notify it
     {
@@ -7499,6 +7743,7 @@ BOOL Thread::HandledJITCase(BOOL ForTaskSwitchIn)
 
     if (!ExecutionManager::IsManagedCode(GetIP(&ctx)))
     {
+        NoteSuspendStall(ThreadSuspend::STALL_NATIVE, GetIP(&ctx));
         return FALSE;
     }
     
@@ -7548,6 +7793,9 @@ BOOL Thread::HandledJITCase(BOOL ForTaskSwitchIn)
     //
     if (action == SWA_ABORT && esb.m_IsJIT)
     {
+        NoteSuspendStall(esb.m_IsInterruptible ? ThreadSuspend::STALL_INTERRUPTIBLE : ThreadSuspend::STALL_HIJACKABLE,
+                         GetIP(&ctx));
+
         // If we are interruptible and we are in cooperative mode, our caller can
         // just leave us suspended.
         if (esb.m_IsInterruptible && m_fPreemptiveGCDisabled)
@@ -7989,6 +8237,10 @@ void ThreadSuspend::SuspendEE(SUSPEND_REASON reason)
 
     FireEtwGCSuspendEEBegin_V1(Info.SuspendEE.Reason, Info.SuspendEE.GcCount, GetClrInstanceId());
 
+    // Time to suspend, reported with the end event
+    LARGE_INTEGER qpcStart;
+    BOOL canUseHighRes = QueryPerformanceCounter(&qpcStart);
+
     LOG((LF_SYNC, INFO3, "Suspending the runtime for reason %d\n", reason));
 
     gcOnTransitions = GC_ON_TRANSITIONS(FALSE);        // dont do GC for GCStress 3
@@ -8224,7 +8476,32 @@ retry_for_debugger:
     }
     GC_ON_TRANSITIONS(gcOnTransitions);
 
-    FireEtwGCSuspendEEEnd_V1(GetClrInstanceId());
+    DWORD suspendMicroseconds = 0;
+    if (canUseHighRes)
+        suspendMicroseconds = (DWORD)CLRGetElapsedMicroseconds(qpcStart);
+
+    FireEtwGCSuspendEEEnd_V2(GetClrInstanceId(), suspendMicroseconds,
+                             s_lastSuspensionStats.dwRendezvousCount, s_lastSuspensionStats.dwActivationCount);
+
+    PublishSuspensionStats();
+
+    if (s_lastSuspensionStats.dwRendezvousCount != 0)
+    {
+        STRESS_LOG3(LF_SYNC, LL_INFO100, "SuspendEE: thread 0x%x took %d us to reach a safe point from IP %p\n",
+            s_lastSuspensionStats.dwOffenderOSThreadId, s_lastSuspensionStats.dwMaxMicroseconds,
+            (void *)s_lastSuspensionStats.offenderIP);
+
+        FireEtwGCSuspendEEStats(GetClrInstanceId(),
+                                s_lastSuspensionStats.dwRetryCount,
+                                s_lastSuspensionStats.dwStallCounts[STALL_INTERRUPTIBLE],
+                                s_lastSuspensionStats.dwStallCounts[STALL_HIJACKABLE],
+                                s_lastSuspensionStats.dwStallCounts[STALL_NATIVE],
+                                s_lastSuspensionStats.dwStallCounts[STALL_UNKNOWN],
+                                s_lastSuspensionStats.dwMaxMicroseconds,
+                                s_lastSuspensionStats.dwOffenderOSThreadId,
+                                s_lastSuspensionStats.dwOffenderReason,
+                                (const void *)s_lastSuspensionStats.offenderIP);
+    }
 
 #ifdef TIME_SUSPEND
     g_SuspendStatistics.EndSuspend(reason == SUSPEND_FOR_GC || reason == SUSPEND_FOR_GC_PREP);
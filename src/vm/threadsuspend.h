@@ -188,18 +188,64 @@ public:
         SUSPEND_FOR_DEBUGGER_SWEEP      = 7     // This must only be used in Thread::SysSweepThreadsForDebug
     } SUSPEND_REASON;
 
+    // Where a thread was executing when SuspendRuntime last found it in
+    // cooperative mode.
+    typedef enum
+    {
+        STALL_UNKNOWN                   = 0,    // The thread could not be inspected
+        STALL_INTERRUPTIBLE             = 1,    // Fully interruptible managed code
+        STALL_HIJACKABLE                = 2,    // Managed code that is not at a GC safe point
+        STALL_NATIVE                    = 3,    // Runtime or native code with preemptive GC disabled
+        STALL_COUNT
+    } STALL_REASON;
+
+    // How long the threads stopped by the last SuspendRuntime took to reach a
+    // safe point. Reported by SuspendEE and GC.GetLastSuspensionInfo.
+    struct SuspensionStats
+    {
+        DWORD dwRendezvousCount;                // Threads found in cooperative mode
+        DWORD dwActivationCount;                // Activations injected into them
+        DWORD dwRetryCount;                     // Times the wait for them timed out
+        DWORD dwStallCounts[STALL_COUNT];       // Threads waited for, by where they were last seen
+        DWORD dwMaxMicroseconds;                // Longest time a thread took to reach a safe point
+        DWORD dwOffenderOSThreadId;             // The thread that took that long
+        DWORD dwOffenderReason;                 // Its STALL_REASON
+        PCODE offenderIP;                       // Where it was last seen in cooperative mode
+    };
+
 private:
     static SUSPEND_REASON    m_suspendReason;    // This contains the reason
                                           // that the runtime was suspended
     static Thread* m_pThreadAttemptingSuspendForGC;
 
 public:
+    static void    Initialize();
+
     static HRESULT SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason);
     static void    ResumeRuntime(BOOL bFinishedGC, BOOL SuspendSucceded);
 
+    static void    GetLastSuspensionStats(SuspensionStats *pStats);
+
 private:
     static CLREvent * g_pGCSuspendEvent;
 
+#ifdef FEATURE_ACTIVATION_INJECTION
+    // TRUE if threads are interrupted with activations during SuspendRuntime.
+    static BOOL s_fActivationInjectionEnabled;
+#endif // FEATURE_ACTIVATION_INJECTION
+
+    // Filled in by SuspendRuntime under the ThreadStore lock.
+    static SuspensionStats s_lastSuspensionStats;
+
+    // Copy of s_lastSuspensionStats published by SuspendEE for readers that do
+    // not hold the ThreadStore lock. The version is odd while the copy is being
+    // written.
+    static SuspensionStats s_publishedSuspensionStats;
+    static Volatile<LONG> s_publishedSuspensionStatsVersion;
+
+    static void NoteThreadAtSafePoint(Thread *pThread, DWORD dwMicroseconds);
+    static void PublishSuspensionStats();
+
     // This is true iff we're currently in the process of suspending threads.  Once the
     // threads have been suspended, this is false.  This is set via an instance of
     // SuspendRuntimeInProgressHolder placed in SuspendRuntime, SysStartSuspendForDebug,
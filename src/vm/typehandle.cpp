@@ -527,6 +527,21 @@ CorElementType TypeHandle::GetHFAType() const
 }
 #endif // FEATURE_HFA
 
+#ifdef FEATURE_UNIX_AMD64_STRUCT_PASSING
+bool TypeHandle::IsRegPassedStruct() const
+{
+    WRAPPER_NO_CONTRACT;
+
+    // The native views of value types used by the interop stubs keep being passed by reference,
+    // and so does TypedReference, which the JIT builds and passes as a whole.
+    if (IsTypeDesc())
+        return false;
+
+    MethodTable *pMT = AsMethodTable();
+    return pMT->IsRegPassedStruct() && !pMT->GetClass()->ContainsStackPtr();
+}
+#endif // FEATURE_UNIX_AMD64_STRUCT_PASSING
+
 #ifdef FEATURE_64BIT_ALIGNMENT
 bool TypeHandle::RequiresAlign8() const
 {
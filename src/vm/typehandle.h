@@ -400,6 +400,10 @@ public:
     CorElementType GetHFAType() const;
 #endif // FEATURE_HFA
 
+#ifdef FEATURE_UNIX_AMD64_STRUCT_PASSING
+    bool IsRegPassedStruct() const;
+#endif // FEATURE_UNIX_AMD64_STRUCT_PASSING
+
 #ifdef FEATURE_64BIT_ALIGNMENT
     bool RequiresAlign8() const;
 #endif // FEATURE_64BIT_ALIGNMENT
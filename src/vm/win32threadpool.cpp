@@ -33,6 +33,7 @@ Revision History:
 #include "appdomain.inl"
 #include "nativeoverlapped.h"
 #include "hillclimbing.h"
+#include "simplerwlock.hpp"
 
 
 #ifndef FEATURE_PAL
@@ -95,6 +96,16 @@ LONG    ThreadpoolMgr::cpuUtilizationAverage = 0;
 
 HillClimbing ThreadpoolMgr::HillClimbingInstance;
 
+bool ThreadpoolMgr::UseLatencyController;
+LatencyController ThreadpoolMgr::LatencyControllerInstance;
+bool ThreadpoolMgr::WorkerTrackingEnabled;
+Volatile<LONG> ThreadpoolMgr::NumBlockedWorkers = 0;
+DWORD ThreadpoolMgr::ThreadRequestTimes[ThreadpoolMgr::ThreadRequestTimesSize];
+Volatile<LONG> ThreadpoolMgr::ThreadRequestsMade = 0;
+Volatile<LONG> ThreadpoolMgr::ThreadRequestsServed = 0;
+CLREvent * ThreadpoolMgr::GateThreadWakeEvent = NULL;
+Volatile<LONG> ThreadpoolMgr::GateThreadIdle = 0;
+
 Volatile<LONG> ThreadpoolMgr::PriorCompletedWorkRequests = 0;
 Volatile<DWORD> ThreadpoolMgr::PriorCompletedWorkRequestsTime;
 Volatile<DWORD> ThreadpoolMgr::NextCompletedWorkRequestsTime;
@@ -117,6 +128,9 @@ int ThreadpoolMgr::offset_counter = 0;
 SPTR_IMPL(WorkRequest,ThreadpoolMgr,WorkRequestHead);        // Head of work request queue
 SPTR_IMPL(WorkRequest,ThreadpoolMgr,WorkRequestTail);        // Head of work request queue
 
+WorkRequestStealingQueue* ThreadpoolMgr::WorkerQueueList = NULL;     // per-worker queues
+SimpleRWLock* ThreadpoolMgr::WorkerQueueListLock = NULL;
+
 SVAL_IMPL(ThreadpoolMgr::LIST_ENTRY,ThreadpoolMgr,TimerQueue);  // queue of timers
 
 //unsigned int ThreadpoolMgr::LastCpuSamplingTime=0;      //  last time cpu utilization was sampled by gate thread
@@ -331,12 +345,17 @@ BOOL ThreadpoolMgr::Initialize()
     EX_TRY
     {
         ThreadAdjustmentInterval = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_HillClimbing_SampleIntervalLow);
+
+        UseLatencyController = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_UseLatencyController) != 0;
+        WorkerTrackingEnabled = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_EnableWorkerTracking) != 0;
         
         pADTPCount->InitResources();
         WorkerCriticalSection.Init(CrstThreadpoolWorker);
         WaitThreadsCriticalSection.Init(CrstThreadpoolWaitThreads);
         TimerQueueCriticalSection.Init(CrstThreadpoolTimerQueue);
 
+        WorkerQueueListLock = new SimpleRWLock(COOPERATIVE_OR_PREEMPTIVE, LOCK_TYPE_DEFAULT);
+
         // initialize WaitThreadsHead
         InitializeListHead(&WaitThreadsHead);
 
@@ -347,6 +366,13 @@ BOOL ThreadpoolMgr::Initialize()
         RetiredCPWakeupEvent->CreateAutoEvent(FALSE);
         _ASSERTE(RetiredCPWakeupEvent->IsValid());
 
+        if (UseLatencyController)
+        {
+            GateThreadWakeEvent = new CLREvent();
+            GateThreadWakeEvent->CreateAutoEvent(FALSE);
+            _ASSERTE(GateThreadWakeEvent->IsValid());
+        }
+
         WorkerSemaphore = new UnfairSemaphore(ThreadCounter::MaxPossibleCount);
 
         RetiredWorkerSemaphore = new CLRSemaphore();
@@ -377,6 +403,18 @@ BOOL ThreadpoolMgr::Initialize()
             RetiredCPWakeupEvent = NULL;
         }
 
+        if (GateThreadWakeEvent)
+        {
+            delete GateThreadWakeEvent;
+            GateThreadWakeEvent = NULL;
+        }
+
+        if (WorkerQueueListLock)
+        {
+            delete WorkerQueueListLock;
+            WorkerQueueListLock = NULL;
+        }
+
         // Note: It is fine to call Destroy on unitialized critical sections
         WorkerCriticalSection.Destroy();
         WaitThreadsCriticalSection.Destroy();
@@ -422,7 +460,6 @@ BOOL ThreadpoolMgr::Initialize()
     counts.MaxWorking = MinLimitTotalCPThreads;
     CPThreadCounter.counts.AsLongLong = counts.AsLongLong;
 
-#ifndef FEATURE_PAL    
 #ifdef FEATURE_INCLUDE_ALL_INTERFACES
     if (CLRIoCompletionHosted())
     {
@@ -439,15 +476,24 @@ BOOL ThreadpoolMgr::Initialize()
     else
 #endif // FEATURE_INCLUDE_ALL_INTERFACES
     {
+        // On platforms where the PAL has no completion ports this fails and GlobalCompletionPort stays NULL;
+        // posted completions are then run on worker threads and handles cannot be bound.
         GlobalCompletionPort = CreateIoCompletionPort(INVALID_HANDLE_VALUE,
                                                       NULL,
                                                       0,        /*ignored for invalid handle value*/
                                                       NumberOfProcessors);
     }
-#endif // !FEATURE_PAL    
 
     HillClimbingInstance.Initialize();
 
+    if (UseLatencyController)
+    {
+        // The latency controller is consulted whenever its target latency has passed, rather than
+        // at the intervals HillClimbing picks.
+        LatencyControllerInstance.Initialize();
+        ThreadAdjustmentInterval = (int)LatencyControllerInstance.GetLatencyTarget();
+    }
+
     bRet = TRUE;
 end:
     return bRet;
@@ -979,7 +1025,7 @@ void ThreadpoolMgr::ReportThreadStatus(bool isWorking)
         MODE_ANY;
     }
     CONTRACTL_END;
-    _ASSERTE(CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_EnableWorkerTracking));
+    _ASSERTE(IsWorkerTrackingEnabled());
     while (true)
     {
         WorkingThreadCounts currentCounts, newCounts;
@@ -1014,7 +1060,7 @@ int TakeMaxWorkingThreadCount()
         MODE_ANY;
     }
     CONTRACTL_END;
-    _ASSERTE(CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_EnableWorkerTracking));
+    _ASSERTE(ThreadpoolMgr::IsWorkerTrackingEnabled());
     while (true)
     {
         WorkingThreadCounts currentCounts, newCounts;
@@ -1197,53 +1243,241 @@ void ThreadpoolMgr::AdjustMaxWorkersActive()
     {
         ThreadCounter::Counts currentCounts = WorkerCounter.GetCleanCounts();
 
-        int newMax = HillClimbingInstance.Update(
-            currentCounts.MaxWorking, 
-            elapsed, 
-            numCompletions,
-            &ThreadAdjustmentInterval);
+        int newMax;
+        if (UseLatencyController)
+        {
+            newMax = LatencyControllerInstance.Update(
+                currentCounts.MaxWorking, 
+                GetBlockedWorkerCount(), 
+                GetWorkerQueueDelay());
+        }
+        else
+        {
+            newMax = HillClimbingInstance.Update(
+                currentCounts.MaxWorking, 
+                elapsed, 
+                numCompletions,
+                &ThreadAdjustmentInterval);
+        }
+
+        SetMaxWorkersActive(currentCounts, newMax);
+
+        PriorCompletedWorkRequests = totalNumCompletions;
+        PriorCompletedWorkRequestsTime = currentTicks;
+        NextCompletedWorkRequestsTime = PriorCompletedWorkRequestsTime + ThreadAdjustmentInterval;
+        CurrentSampleStartTime = endTime;
+    }
+}
+
+
+//
+// Moves MaxWorking from currentCounts to newMax, unless someone else raised it at least as far in
+// the meantime.  Must be called with ThreadAdjustmentLock held.
+//
+void ThreadpoolMgr::SetMaxWorkersActive(ThreadCounter::Counts currentCounts, int newMax)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        if (GetThread()) { GC_TRIGGERS;} else {DISABLED(GC_NOTRIGGER);}
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(ThreadAdjustmentLock.IsHeld());
+
+    while (newMax != currentCounts.MaxWorking)
+    {
+        ThreadCounter::Counts newCounts = currentCounts;
+        newCounts.MaxWorking = newMax;
 
-        while (newMax != currentCounts.MaxWorking)
+        ThreadCounter::Counts oldCounts = WorkerCounter.CompareExchangeCounts(newCounts, currentCounts);
+        if (oldCounts == currentCounts)
         {
-            ThreadCounter::Counts newCounts = currentCounts;
-            newCounts.MaxWorking = newMax;
+            //
+            // If we're increasing the max, inject a thread.  If that thread finds work, it will inject
+            // another thread, etc., until nobody finds work or we reach the new maximum.
+            //
+            // If we're reducing the max, whichever threads notice this first will retire themselves.
+            //
+            if (newMax > oldCounts.MaxWorking)
+                MaybeAddWorkingWorker();
 
-            ThreadCounter::Counts oldCounts = WorkerCounter.CompareExchangeCounts(newCounts, currentCounts);
-            if (oldCounts == currentCounts)
+            break;
+        }
+        else
+        {
+            // we failed - maybe try again
+            if (oldCounts.MaxWorking > currentCounts.MaxWorking &&
+                oldCounts.MaxWorking >= newMax)
             {
-                //
-                // If we're increasing the max, inject a thread.  If that thread finds work, it will inject
-                // another thread, etc., until nobody finds work or we reach the new maximum.
-                //
-                // If we're reducing the max, whichever threads notice this first will retire themselves.
-                //
-                if (newMax > oldCounts.MaxWorking)
-                    MaybeAddWorkingWorker();
-
+                // someone (probably the gate thread) increased the thread count more than
+                // we are about to do.  Don't interfere.
                 break;
             }
-            else
-            {
-                // we failed - maybe try again
-                if (oldCounts.MaxWorking > currentCounts.MaxWorking &&
-                    oldCounts.MaxWorking >= newMax)
-                {
-                    // someone (probably the gate thread) increased the thread count more than
-                    // we are about to do.  Don't interfere.
-                    break;
-                }
 
-                currentCounts = oldCounts;
-            }
+            currentCounts = oldCounts;
         }
+    }
+}
 
-        PriorCompletedWorkRequests = totalNumCompletions;
-        PriorCompletedWorkRequestsTime = currentTicks;
-        NextCompletedWorkRequestsTime = PriorCompletedWorkRequestsTime + ThreadAdjustmentInterval;
-        CurrentSampleStartTime = endTime;
+//
+// Thread requests are made when work is queued and taken by the worker threads that go looking
+// for it, oldest first.  For the latency controller we remember when each was made, so that the
+// queue delay is the age of the oldest request still pending rather than the time since a worker
+// last found work, which grows while the pool is idle and stays short while a backlog builds up.
+//
+// Only the last ThreadRequestTimesSize requests are remembered.  If more are pending, the oldest
+// ones have been overwritten and the delay is underestimated until the backlog drains below that.
+//
+void ThreadpoolMgr::RecordThreadRequest()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (!UseLatencyController)
+        return;
+
+    LONG request = FastInterlockIncrement(&ThreadRequestsMade) - 1;
+
+    // Served slots are cleared, so a slot that reads as zero is one we have not written yet, and
+    // GetWorkerQueueDelay takes it for a request made just now.
+    ThreadRequestTimes[request & (ThreadRequestTimesSize - 1)] = GetTickCount() | 1;
+
+    if (GateThreadIdle && FastInterlockExchange(&GateThreadIdle, 0) != 0)
+        GateThreadWakeEvent->Set();
+}
+
+void ThreadpoolMgr::RecordThreadRequestServed()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (!UseLatencyController)
+        return;
+
+    LONG served = ThreadRequestsServed;
+    while ((LONG)(ThreadRequestsMade - served) > 0)
+    {
+        LONG prev = FastInterlockCompareExchange(&ThreadRequestsServed, served + 1, served);
+        if (prev == served)
+        {
+            ThreadRequestTimes[served & (ThreadRequestTimesSize - 1)] = 0;
+            return;
+        }
+        served = prev;
     }
 }
 
+//
+// Called when the last queue with pending requests is found empty and its requests are dropped.
+//
+void ThreadpoolMgr::RecordThreadRequestsCleared()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (!UseLatencyController)
+        return;
+
+    LONG served = ThreadRequestsServed;
+    LONG made = ThreadRequestsMade;
+    while ((LONG)(made - served) > 0)
+    {
+        LONG prev = FastInterlockCompareExchange(&ThreadRequestsServed, made, served);
+        if (prev == served)
+            return;
+        served = prev;
+    }
+}
+
+//
+// How long the oldest pending thread request has waited, for the latency controller.  Zero if
+// nothing is pending, or if an idle worker can still be released for it.
+//
+DWORD ThreadpoolMgr::GetWorkerQueueDelay()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    if (!PerAppDomainTPCountList::AreRequestsPendingInAnyAppDomains())
+        return 0;
+
+    ThreadCounter::Counts counts = WorkerCounter.GetCleanCounts();
+    if (counts.NumWorking < counts.MaxWorking)
+        return 0;
+
+    LONG served = ThreadRequestsServed;
+    if ((LONG)(ThreadRequestsMade - served) <= 0)
+        return 0;
+
+    DWORD requestTime = ThreadRequestTimes[served & (ThreadRequestTimesSize - 1)];
+    if (requestTime == 0)
+        return 0;
+
+    DWORD delay = GetTickCount() - requestTime;
+
+    // The slot may have been reused by a newer request since we read ThreadRequestsServed, which
+    // only makes the delay shorter; a delay that looks negative means the clock moved under us.
+    return ((LONG)delay < 0) ? 0 : delay;
+}
+
+//
+// Worker threads that are in a blocking wait while running a work item, for the latency
+// controller.  These are replaced rather than counted against the oversubscription limit.
+//
+void ThreadpoolMgr::ReportThreadBlocked(bool isBlocked)
+{
+    LIMITED_METHOD_CONTRACT;
+    _ASSERTE(IsBlockedWorkerTrackingEnabled());
+
+    if (isBlocked)
+        FastInterlockIncrement(&NumBlockedWorkers);
+    else
+        FastInterlockDecrement(&NumBlockedWorkers);
+}
+
+int ThreadpoolMgr::GetBlockedWorkerCount()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // A worker can block outside a work item too, so never report more than are working.
+    ThreadCounter::Counts counts = WorkerCounter.GetCleanCounts();
+    return max(0, min((int)NumBlockedWorkers, (int)counts.NumWorking));
+}
+
+//
+// Called by the gate thread between its ticks when the latency controller is in use, so that
+// starving work gets a new thread within a few milliseconds instead of at the next tick, even
+// when no work items complete.
+//
+void ThreadpoolMgr::CheckWorkerQueueLatency()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(UseLatencyController);
+
+    DangerousNonHostedSpinLockTryHolder tal(&ThreadAdjustmentLock);
+    if (!tal.Acquired())
+        return;
+
+    ThreadCounter::Counts currentCounts = WorkerCounter.GetCleanCounts();
+
+    int newMax = LatencyControllerInstance.Update(
+        currentCounts.MaxWorking, 
+        GetBlockedWorkerCount(), 
+        GetWorkerQueueDelay());
+
+    SetMaxWorkersActive(currentCounts, newMax);
+}
 
 void ThreadpoolMgr::MaybeAddWorkingWorker()
 {
@@ -1346,11 +1580,11 @@ BOOL ThreadpoolMgr::PostQueuedCompletionStatus(LPOVERLAPPED lpOverlapped,
     }
     CONTRACTL_END;
 
-#ifndef FEATURE_PAL
     EnsureInitialized();
 
     // if hosted then we need to queue to worker thread, since hosting API doesn't include this method
-    if (CLRIoCompletionHosted())
+    // (the same goes for platforms where the PAL could not create the completion port)
+    if (CLRIoCompletionHosted() || GlobalCompletionPort == NULL)
     {
         PostRequestHolder postRequest = MakePostRequest(Function, lpOverlapped);
         if (postRequest)
@@ -1401,10 +1635,6 @@ BOOL ThreadpoolMgr::PostQueuedCompletionStatus(LPOVERLAPPED lpOverlapped,
                                         0,
                                         (ULONG_PTR) Function,
                                         lpOverlapped);
-#else  
-    SetLastError(ERROR_CALL_NOT_IMPLEMENTED);
-    return FALSE;
-#endif // !FEATURE_PAL
 }
 
 
@@ -1759,8 +1989,7 @@ bool ThreadpoolMgr::ShouldGateThreadKeepRunning()
         // We don't have to do anything special with EnsureGateThreadRunning() here, because this is only needed
         // once work has been added to the queue for the first time (which is covered above).
         //
-        bool needGateThreadForWorkerTracking = 
-            0 != CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_EnableWorkerTracking);
+        bool needGateThreadForWorkerTracking = IsWorkerTrackingEnabled();
 
         if (!(needGateThreadForCompletionPort || 
               needGateThreadForWorkerThreads ||
@@ -1815,6 +2044,342 @@ WorkRequest* ThreadpoolMgr::DequeueWorkRequest()
     RETURN entry;
 }
 
+//--------------------------------------------------------------------------
+// WorkRequestStealingQueue
+//
+
+WorkRequestStealingQueue* WorkRequestStealingQueue::Create()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        MODE_ANY;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    NewHolder<WorkRequestStealingQueue> queue(new (nothrow) WorkRequestStealingQueue);
+    if (queue == NULL)
+        return NULL;
+
+    queue->m_array = new (nothrow) WorkRequest*[InitialSize];
+    if (queue->m_array == NULL)
+        return NULL;
+
+    memset(queue->m_array, 0, InitialSize * sizeof(WorkRequest*));
+    queue->m_mask = InitialSize - 1;
+
+    return queue.Extract();
+}
+
+// Called only by the owning worker. Returns false if the array had to grow
+// and the allocation failed, in which case the caller falls back to the
+// global queue.
+bool WorkRequestStealingQueue::LocalPush(WorkRequest* workRequest)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        MODE_ANY;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    LONG tail = m_tailIndex;
+
+    // Rebase the indices before the tail index overflows. Thieves only touch
+    // m_headIndex under the lock, so taking it makes the rebase atomic.
+    if (tail == MAXLONG)
+    {
+        DangerousNonHostedSpinLockHolder lock(&m_foreignLock);
+
+        if (m_tailIndex == MAXLONG)
+        {
+            m_headIndex = m_headIndex & m_mask;
+            m_tailIndex = tail = m_tailIndex & m_mask;
+            _ASSERTE(m_headIndex <= m_tailIndex);
+        }
+    }
+
+    // Fast path: there is room, so no thief can be looking at this slot.
+    if (tail < m_headIndex + m_mask)
+    {
+        m_array[tail & m_mask] = workRequest;
+        m_tailIndex = tail + 1;
+        return true;
+    }
+
+    DangerousNonHostedSpinLockHolder lock(&m_foreignLock);
+
+    LONG head = m_headIndex;
+    LONG count = m_tailIndex - m_headIndex;
+
+    if (count >= m_mask)
+    {
+        LONG size = m_mask + 1;
+        WorkRequest** newArray = new (nothrow) WorkRequest*[size << 1];
+        if (newArray == NULL)
+            return false;
+
+        memset(newArray, 0, (size << 1) * sizeof(WorkRequest*));
+        for (LONG i = 0; i < size; i++)
+            newArray[i] = m_array[(i + head) & m_mask];
+
+        // Every reader of m_array other than the owner holds the lock, so
+        // the old array can go right away.
+        delete [] m_array;
+        m_array = newArray;
+        m_mask = (m_mask << 1) | 1;
+        m_headIndex = 0;
+        m_tailIndex = tail = count;
+    }
+
+    m_array[tail & m_mask] = workRequest;
+    m_tailIndex = tail + 1;
+    return true;
+}
+
+// Called only by the owning worker. Takes the most recently pushed request.
+WorkRequest* WorkRequestStealingQueue::LocalPop()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        MODE_ANY;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    while (true)
+    {
+        LONG tail = m_tailIndex;
+        if (m_headIndex >= tail)
+            return NULL;
+
+        // Publish the decremented tail before reading the head, so that a
+        // thief and the owner cannot both take the last element.
+        tail -= 1;
+        FastInterlockExchange(&m_tailIndex, tail);
+
+        if (m_headIndex <= tail)
+        {
+            LONG idx = tail & m_mask;
+            WorkRequest* workRequest = m_array[idx];
+            if (workRequest == NULL)
+                continue;
+
+            m_array[idx] = NULL;
+            return workRequest;
+        }
+
+        // We raced with a thief for the last element; settle it under the lock.
+        DangerousNonHostedSpinLockHolder lock(&m_foreignLock);
+
+        if (m_headIndex <= tail)
+        {
+            LONG idx = tail & m_mask;
+            WorkRequest* workRequest = m_array[idx];
+            if (workRequest == NULL)
+                continue;
+
+            m_array[idx] = NULL;
+            return workRequest;
+        }
+
+        // The thief won, restore the tail.
+        m_tailIndex = tail + 1;
+        return NULL;
+    }
+}
+
+// Called by any worker other than the owner. Takes the oldest request.
+WorkRequest* WorkRequestStealingQueue::TrySteal()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        MODE_ANY;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    while (true)
+    {
+        if (IsEmpty())
+            return NULL;
+
+        DangerousNonHostedSpinLockHolder lock(&m_foreignLock);
+
+        LONG head = m_headIndex;
+        FastInterlockExchange(&m_headIndex, head + 1);
+
+        if (head < m_tailIndex)
+        {
+            LONG idx = head & m_mask;
+            WorkRequest* workRequest = m_array[idx];
+            if (workRequest == NULL)
+                continue;
+
+            m_array[idx] = NULL;
+            return workRequest;
+        }
+
+        // The owner popped it first.
+        m_headIndex = head;
+        return NULL;
+    }
+}
+
+//--------------------------------------------------------------------------
+// Gives the calling worker thread a queue of its own. Workers that cannot
+// get a queue simply use the global queue.
+//
+void ThreadpoolMgr::AttachWorkerQueue()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        MODE_ANY;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(ClrFlsGetValue(TlsIdx_ThreadpoolWorkQueue) == NULL);
+
+    WorkRequestStealingQueue* queue = WorkRequestStealingQueue::Create();
+    if (queue == NULL)
+        return;
+
+    {
+        SimpleWriteLockHolder lock(WorkerQueueListLock);
+
+        queue->m_next = WorkerQueueList;
+        WorkerQueueList = queue;
+    }
+
+    ClrFlsSetValue(TlsIdx_ThreadpoolWorkQueue, queue);
+}
+
+//--------------------------------------------------------------------------
+// Frees the calling worker thread's queue. Once the queue is off the list no
+// thief can reach it, so whatever is left in it is moved to the global queue
+// and a thread is requested for it. The requests are already counted in the
+// unmanaged count, so only their location changes.
+//
+void ThreadpoolMgr::DetachWorkerQueue()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        MODE_ANY;
+        GC_TRIGGERS;
+    }
+    CONTRACTL_END;
+
+    WorkRequestStealingQueue* queue = (WorkRequestStealingQueue*)ClrFlsGetValue(TlsIdx_ThreadpoolWorkQueue);
+    if (queue == NULL)
+        return;
+
+    ClrFlsSetValue(TlsIdx_ThreadpoolWorkQueue, NULL);
+
+    {
+        SimpleWriteLockHolder lock(WorkerQueueListLock);
+
+        WorkRequestStealingQueue** link = &WorkerQueueList;
+        while (*link != queue)
+        {
+            _ASSERTE(*link != NULL);
+            link = &(*link)->m_next;
+        }
+        *link = queue->m_next;
+    }
+
+    UnManagedPerAppDomainTPCount* pADTPCount = PerAppDomainTPCountList::GetUnmanagedTPCount();
+    bool requeued = false;
+
+    WorkRequest* workRequest;
+    while ((workRequest = queue->LocalPop()) != NULL)
+    {
+        pADTPCount->RequeueUnmanagedWorkRequest(workRequest);
+        requeued = true;
+    }
+
+    delete queue;
+
+    if (requeued)
+        pADTPCount->SetAppDomainRequestsActive();
+}
+
+bool ThreadpoolMgr::PushLocalWorkRequest(WorkRequest* workRequest)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        MODE_ANY;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    WorkRequestStealingQueue* queue = (WorkRequestStealingQueue*)ClrFlsGetValue(TlsIdx_ThreadpoolWorkQueue);
+
+    return queue != NULL && queue->LocalPush(workRequest);
+}
+
+WorkRequest* ThreadpoolMgr::PopLocalWorkRequest()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        MODE_ANY;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    WorkRequestStealingQueue* queue = (WorkRequestStealingQueue*)ClrFlsGetValue(TlsIdx_ThreadpoolWorkQueue);
+
+    return queue != NULL ? queue->LocalPop() : NULL;
+}
+
+// Walks the other workers' queues, starting after our own so that thieves
+// spread out rather than all hitting the head of the list.
+WorkRequest* ThreadpoolMgr::StealWorkRequest()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        MODE_ANY;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    WorkRequestStealingQueue* own = (WorkRequestStealingQueue*)ClrFlsGetValue(TlsIdx_ThreadpoolWorkQueue);
+
+    // Holding the lock for reading keeps exiting workers from freeing the
+    // queues we walk; thieves do not block each other.
+    SimpleReadLockHolder lock(WorkerQueueListLock);
+
+    WorkRequestStealingQueue* start = (own != NULL && own->m_next != NULL) ? own->m_next : WorkerQueueList;
+    WorkRequestStealingQueue* queue = start;
+
+    if (queue == NULL)
+        return NULL;
+
+    do
+    {
+        if (queue != own)
+        {
+            WorkRequest* workRequest = queue->TrySteal();
+            if (workRequest != NULL)
+                return workRequest;
+        }
+
+        queue = (queue->m_next != NULL) ? queue->m_next : WorkerQueueList;
+    }
+    while (queue != start);
+
+    return NULL;
+}
+
 DWORD WINAPI ThreadpoolMgr::ExecuteHostRequest(PVOID pArg)
 {
     CONTRACTL
@@ -1853,6 +2418,8 @@ void ThreadpoolMgr::ExecuteWorkRequest(bool* foundWork, bool* wasNotRecalled)
         return;
     }
 
+    RecordThreadRequestServed();
+
     if(IsThreadPoolHosted()) 
     {
         //Only managed callBacks go this route under hosts.
@@ -1982,6 +2549,9 @@ void ThreadpoolMgr::ClearAppDomainRequestsActive(BOOL UnmanagedTP, BOOL AdUnload
     }
 
     pAdCount->ClearAppDomainRequestsActive();
+
+    if (!PerAppDomainTPCountList::AreRequestsPendingInAnyAppDomains())
+        RecordThreadRequestsCleared();
 }
 
 
@@ -2244,6 +2814,8 @@ DWORD __stdcall ThreadpoolMgr::WorkerThreadStart(LPVOID lpArgs)
     counts = WorkerCounter.GetCleanCounts();
     FireEtwThreadPoolWorkerThreadStart(counts.NumActive, counts.NumRetired, GetClrInstanceId());
 
+    AttachWorkerQueue();
+
 #ifdef FEATURE_COMINTEROP
     BOOL fCoInited = FALSE;
     // Threadpool threads should be initialized as MTA. If we are unable to do so,
@@ -2495,7 +3067,10 @@ RetryWaitForWork:
 
                 if (oldCounts == counts)
                 {
-                    HillClimbingInstance.ForceChange(newCounts.MaxWorking, ThreadTimedOut);
+                    if (UseLatencyController)
+                        LatencyControllerInstance.ForceChange(newCounts.MaxWorking, ThreadTimedOut);
+                    else
+                        HillClimbingInstance.ForceChange(newCounts.MaxWorking, ThreadTimedOut);
                     goto Exit;
                 }
 
@@ -2536,6 +3111,8 @@ Exit:
 
     _ASSERTE(!IsIoPending());
 
+    DetachWorkerQueue();
+
     counts = WorkerCounter.GetCleanCounts();
     FireEtwThreadPoolWorkerThreadStop(counts.NumActive, counts.NumRetired, GetClrInstanceId());
 
@@ -3157,11 +3734,7 @@ void ThreadpoolMgr::ProcessWaitCompletion(WaitInfo* waitInfo,
 
             InterlockedIncrement(&waitInfo->refCount);
 
-#ifndef FEATURE_PAL
             if (FALSE == PostQueuedCompletionStatus((LPOVERLAPPED)asyncCallback, (LPOVERLAPPED_COMPLETION_ROUTINE)WaitIOCompletionCallback))
-#else  // FEATURE_PAL
-            if (FALSE == QueueUserWorkItem(AsyncCallbackCompletion, asyncCallback, QUEUE_ONLY))
-#endif // !FEATURE_PAL
                 ReleaseAsyncCallback(asyncCallback);
         }
     }
@@ -3527,12 +4100,20 @@ BOOL ThreadpoolMgr::BindIoCompletionCallback(HANDLE FileHandle,
     }
     CONTRACTL_END;
 
-#ifndef FEATURE_PAL
-    
     errCode = S_OK;
 
     EnsureInitialized();
 
+#ifdef FEATURE_PAL
+    // Without epoll the PAL has no completion ports, so there is nothing to bind the handle to.
+    if (GlobalCompletionPort == NULL)
+    {
+        errCode = ERROR_CALL_NOT_IMPLEMENTED;
+        SetLastError(errCode);
+        return FALSE;
+    }
+#endif // FEATURE_PAL
+
 #ifdef FEATURE_INCLUDE_ALL_INTERFACES
     IHostIoCompletionManager *provider = CorHost2::GetHostIoCompletionManager();
     if (provider) {
@@ -3571,13 +4152,8 @@ BOOL ThreadpoolMgr::BindIoCompletionCallback(HANDLE FileHandle,
     _ASSERTE(h == GlobalCompletionPort);
 
     return TRUE;
-#else // FEATURE_PAL
-    SetLastError(ERROR_CALL_NOT_IMPLEMENTED);
-    return FALSE;
-#endif // !FEATURE_PAL
 }
 
-#ifndef FEATURE_PAL
 BOOL ThreadpoolMgr::CreateCompletionPortThread(LPVOID lpArgs)
 {
     CONTRACTL
@@ -3807,7 +4383,11 @@ Top:
         // for this case. We do this to "mark" the end of the previous workitem. When we provide full support at the higher
         // abstraction level for managed IO we can remove the IODequeues fired here
         if (ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_Context, ThreadPoolIODequeue)
-                && !AreEtwIOQueueEventsSpeciallyHandled((LPOVERLAPPED_COMPLETION_ROUTINE)key) && pOverlapped != NULL)
+                && !AreEtwIOQueueEventsSpeciallyHandled((LPOVERLAPPED_COMPLETION_ROUTINE)key) && pOverlapped != NULL
+#ifdef FEATURE_PAL
+                && pOverlapped != PAL_IOCP_READINESS_OVERLAPPED
+#endif // FEATURE_PAL
+                )
             FireEtwThreadPoolIODequeue(pOverlapped, (BYTE*)pOverlapped - offsetof(OverlappedDataObject, Internal), GetClrInstanceId());
 
         bool enterRetirement;
@@ -3944,6 +4524,8 @@ Top:
         // Parent process does not issue any ReadFile/WriteFile, and hence pOverlapped is going to be NULL.
         //_ASSERTE(pOverlapped != NULL);
 
+        // On the PAL, packets for the handles bound to the port carry PAL_IOCP_READINESS_OVERLAPPED
+        // rather than an overlapped, and are passed on to the callback the handle was bound with.
         if (pOverlapped != NULL)
         {
             _ASSERTE(key != 0);  // should be a valid function address
@@ -4110,6 +4692,13 @@ LPOVERLAPPED ThreadpoolMgr::CompletionPortDispatchWorkWithinAppDomain(
     {
         //_ASSERTE(FALSE);
     } 
+#ifdef FEATURE_PAL
+    else if (lpOverlapped == PAL_IOCP_READINESS_OVERLAPPED)
+    {
+        // A readiness packet has no managed overlapped. It is stored below and
+        // BindIoCompletionCallbackStub drops it.
+    }
+#endif // FEATURE_PAL
     else 
     {
         ManagedCallback = TRUE;
@@ -4259,7 +4848,6 @@ void ThreadpoolMgr::GrowCompletionPortThreadpoolIfNeeded()
         } 
     }
 }
-#endif // !FEATURE_PAL
 
 // Returns true if there is pending io on the thread.
 BOOL ThreadpoolMgr::IsIoPending()
@@ -4458,6 +5046,31 @@ public:
 #endif // !FEATURE_PAL
             __SwitchToThread(GATE_THREAD_DELAY, CALLER_LIMITS_SPINNING);
     }
+
+    //
+    // Waits for at most dwPollInterval milliseconds, and returns true if the tick that started at 
+    // dwTickStart has ended.
+    //
+    bool Wait(DWORD dwTickStart, DWORD dwPollInterval)
+    {
+        CONTRACTL
+        {
+            NOTHROW;
+            MODE_PREEMPTIVE;
+        }
+        CONTRACTL_END;
+
+#ifndef FEATURE_PAL
+        if (m_hTimer)
+            return WaitForSingleObject(m_hTimer, dwPollInterval) == WAIT_OBJECT_0;
+#endif // !FEATURE_PAL
+
+        DWORD elapsed = GetTickCount() - dwTickStart;
+        if (elapsed < GATE_THREAD_DELAY)
+            __SwitchToThread(min(dwPollInterval, GATE_THREAD_DELAY - elapsed), CALLER_LIMITS_SPINNING);
+
+        return GetTickCount() - dwTickStart >= GATE_THREAD_DELAY;
+    }
 };
 
 
@@ -4555,9 +5168,39 @@ DWORD __stdcall ThreadpoolMgr::GateThreadStart(LPVOID lpArgs)
 
     do
     {
-        timer.Wait();
+        if (UseLatencyController && !CLRThreadpoolHosted())
+        {
+            DWORD tickStart = GetTickCount();
+            DWORD latencyTarget = LatencyControllerInstance.GetLatencyTarget();
 
-        if(CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_EnableWorkerTracking))
+            while (true)
+            {
+                DWORD elapsed = GetTickCount() - tickStart;
+                if (elapsed < GATE_THREAD_DELAY && !PerAppDomainTPCountList::AreRequestsPendingInAnyAppDomains())
+                {
+                    //
+                    // Nothing is queued, so there is no latency to watch.  Sleep until the tick is
+                    // over, or until RecordThreadRequest wakes us because work was queued.
+                    //
+                    FastInterlockExchange(&GateThreadIdle, 1);
+                    if (!PerAppDomainTPCountList::AreRequestsPendingInAnyAppDomains())
+                        GateThreadWakeEvent->Wait(GATE_THREAD_DELAY - elapsed, FALSE);
+                    GateThreadIdle = 0;
+                    continue;
+                }
+
+                if (timer.Wait(tickStart, latencyTarget))
+                    break;
+
+                CheckWorkerQueueLatency();
+            }
+        }
+        else
+        {
+            timer.Wait();
+        }
+
+        if (IsWorkerTrackingEnabled())
             FireEtwThreadPoolWorkingThreadCount(TakeMaxWorkingThreadCount(), GetClrInstanceId());
 
 #ifdef DEBUGGING_SUPPORTED
@@ -4607,7 +5250,6 @@ DWORD __stdcall ThreadpoolMgr::GateThreadStart(LPVOID lpArgs)
             IgnoreNextSample = TRUE;
         }
 
-#ifndef FEATURE_PAL
         // don't mess with CP thread pool settings if not initialized yet
         if (InitCompletionPortThreadpool)
         {
@@ -4645,11 +5287,13 @@ DWORD __stdcall ThreadpoolMgr::GateThreadStart(LPVOID lpArgs)
                     errorCode = GetLastError();
                 }
 
+#ifndef FEATURE_PAL
                 if(pOverlapped == &overlappedForContinueCleanup)
                 {
                     // if we picked up a "Continue Drainage" notification DO NOT create a new CP thread
                 }
                 else 
+#endif // !FEATURE_PAL
                 if (errorCode != WAIT_TIMEOUT)
                 {
                     QueuedStatus *CompletionStatus = NULL;
@@ -4700,7 +5344,6 @@ DWORD __stdcall ThreadpoolMgr::GateThreadStart(LPVOID lpArgs)
                 }
             }
         }
-#endif // !FEATURE_PAL
 
         if (!CLRThreadpoolHosted() &&
             (0 == CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_DisableStarvationDetection)))
@@ -4726,7 +5369,10 @@ DWORD __stdcall ThreadpoolMgr::GateThreadStart(LPVOID lpArgs)
                     ThreadCounter::Counts oldCounts = WorkerCounter.CompareExchangeCounts(newCounts, counts);
                     if (oldCounts == counts)
                     {
-                        HillClimbingInstance.ForceChange(newCounts.MaxWorking, Starvation);
+                        if (UseLatencyController)
+                            LatencyControllerInstance.ForceChange(newCounts.MaxWorking, Starvation);
+                        else
+                            HillClimbingInstance.ForceChange(newCounts.MaxWorking, Starvation);
                         MaybeAddWorkingWorker();
                         break;
                     }
@@ -27,6 +27,8 @@ Revision History:
 #include "nativeoverlapped.h"
 #include "hillclimbing.h"
 
+class SimpleRWLock;
+
 #define MAX_WAITHANDLES 64
 
 #define MAX_CACHED_EVENTS 40        // upper limit on number of wait events cached 
@@ -85,6 +87,58 @@ struct WorkRequest {
 
 };
 
+/**
+ * A per-worker double ended queue of work requests, following the managed
+ * ThreadPool's WorkStealingQueue. The owning worker pushes and pops at the
+ * tail (LIFO) without taking a lock; other workers steal from the head (FIFO)
+ * under m_foreignLock. The owner only takes the lock when it races with a
+ * thief for the last element or has to grow the array.
+ */
+class WorkRequestStealingQueue
+{
+public:
+    static WorkRequestStealingQueue* Create();
+
+    WorkRequestStealingQueue()
+    {
+        LIMITED_METHOD_CONTRACT;
+        m_array = NULL;
+        m_mask = 0;
+        m_headIndex = 0;
+        m_tailIndex = 0;
+        m_next = NULL;
+    }
+
+    ~WorkRequestStealingQueue()
+    {
+        LIMITED_METHOD_CONTRACT;
+        delete [] m_array;
+    }
+
+    bool LocalPush(WorkRequest* workRequest);
+    WorkRequest* LocalPop();
+    WorkRequest* TrySteal();
+
+    inline bool IsEmpty()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return m_headIndex >= m_tailIndex;
+    }
+
+    // Next queue in ThreadpoolMgr::WorkerQueueList, guarded by
+    // ThreadpoolMgr::WorkerQueueListLock.
+    WorkRequestStealingQueue* m_next;
+
+private:
+    static const LONG InitialSize = 32;
+
+    WorkRequest** m_array;
+    LONG m_mask;
+    Volatile<LONG> m_headIndex;
+    Volatile<LONG> m_tailIndex;
+    DangerousNonHostedSpinLock m_foreignLock;
+};
+
 typedef struct _IOCompletionContext
 {
     DWORD ErrorCode;
@@ -104,6 +158,7 @@ class ThreadpoolMgr
     friend class ManagedPerAppDomainTPCount;
     friend class PerAppDomainTPCountList;
     friend class HillClimbing;
+    friend class LatencyController;
     friend struct _DacGlobals;
 
     //
@@ -440,6 +495,23 @@ public:
 
     static void ReportThreadStatus(bool isWorking);
 
+    // True if ReportThreadStatus is to be called around each work item; see WorkingThreadCounts.
+    inline static bool IsWorkerTrackingEnabled()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return WorkerTrackingEnabled;
+    }
+
+    // Called around blocking waits on worker threads when the latency controller is in use, so
+    // that it can tell how many workers are waiting rather than running.
+    static void ReportThreadBlocked(bool isBlocked);
+
+    inline static bool IsBlockedWorkerTrackingEnabled()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return UseLatencyController;
+    }
+
     // enumeration of different kinds of memory blocks that are recycled
     enum MemType
     {
@@ -520,6 +592,11 @@ public:
     static BOOL SetAppDomainRequestsActive(BOOL UnmanagedTP = FALSE);
     static void ClearAppDomainRequestsActive(BOOL UnmanagedTP = FALSE, BOOL AdUnloading = FALSE, LONG index = -1);
 
+    // Timestamps thread requests for the latency controller; see GetWorkerQueueDelay.
+    static void RecordThreadRequest();
+    static void RecordThreadRequestServed();
+    static void RecordThreadRequestsCleared();
+
     static inline void UpdateLastDequeueTime()
     {
         LIMITED_METHOD_CONTRACT;
@@ -556,10 +633,8 @@ public:
             return FALSE;
     }
 
-#ifndef FEATURE_PAL    
     static LPOVERLAPPED CompletionPortDispatchWorkWithinAppDomain(Thread* pThread, DWORD* pErrorCode, DWORD* pNumBytes, size_t* pKey, DWORD adid);
     static void StoreOverlappedInfoInThread(Thread* pThread, DWORD dwErrorCode, DWORD dwNumBytes, size_t key, LPOVERLAPPED lpOverlapped);
-#endif // !FEATURE_PAL
 
     // Enable filtering of correlation ETW events for cases handled at a higher abstraction level
 
@@ -1057,6 +1132,15 @@ public:
 
     static DWORD WINAPI ExecuteHostRequest(PVOID pArg);
 
+    static void AttachWorkerQueue();
+    static void DetachWorkerQueue();
+
+    // Work requests queued by a worker thread go to its own queue, so that
+    // work items spawning work items do not contend on the global queue.
+    static bool PushLocalWorkRequest(WorkRequest* workRequest);
+    static WorkRequest* PopLocalWorkRequest();
+    static WorkRequest* StealWorkRequest();
+
 #ifndef DACCESS_COMPILE
 
     inline static void AppendWorkRequest(WorkRequest* entry)
@@ -1146,6 +1230,10 @@ public:
     }
 
     static void AdjustMaxWorkersActive();
+    static void SetMaxWorkersActive(ThreadCounter::Counts currentCounts, int newMax);
+    static DWORD GetWorkerQueueDelay();
+    static int GetBlockedWorkerCount();
+    static void CheckWorkerQueueLatency();
     static bool ShouldWorkerKeepRunning();
 
     static BOOL SuspendProcessing();
@@ -1215,6 +1303,10 @@ public:
     } PROCESS_CPU_INFORMATION;
 
     static int GetCPUBusyTime_NT(PROCESS_CPU_INFORMATION* pOldInfo);
+#else
+    static int GetCPUBusyTime_NT(PAL_IOCP_CPU_INFORMATION* pOldInfo);
+#endif // !FEATURE_PAL
+
     static BOOL CreateCompletionPortThread(LPVOID lpArgs);
     static DWORD __stdcall CompletionPortThreadStart(LPVOID lpArgs);
 public:
@@ -1226,10 +1318,6 @@ public:
 
     static void GrowCompletionPortThreadpoolIfNeeded();
     static BOOL ShouldGrowCompletionPortThreadpool(ThreadCounter::Counts counts);
-#else
-    static int GetCPUBusyTime_NT(PAL_IOCP_CPU_INFORMATION* pOldInfo);
-
-#endif // !FEATURE_PAL
 
 private:
     static BOOL IsIoPending();
@@ -1298,6 +1386,23 @@ private:
     
     static HillClimbing HillClimbingInstance;
 
+    static bool UseLatencyController;                   // ThreadPool_UseLatencyController, replaces HillClimbingInstance
+    static LatencyController LatencyControllerInstance;
+    static bool WorkerTrackingEnabled;
+
+    static Volatile<LONG> NumBlockedWorkers;            // worker threads in a blocking wait, see ReportThreadBlocked
+
+    // The times at which the last ThreadRequestTimesSize thread requests were made, indexed by
+    // request number modulo the size. Requests are taken in the order they were made, so the oldest
+    // one still pending is ThreadRequestsServed.
+    static const LONG ThreadRequestTimesSize = 64;
+    static DWORD ThreadRequestTimes[ThreadRequestTimesSize];
+    static Volatile<LONG> ThreadRequestsMade;
+    static Volatile<LONG> ThreadRequestsServed;
+
+    static CLREvent * GateThreadWakeEvent;              // wakes an idle gate thread when work is queued, latency controller only
+    static Volatile<LONG> GateThreadIdle;
+
     static Volatile<LONG> PriorCompletedWorkRequests;
     static Volatile<DWORD> PriorCompletedWorkRequestsTime;
     static Volatile<DWORD> NextCompletedWorkRequestsTime;
@@ -1309,6 +1414,9 @@ private:
     SPTR_DECL(WorkRequest,WorkRequestHead);             // Head of work request queue
     SPTR_DECL(WorkRequest,WorkRequestTail);             // Head of work request queue
 
+    static WorkRequestStealingQueue* WorkerQueueList;   // per-worker queues, see AttachWorkerQueue
+    static SimpleRWLock* WorkerQueueListLock;           // taken for writing to add or remove a queue, for reading to steal
+
     static unsigned int LastCPThreadCreation;		// last time a completion port thread was created
     static unsigned int NumberOfProcessors;             // = NumberOfWorkerThreads - no. of blocked threads
 
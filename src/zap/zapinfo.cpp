@@ -4177,6 +4177,11 @@ unsigned ZapInfo::getClassGClayout(CORINFO_CLASS_HANDLE cls, BYTE *gcPtrs)
     return m_pEEJitInfo->getClassGClayout(cls, gcPtrs);
 }
 
+bool ZapInfo::getSystemVAmd64PassStructInRegisterDescriptor(CORINFO_CLASS_HANDLE cls, SYSTEMV_AMD64_CORINFO_STRUCT_REG_PASSING_DESCRIPTOR* structPassInRegDescPtr)
+{
+    return m_pEEJitInfo->getSystemVAmd64PassStructInRegisterDescriptor(cls, structPassInRegDescPtr);
+}
+
 unsigned ZapInfo::getClassNumInstanceFields(CORINFO_CLASS_HANDLE cls)
 {
     return m_pEEJitInfo->getClassNumInstanceFields(cls);
@@ -0,0 +1,100 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+//
+
+// Struct locals of sizes around the limits at which the JIT unrolls block initialization and
+// copies with 16 and 32 byte stores, and at which the prolog zeroes the frame with SSE2 stores
+// instead of "rep stos". Odd sizes leave remainders that are handled with smaller stores.
+
+using System;
+using System.Runtime.CompilerServices;
+public class BringUpTest
+{
+    const int Pass = 100;
+    const int Fail = -1;
+
+    public struct S24 { public long a, b; public int c, d; }
+    public struct S61 { public long a, b, c, d, e, f, g; public int h; public byte i; }
+    public struct S120 { public S24 a, b, c, d, e; }
+    public struct S136 { public S61 a; public S61 b; public long c, d; }
+    public struct S264 { public S120 a, b; public S24 c; }
+    public struct Refs { public object a, b, c, d, e, f, g, h; public long i, j, k; }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static void Fill24(ref S24 s) { s.a = 1; s.b = 2; s.c = 3; s.d = 4; }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static void Fill61(ref S61 s) { s.a = 1; s.b = 2; s.c = 3; s.d = 4; s.e = 5; s.f = 6; s.g = 7; s.h = 8; s.i = 9; }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static long Sum24(S24 s) { return s.a + s.b + s.c + s.d; }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static long Sum61(S61 s) { return s.a + s.b + s.c + s.d + s.e + s.f + s.g + s.h + s.i; }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static long Zeroed()
+    {
+        S24 a = new S24();
+        S61 b = new S61();
+        S120 c = new S120();
+        S136 d = new S136();
+        S264 e = new S264();
+        return Sum24(a) + Sum61(b) + Sum24(c.e) + Sum61(d.b) + d.d + Sum24(e.c) + Sum24(e.b.e);
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static long Copied()
+    {
+        S24 a = new S24();
+        Fill24(ref a);
+        S61 b = new S61();
+        Fill61(ref b);
+
+        S120 c = new S120();
+        c.a = a; c.e = a;
+        S120 c2 = c;
+
+        S136 d = new S136();
+        d.a = b; d.b = b; d.d = 10;
+        S136 d2 = d;
+
+        S264 e = new S264();
+        e.a = c2; e.b = c2; e.c = a;
+        S264 e2 = e;
+
+        return Sum24(c2.a) + Sum24(c2.e) + Sum61(d2.a) + Sum61(d2.b) + d2.d + Sum24(e2.a.e) + Sum24(e2.b.a) + Sum24(e2.c);
+    }
+
+    // The struct with object references must be zeroed in the prolog.
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static int PrologZeroed(int n)
+    {
+        Refs r1;
+        Refs r2;
+        int count = 0;
+        if (n > 0)
+        {
+            r1 = new Refs();
+            r1.a = "a";
+            r1.i = n;
+            r2 = r1;
+            count += (r2.a != null ? 1 : 0) + (int)r2.i;
+        }
+        GC.Collect();
+        return count;
+    }
+
+    public static int Main()
+    {
+        if (Zeroed() != 0) return Fail;
+        if (Copied() != 10 + 10 + 45 + 45 + 10 + 10 + 10 + 10) return Fail;
+
+        for (int i = 0; i < 3; i++)
+        {
+            if (PrologZeroed(i) != (i > 0 ? i + 1 : 0)) return Fail;
+        }
+
+        return Pass;
+    }
+}
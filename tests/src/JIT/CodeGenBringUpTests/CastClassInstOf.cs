@@ -0,0 +1,93 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+//
+
+// isinst and castclass to sealed and unsealed classes, with objects of the exact class,
+// of a derived class, of an unrelated class and null, so that both the inlined method
+// table check and the helper fallback are exercised.
+
+using System;
+using System.Runtime.CompilerServices;
+public class BringUpTest
+{
+    const int Pass = 100;
+    const int Fail = -1;
+
+    public class Base { public int x = 1; }
+    public class Derived : Base { }
+    public class MoreDerived : Derived { }
+    public sealed class Sealed : Base { }
+    public class Unrelated { }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static bool IsSealed(object o) { return o is Sealed; }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static bool IsDerived(object o) { return o is Derived; }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static Sealed CastSealed(object o) { return (Sealed)o; }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static Derived CastDerived(object o) { return (Derived)o; }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static int SumIfDerived(object[] a)
+    {
+        int sum = 0;
+        for (int i = 0; i < a.Length; i++)
+        {
+            Derived d = a[i] as Derived;
+            if (d != null) sum += d.x;
+        }
+        return sum;
+    }
+
+    public static bool CastSealedThrows(object o)
+    {
+        try
+        {
+            CastSealed(o);
+        }
+        catch (InvalidCastException)
+        {
+            return true;
+        }
+        return false;
+    }
+
+    public static bool CastDerivedThrows(object o)
+    {
+        try
+        {
+            CastDerived(o);
+        }
+        catch (InvalidCastException)
+        {
+            return true;
+        }
+        return false;
+    }
+
+    public static int Main()
+    {
+        object b = new Base();
+        object d = new Derived();
+        object m = new MoreDerived();
+        object s = new Sealed();
+        object u = new Unrelated();
+
+        if (!IsSealed(s) || IsSealed(b) || IsSealed(u) || IsSealed(null)) return Fail;
+        if (!IsDerived(d) || !IsDerived(m) || IsDerived(b) || IsDerived(s) || IsDerived(u) || IsDerived(null)) return Fail;
+
+        if (CastSealed(s) != s || CastSealed(null) != null) return Fail;
+        if (!CastSealedThrows(b) || !CastSealedThrows(u)) return Fail;
+
+        if (CastDerived(d) != d || CastDerived(m) != m || CastDerived(null) != null) return Fail;
+        if (!CastDerivedThrows(b) || !CastDerivedThrows(s) || !CastDerivedThrows(u)) return Fail;
+
+        if (SumIfDerived(new object[] { b, d, m, s, u, null, d }) != 3) return Fail;
+
+        return Pass;
+    }
+}
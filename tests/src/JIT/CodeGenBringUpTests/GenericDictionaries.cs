@@ -0,0 +1,177 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+//
+
+// Type lookups in shared generic code that need more slots than the first bucket of the
+// dictionary layout holds. The dictionaries of classes are also reached through derived types,
+// which inherit them, both from types loaded before the dictionary grows and after.
+
+using System;
+using System.Runtime.CompilerServices;
+public class BringUpTest
+{
+    const int Pass = 100;
+    const int Fail = -1;
+
+    class Box<T> { }
+    class Pair<T, U> { }
+
+    class Base<T>
+    {
+        [MethodImplAttribute(MethodImplOptions.NoInlining)]
+        public Type Few()
+        {
+            return typeof(Box<T>);
+        }
+
+        [MethodImplAttribute(MethodImplOptions.NoInlining)]
+        public Type[] Many()
+        {
+            return new Type[] {
+                typeof(T[]), typeof(Box<T>), typeof(Box<T[]>), typeof(Box<Box<T>>),
+                typeof(Pair<T, int>), typeof(Pair<int, T>), typeof(Pair<T, T>), typeof(Pair<Box<T>, T>),
+            };
+        }
+
+        [MethodImplAttribute(MethodImplOptions.NoInlining)]
+        public Type[] More()
+        {
+            return new Type[] {
+                typeof(T[,]), typeof(Box<T[,]>), typeof(Pair<T, string>), typeof(Pair<string, T>),
+                typeof(Box<Pair<T, T>>), typeof(Pair<T[], T>), typeof(Pair<T, T[]>), typeof(Box<Box<Box<T>>>),
+            };
+        }
+    }
+
+    class Derived : Base<string> { }
+    class LoadedEarly : Base<string> { }
+
+    class DerivedGeneric<U> : Base<U[]>
+    {
+        [MethodImplAttribute(MethodImplOptions.NoInlining)]
+        public Type[] Own()
+        {
+            return new Type[] {
+                typeof(U[]), typeof(Box<U>), typeof(Box<U[]>), typeof(Box<Box<U>>),
+                typeof(Pair<U, int>), typeof(Pair<int, U>), typeof(Pair<U, U>), typeof(Pair<Box<U>, U>),
+            };
+        }
+    }
+
+    class Leaf : DerivedGeneric<string> { }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    static Type[] FromMethod<T>()
+    {
+        return new Type[] {
+            typeof(T[]), typeof(Box<T>), typeof(Box<T[]>), typeof(Box<Box<T>>),
+            typeof(Pair<T, int>), typeof(Pair<int, T>), typeof(Pair<T, T>), typeof(Pair<Box<T>, T>),
+        };
+    }
+
+    static Type[] ManyOfString()
+    {
+        return new Type[] {
+            typeof(string[]), typeof(Box<string>), typeof(Box<string[]>), typeof(Box<Box<string>>),
+            typeof(Pair<string, int>), typeof(Pair<int, string>), typeof(Pair<string, string>), typeof(Pair<Box<string>, string>),
+        };
+    }
+
+    static Type[] MoreOfString()
+    {
+        return new Type[] {
+            typeof(string[,]), typeof(Box<string[,]>), typeof(Pair<string, string>), typeof(Pair<string, string>),
+            typeof(Box<Pair<string, string>>), typeof(Pair<string[], string>), typeof(Pair<string, string[]>), typeof(Box<Box<Box<string>>>),
+        };
+    }
+
+    static Type[] ManyOfObject()
+    {
+        return new Type[] {
+            typeof(object[]), typeof(Box<object>), typeof(Box<object[]>), typeof(Box<Box<object>>),
+            typeof(Pair<object, int>), typeof(Pair<int, object>), typeof(Pair<object, object>), typeof(Pair<Box<object>, object>),
+        };
+    }
+
+    static Type[] ManyOfStringArray()
+    {
+        return new Type[] {
+            typeof(string[][]), typeof(Box<string[]>), typeof(Box<string[][]>), typeof(Box<Box<string[]>>),
+            typeof(Pair<string[], int>), typeof(Pair<int, string[]>), typeof(Pair<string[], string[]>), typeof(Pair<Box<string[]>, string[]>),
+        };
+    }
+
+    static bool Same(Type[] actual, Type[] expected)
+    {
+        if (actual.Length != expected.Length)
+            return false;
+
+        for (int i = 0; i < actual.Length; i++)
+        {
+            if (actual[i] != expected[i])
+                return false;
+        }
+        return true;
+    }
+
+    public static int Main()
+    {
+        bool ok = true;
+
+        // Load a derived type while the dictionary of Base<string> still has its first bucket only
+        LoadedEarly early = new LoadedEarly();
+        ok &= (early.Few() == typeof(Box<string>));
+
+        // Grow the dictionary through another derived type, then use it from the base itself
+        Derived derived = new Derived();
+        for (int i = 0; i < 2; i++)
+        {
+            ok &= (derived.Few() == typeof(Box<string>));
+            ok &= Same(derived.Many(), ManyOfString());
+            ok &= Same(new Base<string>().Many(), ManyOfString());
+        }
+
+        // The type loaded early still holds the dictionary from before the growth
+        for (int i = 0; i < 2; i++)
+        {
+            ok &= Same(early.Many(), ManyOfString());
+            ok &= (early.Few() == typeof(Box<string>));
+        }
+
+        // Grow the layout again once the dictionaries have grown
+        for (int i = 0; i < 2; i++)
+        {
+            ok &= Same(new Base<string>().More(), MoreOfString());
+            ok &= Same(derived.More(), MoreOfString());
+            ok &= Same(early.More(), MoreOfString());
+            ok &= Same(derived.Many(), ManyOfString());
+        }
+
+        // Other instantiations of the same shared code have dictionaries of their own
+        for (int i = 0; i < 2; i++)
+        {
+            ok &= Same(new Base<object>().Many(), ManyOfObject());
+            ok &= Same(new Base<string[]>().Many(), ManyOfStringArray());
+            ok &= Same(derived.Many(), ManyOfString());
+        }
+
+        // A type that inherits two dictionaries, one of them from a generic parent
+        Leaf leaf = new Leaf();
+        for (int i = 0; i < 2; i++)
+        {
+            ok &= Same(leaf.Own(), ManyOfString());
+            ok &= Same(leaf.Many(), ManyOfStringArray());
+            ok &= Same(new DerivedGeneric<object>().Own(), ManyOfObject());
+        }
+
+        // Method dictionaries
+        for (int i = 0; i < 2; i++)
+        {
+            ok &= Same(FromMethod<string>(), ManyOfString());
+            ok &= Same(FromMethod<object>(), ManyOfObject());
+            ok &= Same(FromMethod<string[]>(), ManyOfStringArray());
+        }
+
+        return ok ? Pass : Fail;
+    }
+}
@@ -0,0 +1,148 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+//
+
+// Loops that index arrays with the loop variable plus a constant, directly or through a
+// local computed from it. Loop cloning removes their bounds checks when the limit leaves
+// room for the offset; the last cases run past either end of the array and must still throw.
+
+using System;
+using System.Runtime.CompilerServices;
+public class BringUpTest
+{
+    const int Pass = 100;
+    const int Fail = -1;
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static int SumAdjacent(int[] a, int n)
+    {
+        int sum = 0;
+        for (int i = 0; i < n - 1; i++)
+        {
+            sum += a[i] * a[i + 1];
+        }
+        return sum;
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static int SumDifferences(int[] a, int n)
+    {
+        int sum = 0;
+        for (int i = 1; i < n; i++)
+        {
+            sum += a[i] - a[i - 1];
+        }
+        return sum;
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static int SumShifted(int[] a, int[] b, int n)
+    {
+        int sum = 0;
+        for (int i = 0; i < n; i++)
+        {
+            int j = i + 2;
+            sum += a[j] + b[i];
+        }
+        return sum;
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static int SumWithNext(int[] a)
+    {
+        int sum = 0;
+        for (int i = 0; i < a.Length; i++)
+        {
+            sum += a[i];
+            if (i + 1 < a.Length)
+            {
+                sum += a[i + 1];
+            }
+        }
+        return sum;
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static int SumDifferencesFrom(int[] a, int start, int n)
+    {
+        int sum = 0;
+        for (int i = start; i < n; i++)
+        {
+            sum += a[i] - a[i - 1];
+        }
+        return sum;
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static int SumFarAway(int[] a, int n)
+    {
+        int sum = 0;
+        for (int i = 0; i < n; i++)
+        {
+            int j = i + 0x7ffffffe;
+            sum += a[j + 2];
+        }
+        return sum;
+    }
+
+    public static int Main()
+    {
+        int[] a = new int[10];
+        int[] b = new int[10];
+        for (int i = 0; i < a.Length; i++)
+        {
+            a[i] = i;
+            b[i] = 1;
+        }
+
+        // 0*1 + 1*2 + ... + 8*9
+        if (SumAdjacent(a, a.Length) != 240) return Fail;
+        if (SumDifferences(a, a.Length) != 9) return Fail;
+        // (2 + ... + 9) + 8
+        if (SumShifted(a, b, a.Length - 2) != 52) return Fail;
+        // a[i + 1] can't be in range on the last iteration, but a[i] still can
+        // (0 + ... + 9) + (1 + ... + 9)
+        if (SumWithNext(a) != 90) return Fail;
+        if (SumDifferencesFrom(a, 1, a.Length) != 9) return Fail;
+        if (SumDifferencesFrom(a, 3, 7) != 4) return Fail;
+
+        try
+        {
+            SumAdjacent(a, a.Length + 1);
+            return Fail;
+        }
+        catch (IndexOutOfRangeException)
+        {
+        }
+
+        try
+        {
+            SumShifted(a, b, a.Length - 1);
+            return Fail;
+        }
+        catch (IndexOutOfRangeException)
+        {
+        }
+
+        try
+        {
+            SumDifferencesFrom(a, 0, a.Length);
+            return Fail;
+        }
+        catch (IndexOutOfRangeException)
+        {
+        }
+
+        // The index wraps around to a negative number
+        try
+        {
+            SumFarAway(a, 1);
+            return Fail;
+        }
+        catch (IndexOutOfRangeException)
+        {
+        }
+
+        return Pass;
+    }
+}
@@ -0,0 +1,71 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+//
+
+// Reference stores into objects that were just allocated: inlined constructors, object
+// initializers, and stores separated from the allocation by a call that collects. The new
+// objects are kept in an old generation array and checked after further collections, so that
+// a missing card for an old-to-young reference would show up as a lost or moved object.
+
+using System;
+using System.Runtime.CompilerServices;
+public class BringUpTest
+{
+    const int Pass = 100;
+    const int Fail = -1;
+    const int Count = 1000;
+
+    public class Leaf { public int v; public Leaf(int v) { this.v = v; } }
+
+    public class Node
+    {
+        public Leaf left;
+        public Leaf right;
+        public object tag;
+        public Node(Leaf left, Leaf right) { this.left = left; this.right = right; }
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static Node MakeNode(int i)
+    {
+        return new Node(new Leaf(i), new Leaf(-i)) { tag = "node" };
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static Node MakeNodeWithCollect(int i)
+    {
+        Node n = new Node(null, null);
+        GC.Collect();
+        n.left = new Leaf(i);
+        n.right = new Leaf(-i);
+        n.tag = "node";
+        return n;
+    }
+
+    static bool Check(Node n, int i)
+    {
+        return n != null && n.left.v == i && n.right.v == -i && (string)n.tag == "node";
+    }
+
+    public static int Main()
+    {
+        Node[] nodes = new Node[Count];
+        GC.Collect();
+        GC.Collect();
+
+        for (int i = 0; i < Count; i++)
+        {
+            nodes[i] = ((i & 1) == 0) ? MakeNode(i) : MakeNodeWithCollect(i);
+            if ((i % 100) == 0) GC.Collect(0);
+        }
+
+        GC.Collect();
+
+        for (int i = 0; i < Count; i++)
+        {
+            if (!Check(nodes[i], i)) return Fail;
+        }
+
+        return Pass;
+    }
+}
@@ -0,0 +1,89 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+//
+
+// Readonly statics of primitive and object types that the JIT reads as constants when the
+// methods using them are compiled after the class constructor ran. They are used in branches
+// that become dead, in loops, and for null and non-null objects across a collection.
+
+using System;
+using System.Runtime.CompilerServices;
+public class BringUpTest
+{
+    const int Pass = 100;
+    const int Fail = -1;
+
+    public class Settings
+    {
+        public static readonly bool Enabled;
+        public static readonly int Size;
+        public static readonly long Big;
+        public static readonly double Scale;
+        public static readonly string Name;
+        public static readonly object Missing;
+        public static readonly int[] Table;
+
+        static Settings()
+        {
+            Enabled = Environment.TickCount != 0 || Environment.ProcessorCount > 0;
+            Size = 3 + Environment.ProcessorCount * 0;
+            Big = 1L << 40;
+            Scale = 0.5;
+            Name = new string('n', Size);
+            Missing = null;
+            Table = new int[] { 1, 2, 3, 4 };
+        }
+
+        [MethodImplAttribute(MethodImplOptions.NoInlining)]
+        public static void Touch() { }
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static int Branches()
+    {
+        int result = 0;
+        if (Settings.Enabled)
+            result += 1;
+        else
+            result -= 100;
+        if (Settings.Missing == null)
+            result += 2;
+        else
+            result -= 100;
+        if (Settings.Name != null)
+            result += Settings.Name.Length;
+        return result;
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static long Loop(int n)
+    {
+        long sum = 0;
+        for (int i = 0; i < n; i++)
+        {
+            sum += Settings.Table[i % Settings.Table.Length] * Settings.Size;
+            sum += (long)(i * Settings.Scale);
+        }
+        return sum + Settings.Big;
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static int LengthAfterCollect()
+    {
+        string name = Settings.Name;
+        GC.Collect();
+        GC.Collect();
+        return name.Length + Settings.Name.Length + (Object.ReferenceEquals(name, Settings.Name) ? 1 : 0);
+    }
+
+    public static int Main()
+    {
+        Settings.Touch();
+
+        if (Branches() != 6) return Fail;
+        if (Loop(8) != (1 + 2 + 3 + 4) * 2 * 3 + (0 + 0 + 1 + 1 + 2 + 2 + 3 + 3) + (1L << 40)) return Fail;
+        if (LengthAfterCollect() != 7) return Fail;
+
+        return Pass;
+    }
+}
@@ -0,0 +1,98 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+//
+
+// Structs of 9 to 16 bytes made only of integer fields, which the System V AMD64 ABI passes
+// in two integer registers. They are passed from locals, fields and array elements, after
+// enough other arguments that they no longer fit in registers, through a delegate, and with
+// object references in them across a collection in the callee.
+
+using System;
+using System.Runtime.CompilerServices;
+public class BringUpTest
+{
+    const int Pass = 100;
+    const int Fail = -1;
+
+    public struct Pair
+    {
+        public object key;
+        public long value;
+        public Pair(object key, long value) { this.key = key; this.value = value; }
+    }
+
+    public struct LongInt
+    {
+        public long a;
+        public int b;
+        public LongInt(long a, int b) { this.a = a; this.b = b; }
+    }
+
+    public class Holder
+    {
+        public Pair pair;
+        public LongInt longInt;
+    }
+
+    public delegate long PairDelegate(Pair p, LongInt l);
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static long Sum(Pair p, LongInt l)
+    {
+        return ((string)p.key).Length + p.value + l.a + l.b;
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static long SumWithCollect(Pair p, int x, Pair q)
+    {
+        GC.Collect();
+        GC.Collect();
+        return ((string)p.key).Length + p.value + x + ((string)q.key).Length + q.value;
+    }
+
+    // The first five integer arguments leave one register, so l goes on the stack and the
+    // last argument still takes the remaining register.
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static long ManyArgs(int a, int b, int c, int d, int e, LongInt l, int f, Pair p)
+    {
+        return a + b + c + d + e + l.a + l.b + f + ((string)p.key).Length + p.value;
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static LongInt Make(long a, int b)
+    {
+        return new LongInt(a, b);
+    }
+
+    public static int Main()
+    {
+        Pair p = new Pair("abc", 10);
+        LongInt l = new LongInt(100, 1000);
+
+        if (Sum(p, l) != 1113) return Fail;
+
+        if (SumWithCollect(new Pair(new string('x', 4), 20), 1, new Pair(new string('y', 5), 30)) != 60) return Fail;
+
+        if (ManyArgs(1, 2, 3, 4, 5, l, 6, p) != 1134) return Fail;
+        if (ManyArgs(1, 2, 3, 4, 5, Make(7, 8), 6, p) != 49) return Fail;
+
+        Holder h = new Holder();
+        h.pair = p;
+        h.longInt = l;
+        if (Sum(h.pair, h.longInt) != 1113) return Fail;
+
+        Pair[] pairs = new Pair[] { new Pair("a", 1), new Pair("bb", 2) };
+        LongInt[] longInts = new LongInt[] { new LongInt(3, 4), new LongInt(5, 6) };
+        long total = 0;
+        for (int i = 0; i < pairs.Length; i++)
+        {
+            total += Sum(pairs[i], longInts[i]);
+        }
+        if (total != 1 + 1 + 3 + 4 + 2 + 2 + 5 + 6) return Fail;
+
+        PairDelegate d = Sum;
+        if (d(p, l) != 1113) return Fail;
+
+        return Pass;
+    }
+}
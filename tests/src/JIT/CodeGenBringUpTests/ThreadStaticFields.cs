@@ -0,0 +1,112 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+//
+
+// Thread static fields of more classes than the runtime caches per thread, used in turn so
+// that their bases evict each other, across collections and from two threads.
+
+using System;
+using System.Runtime.CompilerServices;
+using System.Threading;
+public class BringUpTest
+{
+    const int Pass = 100;
+    const int Fail = -1;
+    const int Rounds = 100;
+
+    class Plain
+    {
+        [ThreadStatic] public static int Count;
+        [ThreadStatic] public static string Name;
+    }
+
+    class Slot<T>
+    {
+        [ThreadStatic] public static int Count;
+        [ThreadStatic] public static string Name;
+    }
+
+    class A { }
+    class B { }
+    class C { }
+    class D { }
+    class E { }
+    class F { }
+    class G { }
+    class H { }
+    class I { }
+    class J { }
+    class K { }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    static void Touch<T>(string name)
+    {
+        Slot<T>.Count++;
+        Slot<T>.Name = name;
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    static bool Check<T>(int count, string name)
+    {
+        return Slot<T>.Count == count && Slot<T>.Name == name;
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    static void TouchAll(string name)
+    {
+        Plain.Count++;
+        Plain.Name = name;
+        Touch<A>(name + "A"); Touch<B>(name + "B"); Touch<C>(name + "C"); Touch<D>(name + "D");
+        Touch<E>(name + "E"); Touch<F>(name + "F"); Touch<G>(name + "G"); Touch<H>(name + "H");
+        Touch<I>(name + "I"); Touch<J>(name + "J"); Touch<K>(name + "K");
+        Touch<int>(name + "int"); Touch<string>(name + "string");
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    static bool CheckAll(int count, string name)
+    {
+        bool ok = Plain.Count == count && Plain.Name == name;
+        ok &= Check<A>(count, name + "A") && Check<B>(count, name + "B") && Check<C>(count, name + "C");
+        ok &= Check<D>(count, name + "D") && Check<E>(count, name + "E") && Check<F>(count, name + "F");
+        ok &= Check<G>(count, name + "G") && Check<H>(count, name + "H") && Check<I>(count, name + "I");
+        ok &= Check<J>(count, name + "J") && Check<K>(count, name + "K");
+        ok &= Check<int>(count, name + "int") && Check<string>(count, name + "string");
+        return ok;
+    }
+
+    static bool Run(string name)
+    {
+        // A fresh thread sees default values
+        bool ok = Plain.Count == 0 && Plain.Name == null && Slot<A>.Count == 0 && Slot<string>.Name == null;
+
+        for (int i = 1; i <= Rounds; i++)
+        {
+            TouchAll(name);
+            ok &= CheckAll(i, name);
+
+            // The object statics live on the GC heap and may move
+            if (i % 10 == 0)
+            {
+                GC.Collect();
+                ok &= CheckAll(i, name);
+            }
+        }
+        return ok;
+    }
+
+    public static int Main()
+    {
+        bool ok = Run("main");
+
+        bool otherOk = false;
+        Thread other = new Thread(() => otherOk = Run("other"));
+        other.Start();
+        other.Join();
+        ok &= otherOk;
+
+        // The other thread left the statics of this one alone
+        ok &= CheckAll(Rounds, "main");
+
+        return ok ? Pass : Fail;
+    }
+}
@@ -0,0 +1,107 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+//
+
+// Casts to variant interfaces and covariant arrays, which the runtime decides in its cast cache.
+
+using System;
+using System.Collections.Generic;
+using System.Runtime.CompilerServices;
+public class BringUpTest
+{
+    const int Pass = 100;
+    const int Fail = -1;
+    const int Depth = 48;
+
+    interface IProducer<out T> { T Get(); }
+    class Producer<T> : IProducer<T> where T : class
+    {
+        public T Get() { return null; }
+    }
+    class G<T> { }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    static bool IsProducerOfObject(object o) { return o is IProducer<object>; }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    static bool IsProducerOfString(object o) { return o is IProducer<string>; }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    static bool IsEnumerableOfObject(object o) { return o is IEnumerable<object>; }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    static bool IsObjectArray(object o) { return o is object[]; }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    static bool IsStringArray(object o) { return o is string[]; }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    static bool CastsToProducerOfObject(object o)
+    {
+        try
+        {
+            IProducer<object> p = (IProducer<object>)o;
+            return p != null;
+        }
+        catch (InvalidCastException)
+        {
+            return false;
+        }
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    static bool StoresInto(object[] a, object o)
+    {
+        try
+        {
+            a[0] = o;
+            return true;
+        }
+        catch (ArrayTypeMismatchException)
+        {
+            return false;
+        }
+    }
+
+    // Every level has its own types, so each one adds new source/target pairs to the runtime's
+    // cast cache; Depth levels are more pairs than the cache starts out with.
+    static int Check<T>(int depth)
+    {
+        object producer = new Producer<G<T>>();
+        object array = new G<T>[1];
+        object notProducer = new G<T>();
+        int failures = 0;
+
+        if (!IsProducerOfObject(producer)) failures++;
+        if (IsProducerOfString(producer)) failures++;
+        if (IsProducerOfObject(notProducer)) failures++;
+        if (IsEnumerableOfObject(producer)) failures++;
+        if (!IsEnumerableOfObject(array)) failures++;
+        if (!IsObjectArray(array)) failures++;
+        if (IsStringArray(array)) failures++;
+        if (!CastsToProducerOfObject(producer)) failures++;
+        if (CastsToProducerOfObject(notProducer)) failures++;
+        if (!StoresInto((object[])array, new G<T>())) failures++;
+        if (StoresInto((object[])array, "not a G")) failures++;
+
+        if (depth > 0)
+        {
+            failures += Check<G<T>>(depth - 1);
+        }
+        return failures;
+    }
+
+    public static int Main()
+    {
+        // The second pass finds the results cached by the first one.
+        int failures = Check<object>(Depth);
+        failures += Check<object>(Depth);
+
+        if (failures != 0)
+        {
+            Console.WriteLine("{0} casts gave the wrong result", failures);
+            return Fail;
+        }
+        return Pass;
+    }
+}
@@ -0,0 +1,126 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+//
+
+// Simple array loops of the shape the loop vectorizer handles, checked against element-by-element
+// results for lengths with and without a scalar remainder. The vectorizer is off by default, so
+// the project runs the test with COMPlus_JitVectorizeLoops=1.
+
+using System;
+using System.Runtime.CompilerServices;
+public class BringUpTest
+{
+    const int Pass = 100;
+    const int Fail = -1;
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static void IntAdd(int []a, int []b, int []c, int n)
+    {
+        for (int i = 0; i < n; i++)
+            a[i] = b[i] + c[i];
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static void IntMulAddInPlace(int []a, int []b, int k)
+    {
+        for (int i = 0; i < a.Length; i++)
+            a[i] = a[i] * k + b[i];
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static void FltScale(float []a, float []b, float s, int start, int end)
+    {
+        for (int i = start; i < end; i++)
+            a[i] = b[i] * s;
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static void DblDivSub(double []a, double []b, double []c)
+    {
+        for (int i = 0; i < a.Length; i++)
+            a[i] = (b[i] - c[i]) / 2.0;
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static void DblDiv(double []a, double []b, double []c)
+    {
+        for (int i = 0; i < a.Length; i++)
+            a[i] = b[i] / c[i];
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static void FltDiv(float []a, float []b, float d)
+    {
+        for (int i = 0; i < a.Length; i++)
+            a[i] = b[i] / d;
+    }
+
+    public static int Main()
+    {
+        for (int n = 0; n < 38; n++)
+        {
+            int []ia = new int[n];
+            int []ib = new int[n];
+            int []ic = new int[n];
+            float []fa = new float[n];
+            float []fb = new float[n];
+            double []da = new double[n];
+            double []db = new double[n];
+            double []dc = new double[n];
+            for (int i = 0; i < n; i++)
+            {
+                ib[i] = i * 3 - 7;
+                ic[i] = 100 - i;
+                fb[i] = i * 0.5f;
+                db[i] = i * 4.0;
+                dc[i] = i;
+            }
+
+            IntAdd(ia, ib, ic, n);
+            for (int i = 0; i < n; i++)
+            {
+                if (ia[i] != ib[i] + ic[i]) return Fail;
+            }
+
+            // "a" is both read and written.
+            IntMulAddInPlace(ia, ib, 3);
+            for (int i = 0; i < n; i++)
+            {
+                if (ia[i] != (ib[i] + ic[i]) * 3 + ib[i]) return Fail;
+            }
+
+            // Elements outside [start, end) must be left alone.
+            int start = n / 3;
+            FltScale(fa, fb, 2.0f, start, n);
+            for (int i = 0; i < n; i++)
+            {
+                if (fa[i] != ((i < start) ? 0.0f : i * 1.0f)) return Fail;
+            }
+
+            DblDivSub(da, db, dc);
+            for (int i = 0; i < n; i++)
+            {
+                if (da[i] != i * 1.5) return Fail;
+            }
+
+            // Element-wise double division with inexact quotients must round like the scalar divide.
+            for (int i = 0; i < n; i++)
+            {
+                dc[i] = i * 0.75 + 3.0;
+            }
+            DblDiv(da, db, dc);
+            for (int i = 0; i < n; i++)
+            {
+                if (da[i] != db[i] / dc[i]) return Fail;
+            }
+
+            FltDiv(fa, fb, 3.0f);
+            for (int i = 0; i < n; i++)
+            {
+                if (fa[i] != fb[i] / 3.0f) return Fail;
+            }
+        }
+
+        return Pass;
+    }
+}
@@ -0,0 +1,128 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+//
+
+// COMPlus_CastCacheMaxEntries=0 turns the cast cache off; compare against a run without it.
+//
+// Each loop repeats one cast the JIT helpers hand to the runtime: isinst and castclass to a
+// variant interface, isinst to a covariant array type, and stores into a covariant array.
+
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Runtime.CompilerServices;
+public class CastCacheBench
+{
+    const int Pass = 100;
+    const int Fail = -1;
+    const int Iterations = 1000000;
+
+    interface IProducer<out T> { T Get(); }
+    class Producer<T> : IProducer<T> where T : class
+    {
+        public T Get() { return null; }
+    }
+    class Animal { }
+    class Cat : Animal { }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static int CountVariant(object[] objs)
+    {
+        int count = 0;
+        for (int i = 0; i < Iterations; i++)
+        {
+            if (objs[i & 3] is IProducer<Animal>) count++;
+        }
+        return count;
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static int CountEnumerable(object[] objs)
+    {
+        int count = 0;
+        for (int i = 0; i < Iterations; i++)
+        {
+            if (objs[i & 3] is IEnumerable<object>) count++;
+        }
+        return count;
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static int CountCovariantArray(object[] objs)
+    {
+        int count = 0;
+        for (int i = 0; i < Iterations; i++)
+        {
+            if (objs[i & 3] is Animal[]) count++;
+        }
+        return count;
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static int CastVariant(object o)
+    {
+        int count = 0;
+        for (int i = 0; i < Iterations; i++)
+        {
+            IProducer<object> p = (IProducer<object>)o;
+            if (p != null) count++;
+        }
+        return count;
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static void StoreCovariant(Animal[] a, Cat c)
+    {
+        for (int i = 0; i < Iterations; i++)
+        {
+            a[i & 7] = c;
+        }
+    }
+
+    static bool Run(string name, Func<int> f, int expected)
+    {
+        Stopwatch sw = Stopwatch.StartNew();
+        int result = f();
+        sw.Stop();
+        Console.WriteLine("{0,-24} {1,8} ms", name, sw.ElapsedMilliseconds);
+        return result == expected;
+    }
+
+    public static int Main()
+    {
+        // Two of the four objects pass each test.
+        object[] producers = new object[] { new Producer<Cat>(), new Producer<string>(), new Producer<Animal>(), new object() };
+        object[] lists = new object[] { new List<string>(), new List<int>(), new Cat[0], new int[0] };
+        object[] arrays = new object[] { new Cat[1], new object[1], new Animal[1], new string[1] };
+
+        bool ok = true;
+        ok &= Run("isinst variant", () => CountVariant(producers), Iterations / 2);
+        ok &= Run("isinst IEnumerable<object>", () => CountEnumerable(lists), Iterations / 2);
+        ok &= Run("isinst covariant array", () => CountCovariantArray(arrays), Iterations / 2);
+        ok &= Run("castclass variant", () => CastVariant(new Producer<Cat>()), Iterations);
+        ok &= Run("stelem covariant", () => { StoreCovariant(new Cat[8], new Cat()); return 0; }, 0);
+
+        try
+        {
+            if (CastVariant(new Producer<Exception[]>()) != Iterations) ok = false;
+            CastVariant(new List<object>());
+            ok = false;
+        }
+        catch (InvalidCastException)
+        {
+        }
+
+        try
+        {
+            StoreCovariant(new Cat[8], null);
+            Animal[] a = new Cat[1];
+            a[0] = new Animal();
+            ok = false;
+        }
+        catch (ArrayTypeMismatchException)
+        {
+        }
+
+        return ok ? Pass : Fail;
+    }
+}
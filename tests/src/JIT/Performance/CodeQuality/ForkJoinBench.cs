@@ -0,0 +1,68 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+//
+
+// Fork/join on the thread pool: every task below the cutoff splits its range in two, queues
+// both halves from the worker it runs on and waits for them. This keeps every worker queueing
+// work for itself while idle workers look for work to steal, and makes the pool's thread
+// requests track a queue that fills and drains in bursts.
+//
+// Only managed work items can be queued from here; native work requests share the worker
+// threads and the scheduling of thread requests, but not the managed queues.
+
+using System;
+using System.Diagnostics;
+using System.Threading.Tasks;
+public class ForkJoinBench
+{
+    const int Pass = 100;
+    const int Fail = -1;
+    const int Iterations = 20;
+    const int Leaves = 1 << 16;
+
+    static long Sum(int lo, int hi, int cutoff)
+    {
+        if (hi - lo <= cutoff)
+        {
+            long sum = 0;
+            for (int i = lo; i < hi; i++)
+            {
+                sum += i;
+            }
+            return sum;
+        }
+
+        int mid = lo + (hi - lo) / 2;
+        Task<long> left = Task.Run(() => Sum(lo, mid, cutoff));
+        Task<long> right = Task.Run(() => Sum(mid, hi, cutoff));
+        return left.Result + right.Result;
+    }
+
+    static bool Run(int cutoff)
+    {
+        long expected = (long)Leaves * (Leaves - 1) / 2;
+        bool ok = true;
+
+        Stopwatch sw = Stopwatch.StartNew();
+        for (int i = 0; i < Iterations; i++)
+        {
+            ok &= (Sum(0, Leaves, cutoff) == expected);
+        }
+        sw.Stop();
+
+        Console.WriteLine("cutoff {0,6} {1,8} ms", cutoff, sw.ElapsedMilliseconds);
+        return ok;
+    }
+
+    public static int Main()
+    {
+        bool ok = true;
+
+        // From many tiny tasks to a few large ones
+        ok &= Run(16);
+        ok &= Run(256);
+        ok &= Run(4096);
+
+        return ok ? Pass : Fail;
+    }
+}
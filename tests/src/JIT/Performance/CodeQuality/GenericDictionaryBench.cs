@@ -0,0 +1,87 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+//
+
+// Type lookups in shared generic code, from the dictionary of a class and from that of a method.
+//
+// Each method needs twelve types, more than the first bucket of its dictionary layout holds, so
+// most lookups go to slots that only exist once the dictionary of the instantiation has grown.
+
+using System;
+using System.Diagnostics;
+using System.Runtime.CompilerServices;
+public class GenericDictionaryBench
+{
+    const int Pass = 100;
+    const int Fail = -1;
+    const int Iterations = 200000;
+
+    class Box<T> { }
+    class Pair<T, U> { }
+
+    class Lookups<T>
+    {
+        [MethodImplAttribute(MethodImplOptions.NoInlining)]
+        public static Type[] FromClass()
+        {
+            return new Type[] {
+                typeof(T[]), typeof(T[,]), typeof(Box<T>), typeof(Box<T[]>),
+                typeof(Box<Box<T>>), typeof(Pair<T, int>), typeof(Pair<int, T>), typeof(Pair<T, T>),
+                typeof(Pair<T, string>), typeof(Box<T[,]>), typeof(Pair<Box<T>, T>), typeof(Box<Pair<T, T>>),
+            };
+        }
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static Type[] FromMethod<T>()
+    {
+        return new Type[] {
+            typeof(T[]), typeof(T[,]), typeof(Box<T>), typeof(Box<T[]>),
+            typeof(Box<Box<T>>), typeof(Pair<T, int>), typeof(Pair<int, T>), typeof(Pair<T, T>),
+            typeof(Pair<T, string>), typeof(Box<T[,]>), typeof(Pair<Box<T>, T>), typeof(Box<Pair<T, T>>),
+        };
+    }
+
+    static Type[] Expected()
+    {
+        return new Type[] {
+            typeof(string[]), typeof(string[,]), typeof(Box<string>), typeof(Box<string[]>),
+            typeof(Box<Box<string>>), typeof(Pair<string, int>), typeof(Pair<int, string>), typeof(Pair<string, string>),
+            typeof(Pair<string, string>), typeof(Box<string[,]>), typeof(Pair<Box<string>, string>), typeof(Box<Pair<string, string>>),
+        };
+    }
+
+    static bool Run(string name, Func<Type[]> f)
+    {
+        Type[] expected = Expected();
+        bool ok = true;
+
+        Stopwatch sw = Stopwatch.StartNew();
+        for (int i = 0; i < Iterations; i++)
+        {
+            Type[] types = f();
+            for (int j = 0; j < types.Length; j++)
+            {
+                ok &= (types[j] == expected[j]);
+            }
+        }
+        sw.Stop();
+
+        Console.WriteLine("{0,-24} {1,8} ms", name, sw.ElapsedMilliseconds);
+        return ok;
+    }
+
+    public static int Main()
+    {
+        bool ok = true;
+
+        ok &= Run("class dictionary", Lookups<string>.FromClass);
+        ok &= Run("method dictionary", FromMethod<string>);
+
+        // Another instantiation of the same shared code gets its own handles
+        ok &= (Lookups<object>.FromClass()[2] == typeof(Box<object>));
+        ok &= (FromMethod<object>()[11] == typeof(Box<Pair<object, object>>));
+
+        return ok ? Pass : Fail;
+    }
+}
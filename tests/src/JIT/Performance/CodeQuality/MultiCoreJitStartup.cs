@@ -0,0 +1,93 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+//
+
+// Startup benchmark for multi-core JIT profile playback. Each Step method is jitted on first call.
+// Without arguments the test records a profile in a new directory, so every run starts from the same
+// state. To measure playback, pass a directory as the first argument and run twice: the first run
+// records the profile there, the second plays it back and compiles the methods in the background
+// before the main thread reaches them. Compare the second run with COMPlus_MultiCoreJitThreads=1 and
+// with more threads.
+
+using System;
+using System.Diagnostics;
+using System.IO;
+using System.Runtime.CompilerServices;
+using System.Runtime.Loader;
+public class MultiCoreJitStartup
+{
+    const int Pass = 100;
+    const int Fail = -1;
+    const string ProfileName = "MultiCoreJitStartup.profile";
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step0(int x) { return x * 1 + 0; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step1(int x) { return x * 2 + 1; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step2(int x) { return x * 3 + 2; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step3(int x) { return x * 4 + 3; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step4(int x) { return x * 5 + 4; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step5(int x) { return x * 6 + 5; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step6(int x) { return x * 7 + 6; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step7(int x) { return x * 8 + 7; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step8(int x) { return x * 9 + 8; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step9(int x) { return x * 10 + 9; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step10(int x) { return x * 11 + 10; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step11(int x) { return x * 12 + 11; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step12(int x) { return x * 13 + 12; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step13(int x) { return x * 14 + 13; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step14(int x) { return x * 15 + 14; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step15(int x) { return x * 16 + 15; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step16(int x) { return x * 17 + 16; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step17(int x) { return x * 18 + 17; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step18(int x) { return x * 19 + 18; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step19(int x) { return x * 20 + 19; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step20(int x) { return x * 21 + 20; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step21(int x) { return x * 22 + 21; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step22(int x) { return x * 23 + 22; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step23(int x) { return x * 24 + 23; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step24(int x) { return x * 25 + 24; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step25(int x) { return x * 26 + 25; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step26(int x) { return x * 27 + 26; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step27(int x) { return x * 28 + 27; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step28(int x) { return x * 29 + 28; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step29(int x) { return x * 30 + 29; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step30(int x) { return x * 31 + 30; }
+    [MethodImplAttribute(MethodImplOptions.NoInlining)] static int Step31(int x) { return x * 32 + 31; }
+
+    static Func<int, int>[] Steps()
+    {
+        return new Func<int, int>[] {
+            Step0, Step1, Step2, Step3, Step4, Step5, Step6, Step7,
+            Step8, Step9, Step10, Step11, Step12, Step13, Step14, Step15,
+            Step16, Step17, Step18, Step19, Step20, Step21, Step22, Step23,
+            Step24, Step25, Step26, Step27, Step28, Step29, Step30, Step31,
+        };
+    }
+
+    public static int Main(string[] args)
+    {
+        string root = (args.Length > 0) ? args[0] : Path.Combine(Path.GetTempPath(), Path.GetRandomFileName());
+        Directory.CreateDirectory(root);
+        bool playback = File.Exists(Path.Combine(root, ProfileName));
+
+        Stopwatch sw = Stopwatch.StartNew();
+
+        AssemblyLoadContext.Default.SetProfileOptimizationRoot(root);
+        AssemblyLoadContext.Default.StartProfileOptimization(ProfileName);
+
+        Func<int, int>[] steps = Steps();
+        bool ok = true;
+
+        for (int i = 0; i < steps.Length; i++)
+        {
+            for (int x = 0; x < 8; x++)
+            {
+                ok &= (steps[i](x) == x * (i + 1) + i);
+            }
+        }
+
+        sw.Stop();
+
+        Console.WriteLine("{0,-24} {1,8} ms", playback ? "profile playback" : "profile recording", sw.ElapsedMilliseconds);
+        return ok ? Pass : Fail;
+    }
+}
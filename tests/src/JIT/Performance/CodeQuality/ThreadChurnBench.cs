@@ -0,0 +1,79 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+//
+
+// Thread creation and exit, alone and while another thread keeps collecting. Every thread
+// that starts or exits adds itself to or removes itself from the runtime's thread store,
+// and every collection walks the store to scan the stacks and allocation contexts; the
+// second case shows how much the two get in each other's way.
+
+using System;
+using System.Diagnostics;
+using System.Threading;
+public class ThreadChurnBench
+{
+    const int Pass = 100;
+    const int Fail = -1;
+    const int Batches = 50;
+    const int BatchSize = 64;
+
+    static int s_ran;
+    static volatile bool s_stop;
+
+    static void Body()
+    {
+        // Leave something in the allocation context for the collections to find.
+        object[] o = new object[4];
+        o[0] = o;
+        Interlocked.Increment(ref s_ran);
+    }
+
+    static bool Run(string name, bool collect)
+    {
+        Thread collector = null;
+        int collections = GC.CollectionCount(0);
+
+        s_ran = 0;
+        s_stop = false;
+        if (collect)
+        {
+            collector = new Thread(() => { while (!s_stop) GC.Collect(0); });
+            collector.Start();
+        }
+
+        Stopwatch sw = Stopwatch.StartNew();
+        Thread[] threads = new Thread[BatchSize];
+        for (int i = 0; i < Batches; i++)
+        {
+            for (int j = 0; j < BatchSize; j++)
+            {
+                threads[j] = new Thread(Body);
+                threads[j].Start();
+            }
+            for (int j = 0; j < BatchSize; j++)
+            {
+                threads[j].Join();
+            }
+        }
+        sw.Stop();
+
+        if (collector != null)
+        {
+            s_stop = true;
+            collector.Join();
+        }
+
+        Console.WriteLine("{0,-20} {1,8} ms {2,8} gen0 GCs", name, sw.ElapsedMilliseconds, GC.CollectionCount(0) - collections);
+        return s_ran == Batches * BatchSize;
+    }
+
+    public static int Main()
+    {
+        bool ok = true;
+
+        ok &= Run("threads only", false);
+        ok &= Run("threads and GCs", true);
+
+        return ok ? Pass : Fail;
+    }
+}
@@ -0,0 +1,113 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+//
+
+// COMPlus_ThreadStaticCache=0 stops the thread static helpers from caching the statics bases.
+//
+// Reads and writes of thread static ints and objects, in a plain class and in a generic one,
+// first on the main thread and then on a second thread that starts with empty statics.
+
+using System;
+using System.Diagnostics;
+using System.Runtime.CompilerServices;
+using System.Threading;
+public class ThreadStaticBench
+{
+    const int Pass = 100;
+    const int Fail = -1;
+    const int Iterations = 1000000;
+
+    class Counters
+    {
+        [ThreadStatic] public static int Count;
+        [ThreadStatic] public static object Last;
+    }
+
+    class Counters<T>
+    {
+        [ThreadStatic] public static int Count;
+        [ThreadStatic] public static T Last;
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static int IncrementCount()
+    {
+        for (int i = 0; i < Iterations; i++)
+        {
+            Counters.Count++;
+        }
+        return Counters.Count;
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static int StoreLast(object o)
+    {
+        int count = 0;
+        for (int i = 0; i < Iterations; i++)
+        {
+            Counters.Last = o;
+            if (Counters.Last == o) count++;
+        }
+        return count;
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static int IncrementGenericCount<T>()
+    {
+        for (int i = 0; i < Iterations; i++)
+        {
+            Counters<T>.Count++;
+        }
+        return Counters<T>.Count;
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    public static int StoreGenericLast<T>(T value) where T : class
+    {
+        int count = 0;
+        for (int i = 0; i < Iterations; i++)
+        {
+            Counters<T>.Last = value;
+            if (Counters<T>.Last == value) count++;
+        }
+        return count;
+    }
+
+    static bool Run(string name, Func<int> f, int expected)
+    {
+        Stopwatch sw = Stopwatch.StartNew();
+        int result = f();
+        sw.Stop();
+        Console.WriteLine("{0,-24} {1,8} ms", name, sw.ElapsedMilliseconds);
+        return result == expected;
+    }
+
+    static bool RunAll(string thread)
+    {
+        bool ok = true;
+        ok &= Run(thread + " int", IncrementCount, Iterations);
+        ok &= Run(thread + " object", () => StoreLast(thread), Iterations);
+        ok &= Run(thread + " generic int", IncrementGenericCount<string>, Iterations);
+        ok &= Run(thread + " generic object", () => StoreGenericLast<string>(thread), Iterations);
+        ok &= (Counters.Last == (object)thread) && (Counters<string>.Last == thread);
+        return ok;
+    }
+
+    public static int Main()
+    {
+        bool ok = RunAll("main");
+
+        // The other thread starts with its own, uninitialized copies
+        bool otherOk = false;
+        Thread other = new Thread(() => otherOk = Counters.Count == 0 && Counters<string>.Last == null && RunAll("other"));
+        other.Start();
+        other.Join();
+
+        // And leaves the ones of this thread alone
+        ok &= otherOk;
+        ok &= (Counters.Count == Iterations) && (Counters<string>.Count == Iterations);
+        ok &= (Counters.Last == (object)"main") && (Counters<string>.Last == "main");
+
+        return ok ? Pass : Fail;
+    }
+}
@@ -0,0 +1,147 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+//
+
+// Vector<T> loops over int and float arrays next to their scalar forms: a clamp written with
+// Vector.Min/Vector.Max and an int dot product. With AVX2 enabled the vector loops run on
+// 256-bit registers; the scalar loops give the baseline.
+
+using System;
+using System.Diagnostics;
+using System.Numerics;
+using System.Runtime.CompilerServices;
+public class VectorLoops
+{
+    const int Pass = 100;
+    const int Fail = -1;
+    const int Length = 4096;
+    const int Iterations = 20000;
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    static void ClampScalar(int[] a, int[] result, int lo, int hi)
+    {
+        for (int i = 0; i < a.Length; i++)
+        {
+            result[i] = Math.Min(Math.Max(a[i], lo), hi);
+        }
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    static void ClampVector(int[] a, int[] result, int lo, int hi)
+    {
+        Vector<int> vlo = new Vector<int>(lo);
+        Vector<int> vhi = new Vector<int>(hi);
+        int i = 0;
+        for (; i <= a.Length - Vector<int>.Count; i += Vector<int>.Count)
+        {
+            Vector.Min(Vector.Max(new Vector<int>(a, i), vlo), vhi).CopyTo(result, i);
+        }
+        for (; i < a.Length; i++)
+        {
+            result[i] = Math.Min(Math.Max(a[i], lo), hi);
+        }
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    static int DotScalar(int[] a, int[] b)
+    {
+        int sum = 0;
+        for (int i = 0; i < a.Length; i++)
+        {
+            sum += a[i] * b[i];
+        }
+        return sum;
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    static int DotVector(int[] a, int[] b)
+    {
+        int sum = 0;
+        int i = 0;
+        for (; i <= a.Length - Vector<int>.Count; i += Vector<int>.Count)
+        {
+            sum += Vector.Dot(new Vector<int>(a, i), new Vector<int>(b, i));
+        }
+        for (; i < a.Length; i++)
+        {
+            sum += a[i] * b[i];
+        }
+        return sum;
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    static float MaxScalar(float[] a)
+    {
+        float max = float.MinValue;
+        for (int i = 0; i < a.Length; i++)
+        {
+            max = Math.Max(max, a[i]);
+        }
+        return max;
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    static float MaxVector(float[] a)
+    {
+        Vector<float> vmax = new Vector<float>(float.MinValue);
+        int i = 0;
+        for (; i <= a.Length - Vector<float>.Count; i += Vector<float>.Count)
+        {
+            vmax = Vector.Max(vmax, new Vector<float>(a, i));
+        }
+        float max = float.MinValue;
+        for (int j = 0; j < Vector<float>.Count; j++)
+        {
+            max = Math.Max(max, vmax[j]);
+        }
+        for (; i < a.Length; i++)
+        {
+            max = Math.Max(max, a[i]);
+        }
+        return max;
+    }
+
+    static long Time(Action action)
+    {
+        Stopwatch sw = Stopwatch.StartNew();
+        for (int i = 0; i < Iterations; i++)
+        {
+            action();
+        }
+        sw.Stop();
+        return sw.ElapsedMilliseconds;
+    }
+
+    public static int Main()
+    {
+        int[] a = new int[Length];
+        int[] b = new int[Length];
+        float[] f = new float[Length];
+        for (int i = 0; i < Length; i++)
+        {
+            a[i] = (i * 7919) % 2001 - 1000;
+            b[i] = (i * 104729) % 17 - 8;
+            f[i] = a[i] * 0.25f;
+        }
+
+        int[] scalarResult = new int[Length];
+        int[] vectorResult = new int[Length];
+        int scalarDot = 0, vectorDot = 0;
+        float scalarMax = 0, vectorMax = 0;
+
+        Console.WriteLine("Vector<int>.Count = {0}, hardware acceleration: {1}", Vector<int>.Count, Vector.IsHardwareAccelerated);
+        Console.WriteLine("{0,-16} {1,8} ms", "clamp scalar", Time(() => ClampScalar(a, scalarResult, -500, 500)));
+        Console.WriteLine("{0,-16} {1,8} ms", "clamp vector", Time(() => ClampVector(a, vectorResult, -500, 500)));
+        Console.WriteLine("{0,-16} {1,8} ms", "dot scalar", Time(() => scalarDot = DotScalar(a, b)));
+        Console.WriteLine("{0,-16} {1,8} ms", "dot vector", Time(() => vectorDot = DotVector(a, b)));
+        Console.WriteLine("{0,-16} {1,8} ms", "max scalar", Time(() => scalarMax = MaxScalar(f)));
+        Console.WriteLine("{0,-16} {1,8} ms", "max vector", Time(() => vectorMax = MaxVector(f)));
+
+        bool ok = (scalarDot == vectorDot) && (scalarMax == vectorMax);
+        for (int i = 0; i < Length; i++)
+        {
+            ok &= (scalarResult[i] == vectorResult[i]);
+        }
+        return ok ? Pass : Fail;
+    }
+}
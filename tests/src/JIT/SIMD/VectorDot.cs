@@ -0,0 +1,125 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+//
+
+// Vector.Dot on int and uint vectors (expanded inline when AVX2 is available) and on float
+// and double vectors, compared with scalar sums of products. The int cases include
+// products and sums that wrap around.
+
+using System;
+using System.Numerics;
+using System.Runtime.CompilerServices;
+public class VectorDotTest
+{
+    const int Pass = 100;
+    const int Fail = -1;
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    static int DotInt(Vector<int> a, Vector<int> b)
+    {
+        return Vector.Dot(a, b);
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    static uint DotUInt(Vector<uint> a, Vector<uint> b)
+    {
+        return Vector.Dot(a, b);
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    static float DotFloat(Vector<float> a, Vector<float> b)
+    {
+        return Vector.Dot(a, b);
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    static double DotDouble(Vector<double> a, Vector<double> b)
+    {
+        return Vector.Dot(a, b);
+    }
+
+    static bool CheckInt(int seed)
+    {
+        int n = Vector<int>.Count;
+        int[] a = new int[n];
+        int[] b = new int[n];
+        int expected = 0;
+        for (int i = 0; i < n; i++)
+        {
+            a[i] = seed * (i + 1) - 3 * i;
+            b[i] = (i % 2 == 0) ? 65537 * seed : -i;
+            expected = unchecked(expected + a[i] * b[i]);
+        }
+
+        int actual = DotInt(new Vector<int>(a), new Vector<int>(b));
+        if (actual != expected)
+        {
+            Console.WriteLine("int dot with seed {0}: {1} instead of {2}", seed, actual, expected);
+            return false;
+        }
+        return true;
+    }
+
+    static bool CheckUInt(uint seed)
+    {
+        int n = Vector<uint>.Count;
+        uint[] a = new uint[n];
+        uint[] b = new uint[n];
+        uint expected = 0;
+        for (int i = 0; i < n; i++)
+        {
+            a[i] = seed + (uint)i * 0x10001u;
+            b[i] = 0xFFFF0000u >> i;
+            expected = unchecked(expected + a[i] * b[i]);
+        }
+
+        uint actual = DotUInt(new Vector<uint>(a), new Vector<uint>(b));
+        if (actual != expected)
+        {
+            Console.WriteLine("uint dot with seed {0}: {1} instead of {2}", seed, actual, expected);
+            return false;
+        }
+        return true;
+    }
+
+    static bool CheckFloating()
+    {
+        int n = Vector<float>.Count;
+        float[] a = new float[n];
+        float[] b = new float[n];
+        float expectedFloat = 0;
+        for (int i = 0; i < n; i++)
+        {
+            // Small integers keep the sum exact whatever the order of the additions
+            a[i] = i + 1;
+            b[i] = 2 - i;
+            expectedFloat += a[i] * b[i];
+        }
+
+        int m = Vector<double>.Count;
+        double[] x = new double[m];
+        double[] y = new double[m];
+        double expectedDouble = 0;
+        for (int i = 0; i < m; i++)
+        {
+            x[i] = 0.5 * i;
+            y[i] = 4 - i;
+            expectedDouble += x[i] * y[i];
+        }
+
+        return DotFloat(new Vector<float>(a), new Vector<float>(b)) == expectedFloat &&
+               DotDouble(new Vector<double>(x), new Vector<double>(y)) == expectedDouble;
+    }
+
+    public static int Main()
+    {
+        bool ok = true;
+        ok &= CheckInt(0);
+        ok &= CheckInt(7);
+        ok &= CheckInt(int.MaxValue / 3);
+        ok &= CheckUInt(1);
+        ok &= CheckUInt(0xFFFFFFF0u);
+        ok &= CheckFloating();
+        return ok ? Pass : Fail;
+    }
+}
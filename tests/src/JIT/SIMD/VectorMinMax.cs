@@ -0,0 +1,179 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+//
+
+// Vector.Min and Vector.Max on the integer element types that have no SSE2 instruction
+// (sbyte, ushort, int, uint) as well as the ones that do, checked lane by lane against
+// Math.Min/Math.Max, including the extreme values of each type.
+
+using System;
+using System.Numerics;
+using System.Runtime.CompilerServices;
+public class VectorMinMaxTest
+{
+    const int Pass = 100;
+    const int Fail = -1;
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    static bool CheckSByte()
+    {
+        int n = Vector<sbyte>.Count;
+        sbyte[] a = new sbyte[n];
+        sbyte[] b = new sbyte[n];
+        for (int i = 0; i < n; i++)
+        {
+            a[i] = (sbyte)(i * 37 - 128);
+            b[i] = (i % 3 == 0) ? sbyte.MaxValue : (sbyte)(100 - i * 13);
+        }
+
+        sbyte[] min = new sbyte[n];
+        sbyte[] max = new sbyte[n];
+        Vector.Min(new Vector<sbyte>(a), new Vector<sbyte>(b)).CopyTo(min);
+        Vector.Max(new Vector<sbyte>(a), new Vector<sbyte>(b)).CopyTo(max);
+
+        for (int i = 0; i < n; i++)
+        {
+            if (min[i] != Math.Min(a[i], b[i]) || max[i] != Math.Max(a[i], b[i]))
+            {
+                Console.WriteLine("sbyte lane {0}: min {1} max {2} for {3}, {4}", i, min[i], max[i], a[i], b[i]);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    static bool CheckUShort()
+    {
+        int n = Vector<ushort>.Count;
+        ushort[] a = new ushort[n];
+        ushort[] b = new ushort[n];
+        for (int i = 0; i < n; i++)
+        {
+            a[i] = (ushort)(i * 9001);
+            b[i] = (i % 2 == 0) ? ushort.MaxValue : (ushort)(40000 - i * 1000);
+        }
+
+        ushort[] min = new ushort[n];
+        ushort[] max = new ushort[n];
+        Vector.Min(new Vector<ushort>(a), new Vector<ushort>(b)).CopyTo(min);
+        Vector.Max(new Vector<ushort>(a), new Vector<ushort>(b)).CopyTo(max);
+
+        for (int i = 0; i < n; i++)
+        {
+            if (min[i] != Math.Min(a[i], b[i]) || max[i] != Math.Max(a[i], b[i]))
+            {
+                Console.WriteLine("ushort lane {0}: min {1} max {2} for {3}, {4}", i, min[i], max[i], a[i], b[i]);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    static bool CheckInt()
+    {
+        int n = Vector<int>.Count;
+        int[] a = new int[n];
+        int[] b = new int[n];
+        for (int i = 0; i < n; i++)
+        {
+            a[i] = (i % 2 == 0) ? int.MinValue + i : i * 1000003;
+            b[i] = (i % 3 == 0) ? int.MaxValue : -i * 7919;
+        }
+
+        int[] min = new int[n];
+        int[] max = new int[n];
+        Vector.Min(new Vector<int>(a), new Vector<int>(b)).CopyTo(min);
+        Vector.Max(new Vector<int>(a), new Vector<int>(b)).CopyTo(max);
+
+        for (int i = 0; i < n; i++)
+        {
+            if (min[i] != Math.Min(a[i], b[i]) || max[i] != Math.Max(a[i], b[i]))
+            {
+                Console.WriteLine("int lane {0}: min {1} max {2} for {3}, {4}", i, min[i], max[i], a[i], b[i]);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    static bool CheckUInt()
+    {
+        int n = Vector<uint>.Count;
+        uint[] a = new uint[n];
+        uint[] b = new uint[n];
+        for (int i = 0; i < n; i++)
+        {
+            // Values above int.MaxValue would compare the wrong way with a signed instruction
+            a[i] = (i % 2 == 0) ? uint.MaxValue - (uint)i : (uint)i * 1000003;
+            b[i] = 0x80000000u + (uint)i * 17;
+        }
+
+        uint[] min = new uint[n];
+        uint[] max = new uint[n];
+        Vector.Min(new Vector<uint>(a), new Vector<uint>(b)).CopyTo(min);
+        Vector.Max(new Vector<uint>(a), new Vector<uint>(b)).CopyTo(max);
+
+        for (int i = 0; i < n; i++)
+        {
+            if (min[i] != Math.Min(a[i], b[i]) || max[i] != Math.Max(a[i], b[i]))
+            {
+                Console.WriteLine("uint lane {0}: min {1} max {2} for {3}, {4}", i, min[i], max[i], a[i], b[i]);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    [MethodImplAttribute(MethodImplOptions.NoInlining)]
+    static bool CheckShortAndFloat()
+    {
+        int n = Vector<short>.Count;
+        short[] a = new short[n];
+        short[] b = new short[n];
+        for (int i = 0; i < n; i++)
+        {
+            a[i] = (short)(i * 4099 - 32768);
+            b[i] = (short)(1000 - i * 300);
+        }
+
+        short[] min = new short[n];
+        Vector.Min(new Vector<short>(a), new Vector<short>(b)).CopyTo(min);
+        for (int i = 0; i < n; i++)
+        {
+            if (min[i] != Math.Min(a[i], b[i]))
+                return false;
+        }
+
+        int m = Vector<float>.Count;
+        float[] x = new float[m];
+        float[] y = new float[m];
+        for (int i = 0; i < m; i++)
+        {
+            x[i] = i * 1.5f - 3.0f;
+            y[i] = 2.0f - i;
+        }
+
+        float[] max = new float[m];
+        Vector.Max(new Vector<float>(x), new Vector<float>(y)).CopyTo(max);
+        for (int i = 0; i < m; i++)
+        {
+            if (max[i] != Math.Max(x[i], y[i]))
+                return false;
+        }
+        return true;
+    }
+
+    public static int Main()
+    {
+        bool ok = true;
+        ok &= CheckSByte();
+        ok &= CheckUShort();
+        ok &= CheckInt();
+        ok &= CheckUInt();
+        ok &= CheckShortAndFloat();
+        return ok ? Pass : Fail;
+    }
+}